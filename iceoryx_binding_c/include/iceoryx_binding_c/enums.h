@@ -146,7 +146,8 @@ enum iox_WaitSetResult
     WaitSetResult_WAIT_SET_FULL,
     WaitSetResult_ALREADY_ATTACHED,
     WaitSetResult_UNDEFINED_ERROR,
-    WaitSetResult_SUCCESS
+    WaitSetResult_SUCCESS,
+    WaitSetResult_FILE_DESCRIPTOR_NOT_AVAILABLE
 };
 
 /// @brief used to describe if attaching an object to a listener was successful or the kind of attachment error
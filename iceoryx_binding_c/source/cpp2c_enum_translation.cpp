@@ -109,6 +109,8 @@ iox_WaitSetResult waitSetResult(const iox::popo::WaitSetError value) noexcept
         return WaitSetResult_WAIT_SET_FULL;
     case WaitSetError::ALREADY_ATTACHED:
         return WaitSetResult_ALREADY_ATTACHED;
+    case WaitSetError::FILE_DESCRIPTOR_NOT_AVAILABLE:
+        return WaitSetResult_FILE_DESCRIPTOR_NOT_AVAILABLE;
     }
     return WaitSetResult_UNDEFINED_ERROR;
 }
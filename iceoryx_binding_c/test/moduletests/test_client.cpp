@@ -71,7 +71,9 @@ class iox_client_test : public Test
         sutPort->m_connectRequested.store(true);
         sutPort->m_connectionState = iox::ConnectionState::CONNECTED;
 
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&serverChunkQueueData);
+        EXPECT_FALSE(ChunkDistributor<ClientChunkDistributorData_t>(&sutPort->m_chunkSenderData)
+                         .tryAddQueue(&serverChunkQueueData)
+                         .has_error());
     }
 
     void receiveChunk(const int64_t chunkValue = 0)
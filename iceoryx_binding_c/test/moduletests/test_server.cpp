@@ -86,7 +86,9 @@ class iox_server_test : public Test
 
     void connectClient()
     {
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&clientResponseQueueData);
+        EXPECT_FALSE(ChunkDistributor<ServerChunkDistributorData_t>(&sutPort->m_chunkSenderData)
+                         .tryAddQueue(&clientResponseQueueData)
+                         .has_error());
     }
 
     void prepareServerInit(const ServerOptions& options = ServerOptions())
@@ -0,0 +1,312 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/version/version_info.hpp"
+#include "iox/detail/convert.hpp"
+#include "iox/logging.hpp"
+#include "iox/message_queue.hpp"
+#include "iox/named_pipe.hpp"
+#include "iox/optional.hpp"
+#include "iox/unix_domain_socket.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+using namespace iox;
+using namespace iox::units::duration_literals;
+
+constexpr uint64_t NUMBER_OF_ROUND_TRIPS{10000U};
+constexpr uint64_t NUMBER_OF_APPLICATION_STARTS{200U};
+constexpr units::Duration RECEIVE_TIMEOUT{1_s};
+
+// NOLINTJUSTIFICATION used as safe compile time string literal
+// NOLINTBEGIN(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+constexpr const char ROUDI_CHANNEL_NAME[]{"iox_bm_ipc_roudi"};
+constexpr const char APP_CHANNEL_NAME[]{"iox_bm_ipc_app"};
+// NOLINTEND(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+
+using Clock_t = std::chrono::steady_clock;
+
+template <typename IpcChannelType>
+const char* channelName() noexcept;
+
+template <>
+const char* channelName<UnixDomainSocket>() noexcept
+{
+    return "unix domain socket";
+}
+
+template <>
+const char* channelName<MessageQueue>() noexcept
+{
+    return "message queue";
+}
+
+template <>
+const char* channelName<NamedPipe>() noexcept
+{
+    return "named pipe (shm)";
+}
+
+double elapsedMicroseconds(const Clock_t::time_point start) noexcept
+{
+    return std::chrono::duration<double, std::micro>(Clock_t::now() - start).count();
+}
+
+struct Latencies
+{
+    std::vector<double> microseconds;
+    uint64_t failures{0U};
+};
+
+/// @brief the messages of a request and its response as they are exchanged between a runtime and RouDi
+struct Exchange
+{
+    const char* name;
+    std::string request;
+    std::string response;
+};
+
+std::vector<Exchange> createExchanges() noexcept
+{
+    const RuntimeName_t runtimeName{"ipc_channel_latency_app"};
+
+    runtime::IpcMessage registration;
+    registration << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG) << runtimeName
+                 << convert::toString(4711) << convert::toString(1000) << convert::toString(1234567890123U)
+                 << static_cast<Serialization>(version::VersionInfo::getCurrentVersion()).toString();
+    runtime::IpcMessage registrationAck;
+    registrationAck << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK) << convert::toString(67108864U)
+                    << convert::toString(123456U) << convert::toString(1234567890123U) << convert::toString(1U)
+                    << convert::toString(4096U);
+
+    runtime::IpcMessage createPublisher;
+    createPublisher << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER) << runtimeName
+                    << static_cast<Serialization>(capro::ServiceDescription{"Radar", "FrontLeft", "Objects"}).toString()
+                    << popo::PublisherOptions().serialize().toString()
+                    << static_cast<Serialization>(runtime::PortConfigInfo()).toString();
+    runtime::IpcMessage createPublisherAck;
+    createPublisherAck << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
+                       << convert::toString(2097152U) << convert::toString(1U);
+
+    return {{"registration", registration.getMessage(), registrationAck.getMessage()},
+            {"port creation", createPublisher.getMessage(), createPublisherAck.getMessage()}};
+}
+
+template <typename IpcChannelType>
+optional<IpcChannelType> openChannel(const PosixIpcChannelName_t& name, const PosixIpcChannelSide channelSide) noexcept
+{
+    optional<IpcChannelType> channel;
+    typename IpcChannelType::Builder_t()
+        .name(name)
+        .channelSide(channelSide)
+        .maxMsgSize(APP_MESSAGE_SIZE)
+        .maxMsgNumber(APP_MAX_MESSAGES)
+        .create()
+        .and_then([&](auto& createdChannel) { channel.emplace(std::move(createdChannel)); });
+    return channel;
+}
+
+/// @brief measures the round trip of a request from a runtime to RouDi and the response back to the runtime; like
+/// with iceoryx each side receives from its own channel and sends via the channel of the other side
+template <typename IpcChannelType>
+Latencies measureRoundTrips(const Exchange& exchange) noexcept
+{
+    Latencies latencies;
+
+    IOX_DISCARD_RESULT(IpcChannelType::unlinkIfExists(ROUDI_CHANNEL_NAME));
+    IOX_DISCARD_RESULT(IpcChannelType::unlinkIfExists(APP_CHANNEL_NAME));
+    auto roudiChannel = openChannel<IpcChannelType>(ROUDI_CHANNEL_NAME, PosixIpcChannelSide::SERVER);
+    auto appChannel = openChannel<IpcChannelType>(APP_CHANNEL_NAME, PosixIpcChannelSide::SERVER);
+    if (!roudiChannel.has_value() || !appChannel.has_value())
+    {
+        latencies.failures = NUMBER_OF_ROUND_TRIPS;
+        return latencies;
+    }
+    auto channelToRoudi = openChannel<IpcChannelType>(ROUDI_CHANNEL_NAME, PosixIpcChannelSide::CLIENT);
+    auto channelToApp = openChannel<IpcChannelType>(APP_CHANNEL_NAME, PosixIpcChannelSide::CLIENT);
+    if (!channelToRoudi.has_value() || !channelToApp.has_value())
+    {
+        latencies.failures = NUMBER_OF_ROUND_TRIPS;
+        return latencies;
+    }
+
+    std::thread roudi([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_ROUND_TRIPS; ++i)
+        {
+            if (roudiChannel->timedReceive(RECEIVE_TIMEOUT).has_error())
+            {
+                return;
+            }
+            IOX_DISCARD_RESULT(channelToApp->send(exchange.response));
+        }
+    });
+
+    latencies.microseconds.reserve(NUMBER_OF_ROUND_TRIPS);
+    for (uint64_t i = 0U; i < NUMBER_OF_ROUND_TRIPS; ++i)
+    {
+        const auto start = Clock_t::now();
+        if (channelToRoudi->send(exchange.request).has_error() || appChannel->timedReceive(RECEIVE_TIMEOUT).has_error())
+        {
+            latencies.failures = NUMBER_OF_ROUND_TRIPS - i;
+            break;
+        }
+        latencies.microseconds.push_back(elapsedMicroseconds(start));
+    }
+
+    roudi.join();
+    return latencies;
+}
+
+bool sendRequest(runtime::IpcRuntimeInterface& ipc,
+                 const runtime::IpcMessage& request,
+                 const runtime::IpcMessageType expectedResponse) noexcept
+{
+    runtime::IpcMessage response;
+    return ipc.sendRequestToRouDi(request, response)
+           && runtime::stringToIpcMessageType(response.getElementAtIndex(0U).c_str()) == expectedResponse;
+}
+
+/// @brief starts RouDi and lets one application after the other register, create a publisher and terminate; RouDi
+/// and the runtimes use the IPC channel which was selected with the 'IOX_IPC_CHANNEL_TYPE' CMake option
+std::vector<Latencies> measureApplicationStarts() noexcept
+{
+    auto config = roudi_env::MinimalIceoryxConfigBuilder().create();
+    config.sharesAddressSpaceWithApplications = true;
+
+    roudi::IceOryxRouDiComponents roudiComponents(config);
+    roudi::RouDi roudi(roudiComponents.rouDiMemoryManager, roudiComponents.portManager, config);
+
+    const RuntimeName_t name{"ipc_channel_latency_app"};
+    const capro::ServiceDescription topic{"Radar", "FrontLeft", "Objects"};
+    runtime::IpcMessage createPublisher;
+    createPublisher << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER) << name
+                    << static_cast<Serialization>(topic).toString() << popo::PublisherOptions().serialize().toString()
+                    << static_cast<Serialization>(runtime::PortConfigInfo()).toString();
+    runtime::IpcMessage termination;
+    termination << runtime::IpcMessageTypeToString(runtime::IpcMessageType::TERMINATION) << name;
+
+    std::vector<Latencies> latencies(2U);
+    auto& registration = latencies[0U];
+    auto& portCreation = latencies[1U];
+    for (uint64_t i = 0U; i < NUMBER_OF_APPLICATION_STARTS; ++i)
+    {
+        auto start = Clock_t::now();
+        auto ipc = runtime::IpcRuntimeInterface::create(name, config.domainId, RECEIVE_TIMEOUT);
+        if (ipc.has_error())
+        {
+            ++registration.failures;
+            continue;
+        }
+        registration.microseconds.push_back(elapsedMicroseconds(start));
+
+        start = Clock_t::now();
+        if (sendRequest(ipc.value(), createPublisher, runtime::IpcMessageType::CREATE_PUBLISHER_ACK))
+        {
+            portCreation.microseconds.push_back(elapsedMicroseconds(start));
+        }
+        else
+        {
+            ++portCreation.failures;
+        }
+
+        IOX_DISCARD_RESULT(sendRequest(ipc.value(), termination, runtime::IpcMessageType::TERMINATION_ACK));
+    }
+
+    return latencies;
+}
+
+double percentile(const std::vector<double>& sortedValues, const uint64_t percent) noexcept
+{
+    const auto index = (sortedValues.size() - 1U) * percent / 100U;
+    return sortedValues[index];
+}
+
+void printResult(const char* channel, const char* exchange, Latencies& latencies) noexcept
+{
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(20) << channel << std::setw(15) << exchange;
+    auto& values = latencies.microseconds;
+    if (values.empty())
+    {
+        std::cout << std::setw(40) << "not available" << std::endl;
+        return;
+    }
+    std::sort(values.begin(), values.end());
+    std::cout << std::fixed << std::setprecision(1) << std::setw(10) << percentile(values, 0U) << std::setw(10)
+              << percentile(values, 50U) << std::setw(10) << percentile(values, 99U) << std::setw(10)
+              << percentile(values, 100U) << std::setw(8) << latencies.failures << std::endl;
+}
+
+template <typename IpcChannelType>
+void benchmarkChannel(const std::vector<Exchange>& exchanges) noexcept
+{
+    for (const auto& exchange : exchanges)
+    {
+        auto latencies = measureRoundTrips<IpcChannelType>(exchange);
+        printResult(channelName<IpcChannelType>(), exchange.name, latencies);
+    }
+}
+
+void printHeader() noexcept
+{
+    std::cout << std::setw(20) << "channel" << std::setw(15) << "request" << std::setw(10) << "min" << std::setw(10)
+              << "median" << std::setw(10) << "p99" << std::setw(10) << "max" << std::setw(8) << "failed"
+              << std::endl;
+}
+} // namespace
+
+int main()
+{
+    iox::log::Logger::init(iox::log::logLevelFromEnvOr(iox::log::LogLevel::Warn));
+
+    const auto exchanges = createExchanges();
+
+    std::cout << "round trip latency of the IPC channels in us, " << NUMBER_OF_ROUND_TRIPS << " requests each"
+              << std::endl;
+    printHeader();
+    benchmarkChannel<UnixDomainSocket>(exchanges);
+    benchmarkChannel<MessageQueue>(exchanges);
+    benchmarkChannel<NamedPipe>(exchanges);
+
+    std::cout << std::endl
+              << "latency of " << NUMBER_OF_APPLICATION_STARTS << " application starts with RouDi in us" << std::endl;
+    printHeader();
+    auto latencies = measureApplicationStarts();
+    const auto* channel = channelName<platform::IoxIpcChannelType>();
+    printResult(channel, "registration", latencies[0U]);
+    printResult(channel, "port creation", latencies[1U]);
+
+    return EXIT_SUCCESS;
+}
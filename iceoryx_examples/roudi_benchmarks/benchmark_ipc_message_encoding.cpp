@@ -0,0 +1,275 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_frame.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iox/detail/convert.hpp"
+#include "iox/logging.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace
+{
+using namespace iox;
+using namespace iox::units::duration_literals;
+
+constexpr uint64_t NUMBER_OF_ENCODED_REQUESTS{100000U};
+constexpr uint64_t NUMBER_OF_TOPICS{200U};
+
+enum class Encoding : uint8_t
+{
+    TEXT,
+    BINARY
+};
+
+using Clock_t = std::chrono::steady_clock;
+
+double elapsedNanoseconds(const Clock_t::time_point start) noexcept
+{
+    return std::chrono::duration<double, std::nano>(Clock_t::now() - start).count();
+}
+
+capro::ServiceDescription topic(const uint64_t index) noexcept
+{
+    return {"Encoding", "Benchmark", into<lossy<capro::IdString_t>>(convert::toString(index))};
+}
+
+runtime::IpcMessage encodeText(const runtime::IpcMessageType type,
+                               const RuntimeName_t& name,
+                               const capro::ServiceDescription& service) noexcept
+{
+    const runtime::PortConfigInfo portConfigInfo;
+    runtime::IpcMessage request;
+    request << runtime::IpcMessageTypeToString(type) << name << static_cast<Serialization>(service).toString();
+    if (type == runtime::IpcMessageType::CREATE_PUBLISHER)
+    {
+        request << popo::PublisherOptions().serialize().toString();
+    }
+    else
+    {
+        request << popo::SubscriberOptions().serialize().toString();
+    }
+    request << static_cast<Serialization>(portConfigInfo).toString();
+    return request;
+}
+
+runtime::IpcFrame encodeBinary(const runtime::IpcMessageType type,
+                               const RuntimeName_t& name,
+                               const capro::ServiceDescription& service) noexcept
+{
+    const runtime::PortConfigInfo portConfigInfo;
+    runtime::IpcFrame request(type, name);
+    request << service;
+    if (type == runtime::IpcMessageType::CREATE_PUBLISHER)
+    {
+        request << popo::PublisherOptions();
+    }
+    else
+    {
+        request << popo::SubscriberOptions();
+    }
+    request << portConfigInfo;
+    return request;
+}
+
+/// @brief parses a CREATE_PUBLISHER request like RouDi does
+bool decodeText(const std::string& received) noexcept
+{
+    const runtime::IpcMessage request(received);
+    const auto type = runtime::stringToIpcMessageType(request.getElementAtIndex(0U).c_str());
+    const RuntimeName_t name{into<lossy<RuntimeName_t>>(request.getElementAtIndex(1U))};
+    if (type != runtime::IpcMessageType::CREATE_PUBLISHER || name.empty() || request.getNumberOfElements() != 5U)
+    {
+        return false;
+    }
+    const auto service = capro::ServiceDescription::deserialize(Serialization(request.getElementAtIndex(2U)));
+    const auto options = popo::PublisherOptions::deserialize(Serialization(request.getElementAtIndex(3U)));
+    const runtime::PortConfigInfo portConfigInfo{Serialization(request.getElementAtIndex(4U))};
+    return !service.has_error() && !options.has_error() && portConfigInfo == runtime::PortConfigInfo();
+}
+
+/// @brief parses a CREATE_PUBLISHER request like RouDi does
+bool decodeBinary(const runtime::IpcFrame& received) noexcept
+{
+    if (received.getMessageType() != runtime::IpcMessageType::CREATE_PUBLISHER || received.getRuntimeName().empty())
+    {
+        return false;
+    }
+    capro::ServiceDescription service;
+    popo::PublisherOptions options;
+    runtime::PortConfigInfo portConfigInfo;
+    runtime::IpcFrameReader reader(received);
+    reader >> service >> options >> portConfigInfo;
+    return reader.isValid() && reader.isAtEnd();
+}
+
+struct EncodingResult
+{
+    double nanosecondsPerRequest{0.0};
+    uint64_t size{0U};
+    uint64_t failedRequests{0U};
+};
+
+/// @brief encodes a request, copies it as the IPC channel does and decodes it
+EncodingResult measureEncoding(const Encoding encoding) noexcept
+{
+    const RuntimeName_t name{"encoding_benchmark"};
+    EncodingResult result;
+
+    const auto start = Clock_t::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_ENCODED_REQUESTS; ++i)
+    {
+        const auto service = topic(i % NUMBER_OF_TOPICS);
+        bool isDecoded{false};
+        if (encoding == Encoding::TEXT)
+        {
+            const auto request = encodeText(runtime::IpcMessageType::CREATE_PUBLISHER, name, service);
+            const std::string received{request.getMessage()};
+            result.size = received.size();
+            isDecoded = decodeText(received);
+        }
+        else
+        {
+            const auto request = encodeBinary(runtime::IpcMessageType::CREATE_PUBLISHER, name, service);
+            const runtime::IpcFrame received{request};
+            result.size = received.size();
+            isDecoded = decodeBinary(received);
+        }
+        if (!isDecoded)
+        {
+            ++result.failedRequests;
+        }
+    }
+    result.nanosecondsPerRequest = elapsedNanoseconds(start) / static_cast<double>(NUMBER_OF_ENCODED_REQUESTS);
+    return result;
+}
+
+template <typename Request>
+bool sendRequest(runtime::IpcRuntimeInterface& ipc,
+                 const Request& request,
+                 const runtime::IpcMessageType expectedResponse) noexcept
+{
+    runtime::IpcMessage response;
+    return ipc.sendRequestToRouDi(request, response)
+           && runtime::stringToIpcMessageType(response.getElementAtIndex(0U).c_str()) == expectedResponse;
+}
+
+struct RegistrationResult
+{
+    double nanosecondsPerRequest{0.0};
+    uint64_t failedRequests{0U};
+};
+
+/// @brief starts RouDi and lets a runtime create a publisher and a subscriber for each topic
+RegistrationResult measureRegistration(const Encoding encoding) noexcept
+{
+    auto config = roudi_env::MinimalIceoryxConfigBuilder().create();
+    config.sharesAddressSpaceWithApplications = true;
+
+    roudi::IceOryxRouDiComponents roudiComponents(config);
+    roudi::RouDi roudi(roudiComponents.rouDiMemoryManager, roudiComponents.portManager, config);
+
+    RegistrationResult result;
+    const RuntimeName_t name{"encoding_benchmark"};
+    auto ipc = runtime::IpcRuntimeInterface::create(name, config.domainId, 10_s);
+    if (ipc.has_error())
+    {
+        result.failedRequests = 2U * NUMBER_OF_TOPICS;
+        return result;
+    }
+
+    const auto start = Clock_t::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_TOPICS; ++i)
+    {
+        const auto service = topic(i);
+        bool isCreated{false};
+        if (encoding == Encoding::TEXT)
+        {
+            isCreated = sendRequest(ipc.value(),
+                                    encodeText(runtime::IpcMessageType::CREATE_PUBLISHER, name, service),
+                                    runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
+                        && sendRequest(ipc.value(),
+                                       encodeText(runtime::IpcMessageType::CREATE_SUBSCRIBER, name, service),
+                                       runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK);
+        }
+        else
+        {
+            isCreated = sendRequest(ipc.value(),
+                                    encodeBinary(runtime::IpcMessageType::CREATE_PUBLISHER, name, service),
+                                    runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
+                        && sendRequest(ipc.value(),
+                                       encodeBinary(runtime::IpcMessageType::CREATE_SUBSCRIBER, name, service),
+                                       runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK);
+        }
+        if (!isCreated)
+        {
+            ++result.failedRequests;
+        }
+    }
+    result.nanosecondsPerRequest = elapsedNanoseconds(start) / static_cast<double>(2U * NUMBER_OF_TOPICS);
+
+    runtime::IpcMessage termination;
+    termination << runtime::IpcMessageTypeToString(runtime::IpcMessageType::TERMINATION) << name;
+    IOX_DISCARD_RESULT(sendRequest(ipc.value(), termination, runtime::IpcMessageType::TERMINATION_ACK));
+
+    return result;
+}
+
+const char* encodingName(const Encoding encoding) noexcept
+{
+    return encoding == Encoding::TEXT ? "text" : "binary";
+}
+} // namespace
+
+int main()
+{
+    iox::log::Logger::init(iox::log::logLevelFromEnvOr(iox::log::LogLevel::Warn));
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << "encode, copy and decode " << NUMBER_OF_ENCODED_REQUESTS << " CREATE_PUBLISHER requests"
+              << std::endl;
+    std::cout << std::setw(8) << "encoding" << std::setw(16) << "ns/request" << std::setw(10) << "bytes"
+              << std::setw(8) << "failed" << std::endl;
+    for (const auto encoding : {Encoding::TEXT, Encoding::BINARY})
+    {
+        const auto result = measureEncoding(encoding);
+        std::cout << std::setw(8) << encodingName(encoding) << std::fixed << std::setprecision(1) << std::setw(16)
+                  << result.nanosecondsPerRequest << std::setw(10) << result.size << std::setw(8)
+                  << result.failedRequests << std::endl;
+    }
+
+    std::cout << std::endl
+              << "create " << NUMBER_OF_TOPICS << " publishers and " << NUMBER_OF_TOPICS << " subscribers via RouDi"
+              << std::endl;
+    std::cout << std::setw(8) << "encoding" << std::setw(16) << "us/request" << std::setw(18) << "failed" << std::endl;
+    for (const auto encoding : {Encoding::TEXT, Encoding::BINARY})
+    {
+        const auto result = measureRegistration(encoding);
+        std::cout << std::setw(8) << encodingName(encoding) << std::fixed << std::setprecision(1) << std::setw(16)
+                  << result.nanosecondsPerRequest / 1000.0 << std::setw(18) << result.failedRequests << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
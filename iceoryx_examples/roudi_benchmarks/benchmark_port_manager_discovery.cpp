@@ -0,0 +1,244 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/port_manager.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/roudi/memory/iceoryx_roudi_memory_manager.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iox/detail/convert.hpp"
+#include "iox/posix_user.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace
+{
+using namespace iox;
+using namespace iox::roudi;
+
+constexpr uint64_t NUMBER_OF_PORTS{5000U};
+constexpr uint64_t NUMBER_OF_PROCESSES{200U};
+constexpr uint64_t NUMBER_OF_TOPICS{250U};
+constexpr uint64_t NUMBER_OF_DISCOVERY_RUNS{100U};
+
+enum class PortKind : uint8_t
+{
+    PUBLISHER,
+    SUBSCRIBER,
+    SERVER,
+    CLIENT,
+    PORT_KIND_END
+};
+
+constexpr uint64_t NUMBER_OF_PORT_KINDS{static_cast<uint64_t>(PortKind::PORT_KIND_END)};
+
+/// @brief the number of ports per kind which fit into the PortPool; RouDi itself uses some of the publishers
+// NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+constexpr uint64_t PORT_POOL_CAPACITY[NUMBER_OF_PORT_KINDS]{
+    MAX_PUBLISHERS - NUMBER_OF_INTERNAL_PUBLISHERS, MAX_SUBSCRIBERS, MAX_SERVERS, MAX_CLIENTS};
+
+using Clock_t = std::chrono::steady_clock;
+
+double elapsedMilliseconds(const Clock_t::time_point start) noexcept
+{
+    return std::chrono::duration<double, std::milli>(Clock_t::now() - start).count();
+}
+
+RuntimeName_t runtimeName(const uint64_t process) noexcept
+{
+    return into<lossy<RuntimeName_t>>("process_" + convert::toString(process));
+}
+
+capro::ServiceDescription topic(const uint64_t index) noexcept
+{
+    return {"Topic", into<lossy<capro::IdString_t>>(convert::toString(index % NUMBER_OF_TOPICS)), "Event"};
+}
+
+capro::ServiceDescription method(const uint64_t index) noexcept
+{
+    // servers must be unique, therefore there are as many methods as servers
+    return {"Method", into<lossy<capro::IdString_t>>(convert::toString(index)), "Request"};
+}
+
+struct PortCounter
+{
+    uint64_t created[NUMBER_OF_PORT_KINDS]{};
+    bool isFull[NUMBER_OF_PORT_KINDS]{};
+
+    uint64_t total() const noexcept
+    {
+        uint64_t sum{0U};
+        for (const auto count : created)
+        {
+            sum += count;
+        }
+        return sum;
+    }
+
+    bool allFull() const noexcept
+    {
+        for (const auto full : isFull)
+        {
+            if (!full)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/// @brief creates the ports round robin over the port kinds and processes until NUMBER_OF_PORTS ports exist or the
+/// port pool is exhausted; every creation includes the discovery which connects the new port
+PortCounter createPorts(PortManager& portManager, mepoo::MemoryManager* const payloadDataSegmentMemoryManager) noexcept
+{
+    PortCounter counter;
+    uint64_t process{0U};
+    for (uint64_t kind = 0U; counter.total() < NUMBER_OF_PORTS && !counter.allFull();
+         kind = (kind + 1U) % NUMBER_OF_PORT_KINDS)
+    {
+        if (counter.created[kind] == PORT_POOL_CAPACITY[kind])
+        {
+            counter.isFull[kind] = true;
+        }
+        if (counter.isFull[kind])
+        {
+            continue;
+        }
+
+        const auto name = runtimeName(process);
+        const auto index = counter.created[kind];
+        bool hasError{false};
+        switch (static_cast<PortKind>(kind))
+        {
+        case PortKind::PUBLISHER:
+            hasError = portManager
+                           .acquirePublisherPortData(topic(index),
+                                                     popo::PublisherOptions(),
+                                                     name,
+                                                     payloadDataSegmentMemoryManager,
+                                                     PortManager::PortConfigInfo())
+                           .has_error();
+            break;
+        case PortKind::SUBSCRIBER:
+            hasError = portManager
+                           .acquireSubscriberPortData(
+                               topic(index), popo::SubscriberOptions(), name, PortManager::PortConfigInfo())
+                           .has_error();
+            break;
+        case PortKind::SERVER:
+            hasError = portManager
+                           .acquireServerPortData(method(index),
+                                                  popo::ServerOptions(),
+                                                  name,
+                                                  payloadDataSegmentMemoryManager,
+                                                  PortManager::PortConfigInfo())
+                           .has_error();
+            break;
+        case PortKind::CLIENT:
+            hasError = portManager
+                           .acquireClientPortData(method(index % NUMBER_OF_TOPICS),
+                                                  popo::ClientOptions(),
+                                                  name,
+                                                  payloadDataSegmentMemoryManager,
+                                                  PortManager::PortConfigInfo())
+                           .has_error();
+            break;
+        case PortKind::PORT_KIND_END:
+            break;
+        }
+
+        if (hasError)
+        {
+            counter.isFull[kind] = true;
+            continue;
+        }
+        ++counter.created[kind];
+        process = (process + 1U) % NUMBER_OF_PROCESSES;
+    }
+    return counter;
+}
+
+void printResult(const char* phase, const double milliseconds) noexcept
+{
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(32) << phase << " : " << std::setw(12) << std::fixed << std::setprecision(3) << milliseconds
+              << " ms" << std::endl;
+}
+} // namespace
+
+int main()
+{
+    IceOryxRouDiMemoryManager roudiMemoryManager(roudi_env::MinimalIceoryxConfigBuilder().create());
+    if (roudiMemoryManager.createAndAnnounceMemory().has_error())
+    {
+        std::cerr << "Could not create the shared memory" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto segmentInfo = roudiMemoryManager.segmentManager().value()->getSegmentInformationWithWriteAccessForUser(
+        PosixUser::getUserOfCurrentProcess());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        std::cerr << "No payload segment with write access for the current user" << std::endl;
+        return EXIT_FAILURE;
+    }
+    auto* payloadDataSegmentMemoryManager = &segmentInfo.m_memoryManager.value().get();
+
+    double totalMilliseconds{0.0};
+    {
+        PortManager portManager(&roudiMemoryManager);
+        portManager.stopPortIntrospection();
+
+        auto start = Clock_t::now();
+        const auto counter = createPorts(portManager, payloadDataSegmentMemoryManager);
+        const auto createMilliseconds = elapsedMilliseconds(start);
+
+        std::cout << "created " << counter.created[static_cast<uint64_t>(PortKind::PUBLISHER)] << " publishers, "
+                  << counter.created[static_cast<uint64_t>(PortKind::SUBSCRIBER)] << " subscribers, "
+                  << counter.created[static_cast<uint64_t>(PortKind::SERVER)] << " servers and "
+                  << counter.created[static_cast<uint64_t>(PortKind::CLIENT)] << " clients in "
+                  << NUMBER_OF_PROCESSES << " processes" << std::endl;
+
+        start = Clock_t::now();
+        for (uint64_t i = 0U; i < NUMBER_OF_DISCOVERY_RUNS; ++i)
+        {
+            portManager.doDiscovery();
+        }
+        const auto discoveryMilliseconds = elapsedMilliseconds(start) / static_cast<double>(NUMBER_OF_DISCOVERY_RUNS);
+
+        start = Clock_t::now();
+        for (uint64_t process = 0U; process < NUMBER_OF_PROCESSES; ++process)
+        {
+            portManager.deletePortsOfProcess(runtimeName(process));
+        }
+        const auto deleteMilliseconds = elapsedMilliseconds(start);
+
+        printResult("create and connect all ports", createMilliseconds);
+        printResult("periodic discovery run", discoveryMilliseconds);
+        printResult("disconnect and delete all ports", deleteMilliseconds);
+        totalMilliseconds = createMilliseconds + discoveryMilliseconds + deleteMilliseconds;
+    }
+    printResult("total discovery time", totalMilliseconds);
+
+    UntypedRelativePointer::unregisterAll();
+    return EXIT_SUCCESS;
+}
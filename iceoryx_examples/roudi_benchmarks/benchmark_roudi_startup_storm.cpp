@@ -0,0 +1,269 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/mman.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/atomic.hpp"
+#include "iox/detail/convert.hpp"
+#include "iox/logging.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace iox;
+using namespace iox::units::duration_literals;
+
+constexpr uint64_t DEFAULT_NUMBER_OF_PROCESSES{100U};
+constexpr uint64_t NUMBER_OF_TOPICS{10U};
+// NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+constexpr uint32_t WORKER_COUNTS[]{1U, 2U, 4U, 8U};
+
+using Clock_t = std::chrono::steady_clock;
+
+RuntimeName_t runtimeName(const uint64_t process) noexcept
+{
+    return into<lossy<RuntimeName_t>>("storm_" + convert::toString(process));
+}
+
+bool sendRequest(runtime::IpcRuntimeInterface& ipc,
+                 const runtime::IpcMessage& request,
+                 const runtime::IpcMessageType expectedResponse) noexcept
+{
+    runtime::IpcMessage response;
+    return ipc.sendRequestToRouDi(request, response)
+           && runtime::stringToIpcMessageType(response.getElementAtIndex(0U).c_str()) == expectedResponse;
+}
+
+/// @brief does what an application does at startup, i.e. it registers at RouDi and requests a publisher and a
+/// subscriber
+bool startApplication(runtime::IpcRuntimeInterface& ipc, const RuntimeName_t& name, const uint64_t process) noexcept
+{
+    const capro::ServiceDescription topic{
+        "Storm", "Topic", into<lossy<capro::IdString_t>>(convert::toString(process % NUMBER_OF_TOPICS))};
+    const runtime::PortConfigInfo portConfigInfo;
+
+    runtime::IpcMessage createPublisher;
+    createPublisher << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER) << name
+                    << static_cast<Serialization>(topic).toString()
+                    << popo::PublisherOptions().serialize().toString()
+                    << static_cast<Serialization>(portConfigInfo).toString();
+
+    runtime::IpcMessage createSubscriber;
+    createSubscriber << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER) << name
+                     << static_cast<Serialization>(topic).toString()
+                     << popo::SubscriberOptions().serialize().toString()
+                     << static_cast<Serialization>(portConfigInfo).toString();
+
+    return sendRequest(ipc, createPublisher, runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
+           && sendRequest(ipc, createSubscriber, runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK);
+}
+
+struct StormResult
+{
+    std::vector<double> latenciesInMilliseconds;
+    double totalMilliseconds{0.0};
+    uint64_t failedProcesses{0U};
+};
+
+/// @brief the state which RouDi shares with the forked application processes
+struct SharedStormState
+{
+    concurrent::Atomic<uint64_t> readyProcesses{0U};
+    concurrent::Atomic<uint64_t> finishedProcesses{0U};
+    concurrent::Atomic<uint64_t> failedProcesses{0U};
+    concurrent::Atomic<bool> start{false};
+    std::array<double, MAX_PROCESS_NUMBER> latenciesInMilliseconds{};
+};
+
+/// @brief the application process which waits for the start of the storm, starts up and terminates after all other
+/// processes were served in order to not distort the measurement
+void runApplication(SharedStormState& state,
+                    const uint64_t numberOfProcesses,
+                    const uint64_t process,
+                    const DomainId domainId) noexcept
+{
+    const auto name = runtimeName(process);
+    ++state.readyProcesses;
+    while (!state.start.load())
+    {
+        std::this_thread::yield();
+    }
+
+    const auto startTime = Clock_t::now();
+    auto ipc = runtime::IpcRuntimeInterface::create(name, domainId, 10_s);
+    const bool started = !ipc.has_error() && startApplication(ipc.value(), name, process);
+    state.latenciesInMilliseconds[process] =
+        std::chrono::duration<double, std::milli>(Clock_t::now() - startTime).count();
+    if (!started)
+    {
+        ++state.failedProcesses;
+    }
+
+    ++state.finishedProcesses;
+    while (state.finishedProcesses.load() < numberOfProcesses)
+    {
+        std::this_thread::yield();
+    }
+    if (!ipc.has_error())
+    {
+        runtime::IpcMessage termination;
+        termination << runtime::IpcMessageTypeToString(runtime::IpcMessageType::TERMINATION) << name;
+        IOX_DISCARD_RESULT(sendRequest(ipc.value(), termination, runtime::IpcMessageType::TERMINATION_ACK));
+    }
+}
+
+/// @brief forks the application processes, starts a RouDi with the given number of runtime message workers and lets
+/// all processes register in parallel
+StormResult runStorm(const uint64_t numberOfProcesses, const uint32_t workerCount) noexcept
+{
+    auto config = roudi_env::MinimalIceoryxConfigBuilder().create();
+    config.monitoringMode = roudi::MonitoringMode::OFF;
+    config.runtimeMessageWorkerCount = workerCount;
+
+    StormResult result;
+    void* sharedMemory =
+        mmap(nullptr, sizeof(SharedStormState), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (sharedMemory == MAP_FAILED)
+    {
+        std::cerr << "Unable to map the memory which is shared with the application processes" << std::endl;
+        result.failedProcesses = numberOfProcesses;
+        return result;
+    }
+    auto* state = new (sharedMemory) SharedStormState();
+
+    // the applications are forked before RouDi starts its threads, only a single threaded process can be forked safely
+    std::vector<pid_t> processes;
+    for (uint64_t process = 0U; process < numberOfProcesses; ++process)
+    {
+        const pid_t pid = fork();
+        if (pid == 0)
+        {
+            runApplication(*state, numberOfProcesses, process, config.domainId);
+            _exit(EXIT_SUCCESS);
+        }
+        if (pid < 0)
+        {
+            ++state->failedProcesses;
+            ++state->readyProcesses;
+            ++state->finishedProcesses;
+            continue;
+        }
+        processes.push_back(pid);
+    }
+
+    {
+        roudi::IceOryxRouDiComponents roudiComponents(config);
+        roudi::RouDi roudi(roudiComponents.rouDiMemoryManager, roudiComponents.portManager, config);
+
+        while (state->readyProcesses.load() < numberOfProcesses)
+        {
+            std::this_thread::yield();
+        }
+        const auto startTime = Clock_t::now();
+        state->start.store(true);
+        while (state->finishedProcesses.load() < numberOfProcesses)
+        {
+            std::this_thread::yield();
+        }
+        result.totalMilliseconds = std::chrono::duration<double, std::milli>(Clock_t::now() - startTime).count();
+
+        for (const auto pid : processes)
+        {
+            int status{0};
+            IOX_DISCARD_RESULT(waitpid(pid, &status, 0));
+        }
+    }
+
+    result.latenciesInMilliseconds.assign(state->latenciesInMilliseconds.begin(),
+                                          state->latenciesInMilliseconds.begin() + numberOfProcesses);
+    result.failedProcesses = state->failedProcesses.load();
+    state->~SharedStormState();
+    IOX_DISCARD_RESULT(munmap(sharedMemory, sizeof(SharedStormState)));
+
+    return result;
+}
+
+double percentile(const std::vector<double>& sortedValues, const uint64_t percent) noexcept
+{
+    const auto index = (sortedValues.size() - 1U) * percent / 100U;
+    return sortedValues[index];
+}
+
+void printResult(const uint32_t workerCount, StormResult& result) noexcept
+{
+    auto& latencies = result.latenciesInMilliseconds;
+    std::sort(latencies.begin(), latencies.end());
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(8) << workerCount << std::fixed << std::setprecision(2) << std::setw(10)
+              << percentile(latencies, 0U) << std::setw(10) << percentile(latencies, 50U) << std::setw(10)
+              << percentile(latencies, 90U) << std::setw(10) << percentile(latencies, 99U) << std::setw(10)
+              << percentile(latencies, 100U) << std::setw(12) << result.totalMilliseconds << std::setw(8)
+              << result.failedProcesses << std::endl;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    iox::log::Logger::init(iox::log::logLevelFromEnvOr(iox::log::LogLevel::Warn));
+
+    uint64_t numberOfProcesses{std::min<uint64_t>(DEFAULT_NUMBER_OF_PROCESSES, MAX_PROCESS_NUMBER)};
+    if (argc > 1)
+    {
+        auto maybeValue = convert::from_string<uint64_t>(argv[1]);
+        if (!maybeValue.has_value() || maybeValue.value() == 0U || maybeValue.value() > MAX_PROCESS_NUMBER)
+        {
+            std::cerr << "Usage: " << argv[0] << " [number of processes in the range of [1, " << MAX_PROCESS_NUMBER
+                      << "]]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        numberOfProcesses = maybeValue.value();
+    }
+
+    std::cout << numberOfProcesses << " processes register and create a publisher and a subscriber in parallel"
+              << std::endl;
+    std::cout << "latency per process in ms" << std::endl;
+    std::cout << std::setw(8) << "workers" << std::setw(10) << "min" << std::setw(10) << "median" << std::setw(10)
+              << "p90" << std::setw(10) << "p99" << std::setw(10) << "max" << std::setw(12) << "total" << std::setw(8)
+              << "failed" << std::endl;
+
+    for (const auto workerCount : WORKER_COUNTS)
+    {
+        auto result = runStorm(numberOfProcesses, workerCount);
+        printResult(workerCount, result);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -93,6 +93,19 @@ class MpmcLoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop multiple values from the free-list with a single compare-and-swap on the head
+    /// @param [out] indices pointer to a memory with space for at least 'maxNumberOfIndices' elements
+    /// @param [in] maxNumberOfIndices is the maximum number of indices to pop
+    /// @return the number of popped indices which were written to 'indices'; 0 if the free-list is empty
+    uint32_t popBatch(not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept;
+
+    /// Push multiple previously popped elements with a single compare-and-swap on the head
+    /// @param [in] indices pointer to the previously popped elements
+    /// @param [in] numberOfIndices is the number of elements in 'indices'
+    /// @return true if all indices are valid, not yet pushed and unique, false otherwise; in the latter case none of
+    ///         the indices is pushed
+    bool pushBatch(not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
@@ -111,5 +111,112 @@ bool MpmcLoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t MpmcLoFFLi::popBatch(not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    Index_t* const indexBuffer{indices};
+
+    if (maxNumberOfIndices == 0U || !m_nextFreeIndex)
+    {
+        return 0U;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0U};
+
+    do
+    {
+        /// walk along the free-list starting from the head; the values might be outdated when another thread
+        /// modifies the head concurrently but in this case the compare-and-swap fails due to the aba counter and
+        /// the walk is repeated
+        numberOfIndices = 0U;
+        Index_t current = oldHead.indexToNextFreeIndex;
+        while (numberOfIndices < maxNumberOfIndices && current < m_size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by caller
+            indexBuffer[numberOfIndices] = current;
+            ++numberOfIndices;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            current = m_nextFreeIndex.get()[current];
+        }
+
+        if (numberOfIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = current;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) both indices are limited as above
+        m_nextFreeIndex.get()[indexBuffer[i]] = m_invalidIndex;
+    }
+
+    /// same synchronization as in 'pop'
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
+bool MpmcLoFFLi::pushBatch(not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept
+{
+    const Index_t* const indexBuffer{indices};
+
+    if (numberOfIndices == 0U)
+    {
+        return true;
+    }
+
+    /// same synchronization as in 'push'
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (!m_nextFreeIndex)
+    {
+        return false;
+    }
+
+    auto* const nextFreeIndex = m_nextFreeIndex.get();
+
+    /// link the indices to a chain before publishing it with a single compare-and-swap; an index which is already
+    /// linked is either not acquired by pop or occurs twice in the batch, therefore the validation check of 'push'
+    /// also covers duplicates
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) indices are limited by capacity and the caller
+        const auto index = indexBuffer[i];
+        if (index >= m_size || nextFreeIndex[index] != m_invalidIndex)
+        {
+            for (uint32_t k = 0U; k < i; ++k)
+            {
+                nextFreeIndex[indexBuffer[k]] = m_invalidIndex;
+            }
+            return false;
+        }
+        nextFreeIndex[index] = (i + 1U < numberOfIndices) ? indexBuffer[i + 1U] : m_size;
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) checked above
+    const auto firstIndex = indexBuffer[0U];
+    const auto lastIndex = indexBuffer[numberOfIndices - 1U];
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        nextFreeIndex[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = firstIndex;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
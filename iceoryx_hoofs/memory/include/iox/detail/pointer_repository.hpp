@@ -18,6 +18,7 @@
 #ifndef IOX_HOOFS_MEMORY_POINTER_REPOSITORY_HPP
 #define IOX_HOOFS_MEMORY_POINTER_REPOSITORY_HPP
 
+#include "iox/atomic.hpp"
 #include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
@@ -36,7 +37,9 @@ class PointerRepository final
   private:
     struct Info
     {
-        ptr_t basePtr{nullptr};
+        /// @note atomic since segments which are registered on demand are registered while other threads resolve
+        /// relative pointers; the endPtr is written before the basePtr is published
+        concurrent::Atomic<ptr_t> basePtr{nullptr};
         ptr_t endPtr{nullptr};
     };
 
@@ -52,6 +55,10 @@ class PointerRepository final
     /// i.e. its corresponding base ptr is 0
     static constexpr id_t RAW_POINTER_BEHAVIOUR_ID{0};
 
+    /// @brief is called by getBasePtr with the id of a segment which is not registered; it can register the segment
+    /// on demand and returns its base pointer or nullptr if there is no segment with this id
+    using OnDemandRegistration_t = ptr_t (*)(const id_t id);
+
     /// @brief default constructor
     PointerRepository() noexcept;
     ~PointerRepository() noexcept = default;
@@ -85,9 +92,17 @@ class PointerRepository final
     /// @attention the relative pointers corresponding to this id become unsafe to use
     void unregisterAll() noexcept;
 
+    /// @brief sets the function which registers segments on demand when the base pointer of a valid but unregistered
+    /// id is requested
+    /// @param[in] onDemandRegistration is the function to call, nullptr disables the registration on demand
+    /// @note the function is called concurrently when relative pointers are resolved from multiple threads and must
+    /// synchronize the registration itself
+    void setOnDemandRegistration(const OnDemandRegistration_t onDemandRegistration) noexcept;
+
     /// @brief gets the base pointer, i.e. the starting address, associated with id
     /// @param[in] id is the segment id
-    /// @return the base pointer associated with the id
+    /// @return the base pointer associated with the id; if the id is not registered the segment is registered on
+    /// demand when a function for this was set
     ptr_t getBasePtr(const id_t id) const noexcept;
 
     /// @brief returns the id for a given pointer ptr
@@ -103,7 +118,8 @@ class PointerRepository final
     /// and each needs to initialize it via register calls above
 
     iox::vector<Info, CAPACITY> m_info;
-    uint64_t m_maxRegistered{0U};
+    concurrent::Atomic<uint64_t> m_maxRegistered{0U};
+    concurrent::Atomic<OnDemandRegistration_t> m_onDemandRegistration{nullptr};
 
     bool addPointerIfIdIsFree(const id_t id, const ptr_t ptr, const uint64_t size) noexcept;
 };
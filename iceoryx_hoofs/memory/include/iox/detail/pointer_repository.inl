@@ -60,9 +60,9 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(const id_t i
 {
     if ((id <= MAX_ID) && (id >= MIN_ID))
     {
-        if (m_info[id].basePtr != nullptr)
+        if (m_info[id].basePtr.load(std::memory_order_relaxed) != nullptr)
         {
-            m_info[id].basePtr = nullptr;
+            m_info[id].basePtr.store(nullptr, std::memory_order_release);
 
             /// @note do not search for next lower registered index but we could do it here
             return true;
@@ -77,9 +77,16 @@ inline void PointerRepository<id_t, ptr_t, CAPACITY>::unregisterAll() noexcept
 {
     for (auto& info : m_info)
     {
-        info.basePtr = nullptr;
+        info.basePtr.store(nullptr, std::memory_order_release);
     }
-    m_maxRegistered = 0U;
+    m_maxRegistered.store(0U, std::memory_order_relaxed);
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::setOnDemandRegistration(
+    const OnDemandRegistration_t onDemandRegistration) noexcept
+{
+    m_onDemandRegistration.store(onDemandRegistration, std::memory_order_release);
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -87,7 +94,16 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(const id_t id)
 {
     if ((id <= MAX_ID) && (id >= MIN_ID))
     {
-        return m_info[id].basePtr;
+        const auto basePtr = m_info[id].basePtr.load(std::memory_order_acquire);
+        if (basePtr == nullptr)
+        {
+            const auto onDemandRegistration = m_onDemandRegistration.load(std::memory_order_acquire);
+            if (onDemandRegistration != nullptr)
+            {
+                return onDemandRegistration(id);
+            }
+        }
+        return basePtr;
     }
 
     /// @note for id 0 nullptr is returned, meaning we will later interpret a relative pointer by casting the offset
@@ -100,11 +116,13 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(const id_t id)
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchId(const ptr_t ptr) const noexcept
 {
-    for (id_t id{1U}; id <= m_maxRegistered; ++id)
+    const auto maxRegistered = m_maxRegistered.load(std::memory_order_acquire);
+    for (id_t id{1U}; id <= maxRegistered; ++id)
     {
         // return first id where the ptr is in the corresponding interval
+        const auto basePtr = m_info[id].basePtr.load(std::memory_order_acquire);
         // AXIVION Next Construct AutosarC++19_03-M5.14.1 : False positive. vector::operator[](index) has no side-effect when index is less than vector size which is guaranteed by PointerRepository design
-        if ((ptr >= m_info[id].basePtr) && (ptr <= m_info[id].endPtr))
+        if ((basePtr != nullptr) && (ptr >= basePtr) && (ptr <= m_info[id].endPtr))
         {
             return id;
         }
@@ -118,18 +136,18 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::addPointerIfIdIsFree(const
                                                                            const ptr_t ptr,
                                                                            const uint64_t size) noexcept
 {
-    if (m_info[id].basePtr == nullptr)
+    if (m_info[id].basePtr.load(std::memory_order_relaxed) == nullptr)
     {
-        m_info[id].basePtr = ptr;
         // AXIVION Next Construct AutosarC++19_03-M5.2.9 : Used for pointer arithmetic with void pointer, uintptr_t is capable of holding a void ptr
         // AXIVION Next Construct AutosarC++19_03-A5.2.4 : Cast is needed for pointer arithmetic and casted back
         // to the original type
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
         m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + (size - 1U));
+        m_info[id].basePtr.store(ptr, std::memory_order_release);
 
-        if (id > m_maxRegistered)
+        if (id > m_maxRegistered.load(std::memory_order_relaxed))
         {
-            m_maxRegistered = id;
+            m_maxRegistered.store(id, std::memory_order_release);
         }
         return true;
     }
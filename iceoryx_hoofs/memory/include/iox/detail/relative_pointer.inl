@@ -176,6 +176,13 @@ inline void RelativePointer<T>::unregisterAll() noexcept
     getRepository().unregisterAll();
 }
 
+template <typename T>
+inline void RelativePointer<T>::setOnDemandRegistration(
+    const PointerRepository<segment_id_underlying_t, void*>::OnDemandRegistration_t onDemandRegistration) noexcept
+{
+    getRepository().setOnDemandRegistration(onDemandRegistration);
+}
+
 template <typename T>
 // NOLINTJUSTIFICATION NewType size is comparable to an integer, hence pass by value is preferred
 // NOLINTNEXTLINE(performance-unnecessary-value-param)
@@ -157,6 +157,13 @@ class RelativePointer final
     /// @brief Unregisters all ptr id pairs leading to initial state. This affects all pointer both typed and untyped.
     static void unregisterAll() noexcept;
 
+    /// @brief Sets the function which registers the segment of an id on demand when a pointer with an unregistered
+    /// id is resolved. This affects all pointer both typed and untyped.
+    /// @param[in] onDemandRegistration Is the function which registers the segment and returns its base pointer or
+    /// nullptr if there is no segment with the id; nullptr disables the registration on demand
+    static void setOnDemandRegistration(
+        const PointerRepository<segment_id_underlying_t, void*>::OnDemandRegistration_t onDemandRegistration) noexcept;
+
     /// @brief Get the offset from id and ptr
     /// @param[in] id Is the id of the segment and is used to get the base pointer
     /// @param[in] ptr Is the pointer whose offset should be calculated
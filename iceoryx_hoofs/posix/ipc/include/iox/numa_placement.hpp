@@ -0,0 +1,86 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_POSIX_IPC_NUMA_PLACEMENT_HPP
+#define IOX_HOOFS_POSIX_IPC_NUMA_PLACEMENT_HPP
+
+#include "iox/expected.hpp"
+#include "iox/log/logstream.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+enum class NumaPlacementError : uint8_t
+{
+    NOT_SUPPORTED,
+    INVALID_NODE,
+    PLACEMENT_FAILED,
+};
+
+/// @brief Describes on which NUMA node(s) the pages of a memory region shall be placed.
+struct NumaPlacement
+{
+    enum class Policy : uint8_t
+    {
+        /// @brief the placement is left to the default policy of the operating system, usually first touch
+        DEFAULT,
+        /// @brief all pages are placed on a single NUMA node
+        BIND,
+        /// @brief the pages are spread page by page over all NUMA nodes the process is allowed to use
+        INTERLEAVE,
+    };
+
+    /// @brief the memory is placed on the given NUMA node
+    static constexpr NumaPlacement bindToNode(const uint32_t node) noexcept
+    {
+        return NumaPlacement{Policy::BIND, node};
+    }
+
+    /// @brief the memory is interleaved over all available NUMA nodes
+    static constexpr NumaPlacement interleave() noexcept
+    {
+        return NumaPlacement{Policy::INTERLEAVE, 0U};
+    }
+
+    /// @brief Applies the placement to the pages of a memory region. Only the pages which lie completely within the
+    ///        region are affected. Pages which are already present are migrated. With the DEFAULT policy this is a
+    ///        no-op.
+    /// @param[in] memory the start of the memory region
+    /// @param[in] size the size of the memory region in bytes
+    /// @return an error if the placement could not be applied, e.g. when the platform does not support NUMA
+    expected<void, NumaPlacementError> apply(void* const memory, const uint64_t size) const noexcept;
+
+    /// @brief Acquires the NUMA node on which the page containing the address is placed. The page must be present.
+    /// @param[in] address the address to query
+    /// @return the NUMA node or an error if it could not be determined
+    static expected<uint32_t, NumaPlacementError> nodeOf(const void* const address) noexcept;
+
+    Policy policy{Policy::DEFAULT};
+    uint32_t node{0U};
+};
+
+bool operator==(const NumaPlacement& lhs, const NumaPlacement& rhs) noexcept;
+bool operator!=(const NumaPlacement& lhs, const NumaPlacement& rhs) noexcept;
+
+/// @brief Convenience stream operator to easily use the 'NumaPlacement' with the logger
+log::LogStream& operator<<(log::LogStream& stream, const NumaPlacement& value) noexcept;
+
+/// @brief Convenience stream operator to easily use the 'NumaPlacementError' with the logger
+log::LogStream& operator<<(log::LogStream& stream, const NumaPlacementError value) noexcept;
+} // namespace iox
+
+#endif // IOX_HOOFS_POSIX_IPC_NUMA_PLACEMENT_HPP
@@ -25,6 +25,7 @@
 #include "iox/detail/posix_shared_memory.hpp"
 #include "iox/file_management_interface.hpp"
 #include "iox/filesystem.hpp"
+#include "iox/numa_placement.hpp"
 #include "iox/optional.hpp"
 
 #include <cstdint>
@@ -78,10 +79,17 @@ class PosixSharedMemoryObject : public FileManagementInterface<PosixSharedMemory
     ///        existing shared memory was opened.
     bool hasOwnership() const noexcept;
 
+    /// @brief Returns the size of the pages which actually back the shared memory. This is the huge page
+    ///        size only when huge pages were requested and the memory which was touched on creation, e.g. by
+    ///        zeroing or prefaulting it, is entirely backed by huge pages, otherwise the system page size.
+    uint64_t getPageSize() const noexcept;
+
     friend class PosixSharedMemoryObjectBuilder;
 
   private:
-    PosixSharedMemoryObject(detail::PosixSharedMemory&& sharedMemory, detail::PosixMemoryMap&& memoryMap) noexcept;
+    PosixSharedMemoryObject(detail::PosixSharedMemory&& sharedMemory,
+                            detail::PosixMemoryMap&& memoryMap,
+                            const uint64_t pageSize) noexcept;
 
     friend struct FileManagementInterface<PosixSharedMemoryObject>;
     shm_handle_t get_file_handle() const noexcept;
@@ -89,6 +97,7 @@ class PosixSharedMemoryObject : public FileManagementInterface<PosixSharedMemory
   private:
     detail::PosixSharedMemory m_sharedMemory;
     detail::PosixMemoryMap m_memoryMap;
+    uint64_t m_pageSize{0U};
 };
 
 class PosixSharedMemoryObjectBuilder
@@ -117,6 +126,25 @@ class PosixSharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(access_rights, permissions, perms::none)
 
+    /// @brief If set to true the system is advised to back the shared memory with huge pages. When the
+    ///        shared memory is created, its size is rounded up to a multiple of the huge page size.
+    ///        If huge pages are not available the shared memory is backed by regular pages.
+    IOX_BUILDER_PARAMETER(bool, hugePages, false)
+
+    /// @brief If set to true every page of the shared memory is touched once right after it is mapped, so that
+    ///        the first access to the memory does not cause a page fault.
+    IOX_BUILDER_PARAMETER(bool, prefault, false)
+
+    /// @brief If set to true the shared memory is prefaulted and locked in RAM so that it cannot be paged out.
+    ///        If the memory cannot be locked, e.g. due to the RLIMIT_MEMLOCK of the process, a warning is logged
+    ///        and the memory remains unlocked.
+    IOX_BUILDER_PARAMETER(bool, lockMemory, false)
+
+    /// @brief Defines the NUMA placement of the shared memory. It is applied by the owner of the shared memory
+    ///        before the memory is touched for the first time. If the placement cannot be applied, e.g. since the
+    ///        platform does not support NUMA, a warning is logged and the memory is placed by the operating system.
+    IOX_BUILDER_PARAMETER(NumaPlacement, numaPlacement, NumaPlacement())
+
   public:
     expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> create() noexcept;
 };
@@ -0,0 +1,141 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/numa_placement.hpp"
+#include "iceoryx_platform/errno.hpp"
+#include "iceoryx_platform/mman.hpp"
+#include "iox/detail/system_configuration.hpp"
+#include "iox/logging.hpp"
+#include "iox/memory.hpp"
+#include "iox/posix_call.hpp"
+
+namespace iox
+{
+namespace
+{
+NumaPlacementError errnoToEnum(const int32_t errnum) noexcept
+{
+    switch (errnum)
+    {
+    case ENOSYS:
+        return NumaPlacementError::NOT_SUPPORTED;
+    case EINVAL:
+        return NumaPlacementError::INVALID_NODE;
+    default:
+        return NumaPlacementError::PLACEMENT_FAILED;
+    }
+}
+} // namespace
+
+expected<void, NumaPlacementError> NumaPlacement::apply(void* const memory, const uint64_t size) const noexcept
+{
+    if (policy == Policy::DEFAULT)
+    {
+        return ok();
+    }
+
+    // the placement is applied to whole pages, therefore the region is shrunk to the pages it fully covers
+    const uint64_t pageSize = detail::pageSize();
+    const auto start = reinterpret_cast<uint64_t>(memory);
+    const uint64_t alignedStart = align(start, pageSize);
+    const uint64_t end = start + size;
+    if (alignedStart >= end || end - alignedStart < pageSize)
+    {
+        return ok();
+    }
+    const uint64_t alignedSize = (end - alignedStart) - ((end - alignedStart) % pageSize);
+
+    // NOLINTJUSTIFICATION the address was computed from a pointer
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    auto* const alignedMemory = reinterpret_cast<void*>(alignedStart);
+    auto result = (policy == Policy::BIND)
+                      ? IOX_POSIX_CALL(iox_numa_bind_to_node)(alignedMemory, static_cast<size_t>(alignedSize), node)
+                            .failureReturnValue(-1)
+                            .suppressErrorMessagesForErrnos(ENOSYS, EINVAL)
+                            .evaluate()
+                      : IOX_POSIX_CALL(iox_numa_interleave)(alignedMemory, static_cast<size_t>(alignedSize))
+                            .failureReturnValue(-1)
+                            .suppressErrorMessagesForErrnos(ENOSYS)
+                            .evaluate();
+
+    if (result.has_error())
+    {
+        return err(errnoToEnum(result.error().errnum));
+    }
+
+    return ok();
+}
+
+expected<uint32_t, NumaPlacementError> NumaPlacement::nodeOf(const void* const address) noexcept
+{
+    auto result = IOX_POSIX_CALL(iox_numa_node_of_address)(address)
+                      .failureReturnValue(-1)
+                      .suppressErrorMessagesForErrnos(ENOSYS)
+                      .evaluate();
+
+    if (result.has_error())
+    {
+        return err(errnoToEnum(result.error().errnum));
+    }
+
+    return ok(static_cast<uint32_t>(result->value));
+}
+
+bool operator==(const NumaPlacement& lhs, const NumaPlacement& rhs) noexcept
+{
+    // the node is only relevant for the BIND policy
+    return lhs.policy == rhs.policy && (lhs.policy != NumaPlacement::Policy::BIND || lhs.node == rhs.node);
+}
+
+bool operator!=(const NumaPlacement& lhs, const NumaPlacement& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+log::LogStream& operator<<(log::LogStream& stream, const NumaPlacement& value) noexcept
+{
+    switch (value.policy)
+    {
+    case NumaPlacement::Policy::DEFAULT:
+        stream << "default";
+        break;
+    case NumaPlacement::Policy::BIND:
+        stream << "node " << value.node;
+        break;
+    case NumaPlacement::Policy::INTERLEAVE:
+        stream << "interleave";
+        break;
+    }
+    return stream;
+}
+
+log::LogStream& operator<<(log::LogStream& stream, const NumaPlacementError value) noexcept
+{
+    switch (value)
+    {
+    case NumaPlacementError::NOT_SUPPORTED:
+        stream << "NumaPlacementError::NOT_SUPPORTED";
+        break;
+    case NumaPlacementError::INVALID_NODE:
+        stream << "NumaPlacementError::INVALID_NODE";
+        break;
+    case NumaPlacementError::PLACEMENT_FAILED:
+        stream << "NumaPlacementError::PLACEMENT_FAILED";
+        break;
+    }
+    return stream;
+}
+} // namespace iox
@@ -17,10 +17,13 @@
 
 #include "iox/posix_shared_memory_object.hpp"
 #include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/mman.hpp"
 #include "iceoryx_platform/unistd.hpp"
 #include "iox/attributes.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/filesystem.hpp"
 #include "iox/logging.hpp"
+#include "iox/memory.hpp"
 #include "iox/signal_handler.hpp"
 
 #include <bitset>
@@ -50,6 +53,19 @@ static void memsetSigbusHandler(int) noexcept
     IOX_DISCARD_RESULT(result);
     _exit(EXIT_FAILURE);
 }
+
+static void prefaultPages(const void* memory, const uint64_t size, const uint64_t pageSize) noexcept
+{
+    // a read access is sufficient to establish the mapping of a page and works also for read only memory
+    const auto* bytes = static_cast<const volatile uint8_t*>(memory);
+    uint8_t accumulator{0U};
+    for (uint64_t offset = 0U; offset < size; offset += pageSize)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset is always smaller than size
+        accumulator = static_cast<uint8_t>(accumulator ^ bytes[offset]);
+    }
+    IOX_DISCARD_RESULT(accumulator);
+}
 } // namespace detail
 constexpr const void* const PosixSharedMemoryObject::NO_ADDRESS_HINT;
 
@@ -79,6 +95,18 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                     << ", permissions = " << iox::log::oct(m_permissions.value()) << " ]");
     };
 
+    const uint64_t hugePageSize = (m_hugePages) ? static_cast<uint64_t>(iox_shm_huge_page_size()) : 0U;
+    if (m_hugePages && hugePageSize == 0U)
+    {
+        IOX_LOG(Warn,
+                "Huge pages are not available for the shared memory [" << m_name
+                                                                       << "], falling back to regular pages.");
+    }
+    if (hugePageSize != 0U && m_openMode != OpenMode::OpenExisting)
+    {
+        m_memorySizeInBytes = align(m_memorySizeInBytes, hugePageSize);
+    }
+
     auto sharedMemory = detail::PosixSharedMemoryBuilder()
                             .name(m_name)
                             .accessMode(m_accessMode)
@@ -130,8 +158,32 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
         return err(PosixSharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED);
     }
 
+    bool hugePagesAdvised{false};
+    if (hugePageSize != 0U)
+    {
+        // the advice must be given before the memory is touched for the first time, e.g. by zeroing it
+        if (iox_shm_advise_huge_pages(memoryMap->getBaseAddress(), static_cast<size_t>(realSize)) == 0)
+        {
+            hugePagesAdvised = true;
+        }
+        else
+        {
+            IOX_LOG(Warn,
+                    "Unable to back the shared memory [" << m_name
+                                                         << "] with huge pages, falling back to regular pages.");
+        }
+    }
+
     if (sharedMemory->hasOwnership())
     {
+        // like the huge page advice, the placement must be applied before the memory is touched for the first time
+        m_numaPlacement.apply(memoryMap->getBaseAddress(), realSize).or_else([&](auto& error) {
+            IOX_LOG(Warn,
+                    "Unable to apply the NUMA placement '" << m_numaPlacement << "' to the shared memory [" << m_name
+                                                           << "] due to " << error
+                                                           << ", falling back to the default placement.");
+        });
+
         IOX_LOG(Debug, "Trying to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << m_name << "]");
         if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION)
         {
@@ -169,13 +221,48 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                 "Acquired " << m_memorySizeInBytes << " bytes successfully in the shared memory [" << m_name << "]");
     }
 
-    return ok(PosixSharedMemoryObject(std::move(*sharedMemory), std::move(*memoryMap)));
+    // the huge page advice is only a hint, therefore the memory is prefaulted with the system page size
+    uint64_t pageSize = detail::pageSize();
+    if (m_prefault || m_lockMemory)
+    {
+        detail::prefaultPages(memoryMap->getBaseAddress(), realSize, pageSize);
+    }
+
+    if (hugePagesAdvised)
+    {
+        const uint64_t mappedHugePageSize =
+            static_cast<uint64_t>(iox_shm_mapped_huge_page_size(memoryMap->getBaseAddress(), realSize));
+        const bool isMemoryTouched = (sharedMemory->hasOwnership() && platform::IOX_SHM_WRITE_ZEROS_ON_CREATION)
+                                     || m_prefault || m_lockMemory;
+        if (mappedHugePageSize != 0U)
+        {
+            pageSize = mappedHugePageSize;
+        }
+        else if (isMemoryTouched)
+        {
+            IOX_LOG(Warn,
+                    "The shared memory [" << m_name
+                                          << "] was advised to use huge pages but is backed by regular pages.");
+        }
+    }
+
+    if (m_lockMemory && iox_shm_lock(memoryMap->getBaseAddress(), static_cast<size_t>(realSize)) != 0)
+    {
+        IOX_LOG(Warn,
+                "Unable to lock the shared memory [" << m_name
+                                                     << "] in RAM, the memory is prefaulted but not locked. Consider "
+                                                        "raising RLIMIT_MEMLOCK.");
+    }
+
+    return ok(PosixSharedMemoryObject(std::move(*sharedMemory), std::move(*memoryMap), pageSize));
 }
 
 PosixSharedMemoryObject::PosixSharedMemoryObject(detail::PosixSharedMemory&& sharedMemory,
-                                                 detail::PosixMemoryMap&& memoryMap) noexcept
+                                                 detail::PosixMemoryMap&& memoryMap,
+                                                 const uint64_t pageSize) noexcept
     : m_sharedMemory(std::move(sharedMemory))
     , m_memoryMap(std::move(memoryMap))
+    , m_pageSize(pageSize)
 {
 }
 
@@ -203,4 +290,9 @@ bool PosixSharedMemoryObject::hasOwnership() const noexcept
 {
     return m_sharedMemory.hasOwnership();
 }
+
+uint64_t PosixSharedMemoryObject::getPageSize() const noexcept
+{
+    return m_pageSize;
+}
 } // namespace iox
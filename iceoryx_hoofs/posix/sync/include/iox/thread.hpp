@@ -42,9 +42,26 @@ enum class ThreadError : uint8_t
     INSUFFICIENT_PERMISSIONS,
     INSUFFICIENT_RESOURCES,
     INVALID_ATTRIBUTES,
+    NOT_SUPPORTED,
     UNDEFINED
 };
 
+/// @brief The CPU placement and the scheduling policy of a thread. The default values keep what the thread inherits
+/// from the thread which created it.
+struct ThreadSchedulingOptions
+{
+    /// @brief bit n allows the thread to run on CPU n; zero keeps the inherited CPU affinity
+    uint64_t cpuAffinityMask{0U};
+    /// @brief a value greater than zero runs the thread with the FIFO real-time scheduler at this priority
+    int32_t fifoPriority{0};
+};
+
+/// @todo iox-#1365 remove free functions
+/// @brief Applies the scheduling options to the calling thread; the reason of a failure is logged
+/// @param[in] options the CPU affinity and the scheduling policy of the thread
+/// @return an error if one of the options could not be applied
+expected<void, ThreadError> setThreadSchedulingOptions(const ThreadSchedulingOptions& options) noexcept;
+
 /// @brief POSIX thread wrapper class. Following RAII, the thread is joined on destruction.
 /// @code
 /// #include "iox/thread.hpp"
@@ -74,9 +91,12 @@ class Thread
 
     friend class ThreadBuilder;
     friend class optional<Thread>;
+    friend expected<void, ThreadError> setThreadSchedulingOptions(const ThreadSchedulingOptions& options) noexcept;
 
   private:
-    Thread(const ThreadName_t& name, const callable_t& callable) noexcept;
+    Thread(const ThreadName_t& name,
+           const ThreadSchedulingOptions& schedulingOptions,
+           const callable_t& callable) noexcept;
 
     static ThreadError errnoToEnum(const int errnoValue) noexcept;
 
@@ -86,6 +106,7 @@ class Thread
     callable_t m_callable;
     bool m_isThreadConstructed{false};
     ThreadName_t m_threadName;
+    ThreadSchedulingOptions m_schedulingOptions;
 };
 
 class ThreadBuilder
@@ -93,6 +114,9 @@ class ThreadBuilder
     /// @brief Set the name of the thread
     IOX_BUILDER_PARAMETER(ThreadName_t, name, "")
 
+    /// @brief Set the CPU affinity and the scheduling policy which the thread applies to itself when it starts
+    IOX_BUILDER_PARAMETER(ThreadSchedulingOptions, scheduling_options, ThreadSchedulingOptions())
+
   public:
     /// @brief Creates a thread
     /// @param[in] uninitializedThread is an iox::optional where the thread is stored
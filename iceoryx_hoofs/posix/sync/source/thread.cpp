@@ -16,6 +16,7 @@
 
 #include "iox/thread.hpp"
 #include "iox/assertions.hpp"
+#include "iox/detail/posix_scheduler.hpp"
 #include "iox/logging.hpp"
 #include "iox/posix_call.hpp"
 
@@ -55,10 +56,57 @@ ThreadName_t getThreadName() noexcept
     return ThreadName_t(TruncateToCapacity, &tempName[0]);
 }
 
+expected<void, ThreadError> setThreadSchedulingOptions(const ThreadSchedulingOptions& options) noexcept
+{
+    auto threadHandle = iox_pthread_self();
+    optional<ThreadError> error;
+
+    if (options.cpuAffinityMask != 0U)
+    {
+        IOX_POSIX_CALL(iox_pthread_setaffinity_np)
+        (threadHandle, options.cpuAffinityMask).returnValueMatchesErrno().evaluate().or_else([&](auto& r) {
+            IOX_LOG(Warn,
+                    "Failed to set the CPU affinity mask " << iox::log::hex(options.cpuAffinityMask)
+                                                           << "! error: " << r.getHumanReadableErrnum());
+            error = Thread::errnoToEnum(r.errnum);
+        });
+    }
+
+    if (options.fifoPriority > 0)
+    {
+        const auto minimumPriority = detail::getSchedulerPriorityMinimum(detail::Scheduler::FIFO);
+        const auto maximumPriority = detail::getSchedulerPriorityMaximum(detail::Scheduler::FIFO);
+        if (options.fifoPriority < minimumPriority || options.fifoPriority > maximumPriority)
+        {
+            IOX_LOG(Warn,
+                    "The FIFO priority " << options.fifoPriority << " is outside of the valid range ["
+                                         << minimumPriority << ", " << maximumPriority << "]!");
+            return err(ThreadError::INVALID_ATTRIBUTES);
+        }
+
+        IOX_POSIX_CALL(iox_pthread_setschedparam)
+        (threadHandle, static_cast<int>(detail::Scheduler::FIFO), options.fifoPriority)
+            .returnValueMatchesErrno()
+            .evaluate()
+            .or_else([&](auto& r) {
+                IOX_LOG(Warn,
+                        "Failed to set the FIFO priority " << options.fifoPriority
+                                                           << "! error: " << r.getHumanReadableErrnum());
+                error = Thread::errnoToEnum(r.errnum);
+            });
+    }
+
+    if (error.has_value())
+    {
+        return err(error.value());
+    }
+    return ok();
+}
+
 expected<void, ThreadError> ThreadBuilder::create(optional<Thread>& uninitializedThread,
                                                   const Thread::callable_t& callable) noexcept
 {
-    uninitializedThread.emplace(m_name, callable);
+    uninitializedThread.emplace(m_name, m_scheduling_options, callable);
 
     const iox_pthread_attr_t* threadAttributes = nullptr;
 
@@ -77,10 +125,13 @@ expected<void, ThreadError> ThreadBuilder::create(optional<Thread>& uninitialize
     return ok();
 }
 
-Thread::Thread(const ThreadName_t& name, const callable_t& callable) noexcept
+Thread::Thread(const ThreadName_t& name,
+               const ThreadSchedulingOptions& schedulingOptions,
+               const callable_t& callable) noexcept
     : m_threadHandle{}
     , m_callable{callable}
     , m_threadName{name}
+    , m_schedulingOptions{schedulingOptions}
 {
 }
 
@@ -127,6 +178,9 @@ ThreadError Thread::errnoToEnum(const int errnoValue) noexcept
     case EPERM:
         IOX_LOG(Error, "no appropriate permission to set required scheduling policy or parameters");
         return ThreadError::INSUFFICIENT_PERMISSIONS;
+    case ENOSYS:
+        IOX_LOG(Error, "the requested scheduling option is not supported on this platform");
+        return ThreadError::NOT_SUPPORTED;
     default:
         IOX_LOG(Error, "an unexpected error occurred in thread - this should never happen!");
         return ThreadError::UNDEFINED;
@@ -142,6 +196,9 @@ void* Thread::startRoutine(void* callable)
         self->m_threadName.clear();
     }
 
+    // a failure is already logged and the thread runs with the inherited settings
+    IOX_DISCARD_RESULT(setThreadSchedulingOptions(self->m_schedulingOptions));
+
     self->m_callable();
     return nullptr;
 }
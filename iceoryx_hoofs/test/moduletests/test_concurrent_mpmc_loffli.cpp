@@ -221,4 +221,81 @@ TEST_F(MpmcLoFFLi_test, PushToUninitializedLoFFLi)
     MpmcLoFFLi loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TEST_F(MpmcLoFFLi_test, PopBatchReturnsIndicesInPopOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "266807e7-b2e0-4ae4-a5d6-fba4bb97eabb");
+    std::vector<uint32_t> indices(CAPACITY, 0U);
+
+    EXPECT_THAT(this->m_loffli.popBatch(indices.data(), CAPACITY - 1U), Eq(CAPACITY - 1U));
+    for (uint32_t i = 0; i < CAPACITY - 1U; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(CAPACITY - 1U));
+}
+
+TEST_F(MpmcLoFFLi_test, PopBatchIsLimitedByAvailableIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "85aaad6f-9419-4313-846e-eb7a2f34f3dc");
+    std::vector<uint32_t> indices(CAPACITY * 2U, 0U);
+
+    EXPECT_THAT(this->m_loffli.popBatch(indices.data(), CAPACITY * 2U), Eq(CAPACITY));
+    EXPECT_THAT(this->m_loffli.popBatch(indices.data(), CAPACITY * 2U), Eq(0U));
+}
+
+TEST_F(MpmcLoFFLi_test, PopBatchFromUninitializedLoFFLi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3129965-d77b-4803-a530-2fc6c68ec7ce");
+    std::vector<uint32_t> indices(CAPACITY, 0U);
+
+    MpmcLoFFLi loFFLi;
+    EXPECT_THAT(loFFLi.popBatch(indices.data(), CAPACITY), Eq(0U));
+}
+
+TEST_F(MpmcLoFFLi_test, PushBatchMakesIndicesAvailableAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "41c21018-ffce-43d9-96c0-cad021f4f6f3");
+    std::vector<uint32_t> indices(CAPACITY, 0U);
+    ASSERT_THAT(this->m_loffli.popBatch(indices.data(), CAPACITY), Eq(CAPACITY));
+
+    EXPECT_THAT(this->m_loffli.pushBatch(indices.data(), CAPACITY), Eq(true));
+
+    std::vector<uint32_t> useListPoped;
+    uint32_t index{0};
+    while (this->m_loffli.pop(index))
+    {
+        useListPoped.push_back(index);
+    }
+    std::sort(useListPoped.begin(), useListPoped.end());
+    EXPECT_THAT(useListPoped, Eq(indices));
+}
+
+TEST_F(MpmcLoFFLi_test, PushBatchWithDuplicateIndexFailsAndPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fcffb367-17e8-4421-a0e3-39a8933dd8df");
+    std::vector<uint32_t> indices(CAPACITY, 0U);
+    ASSERT_THAT(this->m_loffli.popBatch(indices.data(), CAPACITY), Eq(CAPACITY));
+
+    std::vector<uint32_t> indicesWithDuplicate{indices[0], indices[1], indices[0]};
+    EXPECT_THAT(this->m_loffli.pushBatch(indicesWithDuplicate.data(), 3U), Eq(false));
+
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+    EXPECT_THAT(this->m_loffli.pushBatch(indices.data(), CAPACITY), Eq(true));
+}
+
+TEST_F(MpmcLoFFLi_test, PushBatchWithIndexWhichWasNotPoppedFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "06f70818-9e96-445c-9819-ea13368a2e64");
+    std::vector<uint32_t> indices(2U, 0U);
+    ASSERT_THAT(this->m_loffli.popBatch(indices.data(), 1U), Eq(1U));
+    indices[1] = indices[0] + 1U;
+
+    EXPECT_THAT(this->m_loffli.pushBatch(indices.data(), 2U), Eq(false));
+    EXPECT_THAT(this->m_loffli.push(indices[0]), Eq(true));
+}
 } // namespace
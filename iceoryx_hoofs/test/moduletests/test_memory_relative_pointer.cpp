@@ -30,6 +30,23 @@ constexpr uint64_t SHARED_MEMORY_SIZE = 4096UL * 32UL;
 constexpr uint64_t NUMBER_OF_MEMORY_PARTITIONS = 2U;
 uint8_t memoryPatternValue = 1U;
 
+// NOLINTJUSTIFICATION the on demand registration is a plain function and needs a global state for the tests
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+void* onDemandSegment{nullptr};
+uint64_t onDemandRegistrationCalls{0U};
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+void* registerOnDemand(const segment_id_underlying_t id)
+{
+    ++onDemandRegistrationCalls;
+    if (onDemandSegment == nullptr)
+    {
+        return nullptr;
+    }
+    UntypedRelativePointer::registerPtrWithId(segment_id_t{id}, onDemandSegment, SHARED_MEMORY_SIZE);
+    return onDemandSegment;
+}
+
 template <typename T>
 class RelativePointer_test : public Test
 {
@@ -43,7 +60,10 @@ class RelativePointer_test : public Test
 
     void TearDown() override
     {
+        UntypedRelativePointer::setOnDemandRegistration(nullptr);
         UntypedRelativePointer::unregisterAll();
+        onDemandSegment = nullptr;
+        onDemandRegistrationCalls = 0U;
     }
 
     uint8_t* partitionPtr(uint32_t partition)
@@ -485,6 +505,46 @@ TYPED_TEST(RelativePointer_test, DefaultConstructedRelativePtrIsNull)
     EXPECT_FALSE(rp2);
 }
 
+TYPED_TEST(RelativePointer_test, ResolvingUnregisteredIdRegistersTheSegmentOnDemand)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "67bff1ec-5fa7-4a6b-b1f6-b590031c7fc0");
+    auto* typedPtr = reinterpret_cast<TypeParam*>(this->partitionPtr(0U));
+    constexpr typename RelativePointer<TypeParam>::offset_t OFFSET{64U};
+    onDemandSegment = typedPtr;
+    UntypedRelativePointer::setOnDemandRegistration(registerOnDemand);
+
+    RelativePointer<TypeParam> rp(OFFSET, segment_id_t{13U});
+
+    EXPECT_EQ(rp.get(), reinterpret_cast<TypeParam*>(this->partitionPtr(0U) + OFFSET));
+    EXPECT_EQ(rp.get(), reinterpret_cast<TypeParam*>(this->partitionPtr(0U) + OFFSET));
+    EXPECT_EQ(UntypedRelativePointer::getBasePtr(segment_id_t{13U}), typedPtr);
+    EXPECT_EQ(onDemandRegistrationCalls, 1U);
+}
+
+TYPED_TEST(RelativePointer_test, OnDemandRegistrationIsNotCalledForRegisteredIds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ba8246e-371e-4cc2-bc07-fdd01baf6b84");
+    auto* typedPtr = reinterpret_cast<TypeParam*>(this->partitionPtr(1U));
+    onDemandSegment = this->partitionPtr(0U);
+    UntypedRelativePointer::setOnDemandRegistration(registerOnDemand);
+    ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(segment_id_t{2U}, typedPtr, SHARED_MEMORY_SIZE));
+
+    RelativePointer<TypeParam> rp(typedPtr, segment_id_t{2U});
+
+    EXPECT_EQ(rp.get(), typedPtr);
+    EXPECT_EQ(onDemandRegistrationCalls, 0U);
+}
+
+TYPED_TEST(RelativePointer_test, OnDemandRegistrationWithoutSegmentKeepsIdUnregistered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "de4a19e9-0c19-4252-9fd4-aadecd95239b");
+    UntypedRelativePointer::setOnDemandRegistration(registerOnDemand);
+
+    EXPECT_EQ(RelativePointer<TypeParam>::getBasePtr(segment_id_t{3U}), nullptr);
+    EXPECT_EQ(RelativePointer<TypeParam>::getBasePtr(segment_id_t{3U}), nullptr);
+    EXPECT_EQ(onDemandRegistrationCalls, 2U);
+}
+
 // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
 
 } // namespace
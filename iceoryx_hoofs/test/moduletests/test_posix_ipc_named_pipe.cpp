@@ -0,0 +1,107 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/named_pipe.hpp"
+#include "iox/string.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+
+using message_t = NamedPipe::Message_t;
+
+/// @brief This test suite verifies the receive functionality of the NamedPipe with an iox::string which is not
+/// covered by the IPC channel tests of posh
+class NamedPipe_test : public Test
+{
+  public:
+    static NamedPipe createPipe(const PosixIpcChannelSide side)
+    {
+        return NamedPipeBuilder()
+            .name(PIPE_NAME)
+            .channelSide(side)
+            .maxMsgNumber(MAX_NUMBER_OF_MESSAGES)
+            .create()
+            .expect("Creating the named pipe should not fail");
+    }
+
+    static constexpr uint64_t MAX_NUMBER_OF_MESSAGES{2U};
+    static const PosixIpcChannelName_t PIPE_NAME;
+
+    NamedPipe server{createPipe(PosixIpcChannelSide::SERVER)};
+    NamedPipe client{createPipe(PosixIpcChannelSide::CLIENT)};
+};
+
+const PosixIpcChannelName_t NamedPipe_test::PIPE_NAME{"iox_named_pipe_test"};
+
+TEST_F(NamedPipe_test, TryReceiveOfSentMessageSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "440bface-0fa9-4d7d-be52-03aa225c203b");
+    const message_t sentMessage{"a stunning message"};
+    ASSERT_FALSE(client.send(sentMessage).has_error());
+
+    message_t receivedMessage;
+    const auto result = server.tryReceive(receivedMessage);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(receivedMessage, Eq(sentMessage));
+}
+
+TEST_F(NamedPipe_test, TryReceiveOnEmptyPipeReturnsTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "004f35c1-987c-4f24-bf82-ad8a50e1e913");
+    message_t receivedMessage;
+    const auto result = server.tryReceive(receivedMessage);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(PosixIpcChannelError::TIMEOUT));
+}
+
+TEST_F(NamedPipe_test, TryReceiveReturnsTheMessagesInTheOrderTheyWereSent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b644ccb-9861-4c8f-963c-b4209cfc6a63");
+    const message_t firstMessage{"first"};
+    const message_t secondMessage{"second"};
+    ASSERT_FALSE(client.send(firstMessage).has_error());
+    ASSERT_FALSE(client.send(secondMessage).has_error());
+
+    message_t receivedMessage;
+    ASSERT_FALSE(server.tryReceive(receivedMessage).has_error());
+    EXPECT_THAT(receivedMessage, Eq(firstMessage));
+    ASSERT_FALSE(server.tryReceive(receivedMessage).has_error());
+    EXPECT_THAT(receivedMessage, Eq(secondMessage));
+
+    const auto result = server.tryReceive(receivedMessage);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(PosixIpcChannelError::TIMEOUT));
+}
+
+TEST_F(NamedPipe_test, TryReceiveAfterTimedSendSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "05ccec34-b51b-4422-ab49-f4e17eda281c");
+    const message_t sentMessage{"just in time"};
+    ASSERT_FALSE(client.timedSend(sentMessage, units::Duration::fromMilliseconds(10)).has_error());
+
+    message_t receivedMessage;
+    const auto result = server.tryReceive(receivedMessage);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(receivedMessage, Eq(sentMessage));
+}
+} // namespace
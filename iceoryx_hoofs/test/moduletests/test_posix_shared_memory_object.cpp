@@ -15,6 +15,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iox/detail/system_configuration.hpp"
 #include "iox/memory.hpp"
 #include "iox/posix_group.hpp"
 #include "iox/posix_shared_memory_object.hpp"
@@ -163,6 +164,189 @@ TEST_F(SharedMemoryObject_Test, OpenSutMapsAllMemoryIntoProcess)
     }
 }
 
+TEST_F(SharedMemoryObject_Test, SharedMemoryWithoutHugePagesIsBackedBySystemPages)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "90bde519-90f6-436c-93f1-73ba1ef9a02f");
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmRegularPages")
+                   .memorySizeInBytes(100)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .create()
+                   .expect("failed to create sut");
+
+    EXPECT_THAT(sut.getPageSize(), Eq(iox::detail::pageSize()));
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryWithHugePagesIsCreatedEvenWhenHugePagesAreNotAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cb67d609-4d47-47b7-8818-623d09402c0d");
+    const uint64_t MEMORY_SIZE = 100;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmHugePages")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .hugePages(true)
+                   .create()
+                   .expect("failed to create sut");
+
+    const auto pageSize = sut.getPageSize();
+    EXPECT_THAT(pageSize, Ge(iox::detail::pageSize()));
+
+    auto size = sut.get_size();
+    ASSERT_FALSE(size.has_error());
+    EXPECT_THAT(*size, Ge(MEMORY_SIZE));
+    if (pageSize != iox::detail::pageSize())
+    {
+        EXPECT_THAT(*size % pageSize, Eq(0U));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryWithHugePagesMapsTheWholeMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "77b6c245-e95e-487a-b687-c24b23761975");
+    const uint64_t MEMORY_SIZE = 100;
+    auto creator = PosixSharedMemoryObjectBuilder()
+                       .name("shmHugePages")
+                       .memorySizeInBytes(MEMORY_SIZE)
+                       .accessMode(iox::AccessMode::ReadWrite)
+                       .openMode(iox::OpenMode::PurgeAndCreate)
+                       .hugePages(true)
+                       .create()
+                       .expect("failed to create sut");
+    auto creatorSize = creator.get_size().expect("failed to acquire size");
+
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmHugePages")
+                   .memorySizeInBytes(creatorSize)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::OpenExisting)
+                   .hugePages(true)
+                   .prefault(true)
+                   .create()
+                   .expect("failed to open sut");
+
+    EXPECT_THAT(sut.get_size().expect("failed to acquire size"), Eq(creatorSize));
+    EXPECT_THAT(sut.getPageSize(), Eq(creator.getPageSize()));
+
+    auto* lastByte = static_cast<uint8_t*>(creator.getBaseAddress()) + creatorSize - 1U;
+    *lastByte = 42U;
+    EXPECT_THAT(*(static_cast<uint8_t*>(sut.getBaseAddress()) + creatorSize - 1U), Eq(42U));
+}
+
+TEST_F(SharedMemoryObject_Test, OpeningPrefaultedReadOnlySharedMemoryPreservesContent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dec6809f-ee21-480d-bcc6-9a02941bb6d0");
+    const uint64_t MEMORY_SIZE = 4U * iox::detail::pageSize();
+    auto creator = PosixSharedMemoryObjectBuilder()
+                       .name("shmPrefault")
+                       .memorySizeInBytes(MEMORY_SIZE)
+                       .accessMode(iox::AccessMode::ReadWrite)
+                       .openMode(iox::OpenMode::PurgeAndCreate)
+                       .permissions(perms::owner_all)
+                       .prefault(true)
+                       .create()
+                       .expect("failed to create sut");
+
+    auto* lastByte = static_cast<uint8_t*>(creator.getBaseAddress()) + MEMORY_SIZE - 1U;
+    *lastByte = 73U;
+
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmPrefault")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::ReadOnly)
+                   .openMode(iox::OpenMode::OpenExisting)
+                   .prefault(true)
+                   .create()
+                   .expect("failed to open sut");
+
+    EXPECT_THAT(*(static_cast<const uint8_t*>(sut.getBaseAddress()) + MEMORY_SIZE - 1U), Eq(73U));
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryWithLockedMemoryIsCreatedEvenWhenLockingIsNotPossible)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "32637ae8-b5ce-4109-94dc-3b74cbf6a043");
+    const uint64_t MEMORY_SIZE = 100;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmLocked")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .lockMemory(true)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* firstByte = static_cast<uint8_t*>(sut.getBaseAddress());
+    *firstByte = 37U;
+    EXPECT_THAT(*firstByte, Eq(37U));
+    EXPECT_THAT(sut.get_size().expect("failed to acquire size"), Ge(MEMORY_SIZE));
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryIsCreatedEvenWhenTheNumaPlacementCannotBeApplied)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f8b34d89-9e17-41cf-beac-4c8fd5316fd5");
+    // there is no system with that many NUMA nodes, therefore the placement must fail
+    constexpr uint32_t NON_EXISTING_NUMA_NODE{100000U};
+    const uint64_t MEMORY_SIZE = 4U * iox::detail::pageSize();
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNuma")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .numaPlacement(NumaPlacement::bindToNode(NON_EXISTING_NUMA_NODE))
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* lastByte = static_cast<uint8_t*>(sut.getBaseAddress()) + MEMORY_SIZE - 1U;
+    *lastByte = 13U;
+    EXPECT_THAT(*lastByte, Eq(13U));
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryBoundToTheNodeOfItsDefaultPlacementIsPlacedOnThatNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cb68d5cb-565e-4702-ab1d-25bcac474ea4");
+    const uint64_t MEMORY_SIZE = 4U * iox::detail::pageSize();
+    auto reference = PosixSharedMemoryObjectBuilder()
+                         .name("shmNumaReference")
+                         .memorySizeInBytes(MEMORY_SIZE)
+                         .accessMode(iox::AccessMode::ReadWrite)
+                         .openMode(iox::OpenMode::PurgeAndCreate)
+                         .create()
+                         .expect("failed to create reference");
+    *static_cast<uint8_t*>(reference.getBaseAddress()) = 1U;
+
+    auto node = NumaPlacement::nodeOf(reference.getBaseAddress());
+    if (node.has_error())
+    {
+        GTEST_SKIP() << "The platform does not support NUMA";
+    }
+
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNuma")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .numaPlacement(NumaPlacement::bindToNode(*node))
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* lastByte = static_cast<uint8_t*>(sut.getBaseAddress()) + MEMORY_SIZE - 1U;
+    *lastByte = 1U;
+    auto sutNode = NumaPlacement::nodeOf(lastByte);
+    ASSERT_FALSE(sutNode.has_error());
+    EXPECT_THAT(*sutNode, Eq(*node));
+}
+
+TEST_F(SharedMemoryObject_Test, ApplyingTheDefaultNumaPlacementAlwaysSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "913472cb-e7d1-47bd-b7e0-de3cc74e5f8f");
+    constexpr uint64_t MEMORY_SIZE{64U};
+    alignas(8) uint8_t memory[MEMORY_SIZE];
+
+    EXPECT_FALSE(NumaPlacement().apply(&memory[0], MEMORY_SIZE).has_error());
+}
+
 #if !defined(_WIN32) && !defined(__APPLE__)
 TEST_F(SharedMemoryObject_Test, AcquiringOwnerWorks)
 {
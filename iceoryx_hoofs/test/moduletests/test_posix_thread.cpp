@@ -15,12 +15,17 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/testing/barrier.hpp"
+#include "iox/detail/posix_scheduler.hpp"
 #include "iox/duration.hpp"
 #include "iox/thread.hpp"
 #include "test.hpp"
 
 #include <thread>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 namespace
 {
 using namespace ::testing;
@@ -113,4 +118,68 @@ TEST_F(Thread_test, SetAndGetSmallStringIsWorking)
 
     EXPECT_THAT(getResult.c_str(), StrEq(stringShorterThanThreadNameCapacitiy.c_str()));
 }
+
+TEST_F(Thread_test, ApplyingDefaultSchedulingOptionsSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "19cb0f3a-46ab-4a68-b152-6f3a8274bec0");
+    bool hasError = true;
+    ASSERT_FALSE(
+        ThreadBuilder()
+            .create(sut, [&] { hasError = setThreadSchedulingOptions(ThreadSchedulingOptions()).has_error(); })
+            .has_error());
+    sut.reset();
+
+    EXPECT_FALSE(hasError);
+}
+
+TEST_F(Thread_test, ApplyingFifoPriorityAboveMaximumFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e77081b9-38ad-46dc-b9a0-885e6f2375af");
+    ThreadSchedulingOptions options;
+    options.fifoPriority = detail::getSchedulerPriorityMaximum(detail::Scheduler::FIFO) + 1;
+
+    optional<ThreadError> error;
+    ASSERT_FALSE(ThreadBuilder()
+                     .create(sut,
+                             [&] {
+                                 setThreadSchedulingOptions(options).or_else(
+                                     [&](auto& threadError) { error = threadError; });
+                             })
+                     .has_error());
+    sut.reset();
+
+    ASSERT_TRUE(error.has_value());
+    EXPECT_THAT(error.value(), Eq(ThreadError::INVALID_ATTRIBUTES));
+}
+
+#if defined(__linux__)
+TEST_F(Thread_test, ThreadIsPinnedToTheCpuOfTheSchedulingOptions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aaacb280-802b-41ae-98c6-12ed8966221a");
+    constexpr uint64_t NUMBER_OF_ADDRESSABLE_CPUS{64U};
+    cpu_set_t allowedCpus;
+    CPU_ZERO(&allowedCpus);
+    ASSERT_THAT(sched_getaffinity(0, sizeof(allowedCpus), &allowedCpus), Eq(0));
+    uint64_t cpu = 0U;
+    while (cpu < NUMBER_OF_ADDRESSABLE_CPUS && !CPU_ISSET(cpu, &allowedCpus))
+    {
+        ++cpu;
+    }
+    ASSERT_THAT(cpu, Lt(NUMBER_OF_ADDRESSABLE_CPUS));
+
+    ThreadSchedulingOptions options;
+    options.cpuAffinityMask = uint64_t{1U} << cpu;
+    cpu_set_t cpusOfThread;
+    CPU_ZERO(&cpusOfThread);
+    ASSERT_FALSE(
+        ThreadBuilder()
+            .scheduling_options(options)
+            .create(sut, [&] { EXPECT_THAT(sched_getaffinity(0, sizeof(cpusOfThread), &cpusOfThread), Eq(0)); })
+            .has_error());
+    sut.reset();
+
+    EXPECT_THAT(CPU_COUNT(&cpusOfThread), Eq(1));
+    EXPECT_TRUE(CPU_ISSET(cpu, &cpusOfThread));
+}
+#endif
 } // namespace
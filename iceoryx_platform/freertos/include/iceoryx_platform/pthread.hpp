@@ -22,6 +22,8 @@
 #include "iceoryx_platform/fcntl.hpp"
 #include "iceoryx_platform/types.hpp"
 
+#include <cerrno>
+#include <cstdint>
 #include <sched.h>
 
 #include "FreeRTOS.h"
@@ -148,4 +150,16 @@ inline iox_pthread_t iox_pthread_self()
     return {};
 }
 
+/// @note pinning a thread to CPUs is not supported on this platform
+inline int iox_pthread_setaffinity_np(iox_pthread_t, uint64_t)
+{
+    return ENOSYS;
+}
+
+/// @note changing the scheduling policy of a thread is not supported on this platform
+inline int iox_pthread_setschedparam(iox_pthread_t, int, int)
+{
+    return ENOSYS;
+}
+
 #endif // IOX_HOOFS_FREERTOS_PLATFORM_PTHREAD_HPP
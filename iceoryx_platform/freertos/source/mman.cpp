@@ -86,3 +86,43 @@ int munmap(void*, size_t)
 {
     return 0;
 }
+
+size_t iox_shm_huge_page_size(void)
+{
+    return 0U;
+}
+
+int iox_shm_advise_huge_pages(void*, size_t)
+{
+    FreeRTOS_errno = EINVAL;
+    return -1;
+}
+
+size_t iox_shm_mapped_huge_page_size(const void*, size_t)
+{
+    return 0U;
+}
+
+int iox_shm_lock(void*, size_t)
+{
+    // there is no paging on FreeRTOS, the memory is always resident
+    return 0;
+}
+
+int iox_numa_bind_to_node(void*, size_t, unsigned int)
+{
+    FreeRTOS_errno = EINVAL;
+    return -1;
+}
+
+int iox_numa_interleave(void*, size_t)
+{
+    FreeRTOS_errno = EINVAL;
+    return -1;
+}
+
+int iox_numa_node_of_address(const void*)
+{
+    FreeRTOS_errno = EINVAL;
+    return -1;
+}
@@ -17,6 +17,7 @@
 #ifndef IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
 
+#include <cstdint>
 #include <pthread.h>
 
 #define IOX_PTHREAD_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
@@ -131,4 +132,27 @@ inline iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+/// @brief pins the thread to the CPUs whose bits are set in the mask; only the first 64 CPUs can be addressed
+inline int iox_pthread_setaffinity_np(iox_pthread_t thread, uint64_t cpuMask)
+{
+    constexpr uint64_t NUMBER_OF_ADDRESSABLE_CPUS{64U};
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (uint64_t cpu = 0U; cpu < NUMBER_OF_ADDRESSABLE_CPUS; ++cpu)
+    {
+        if (((cpuMask >> cpu) & 1U) == 1U)
+        {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    return pthread_setaffinity_np(thread, sizeof(cpuSet), &cpuSet);
+}
+
+inline int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority)
+{
+    sched_param param{};
+    param.sched_priority = priority;
+    return pthread_setschedparam(thread, policy, &param);
+}
+
 #endif // IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
@@ -16,6 +16,12 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -34,3 +40,134 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+size_t iox_shm_huge_page_size(void)
+{
+    // shared memory lives on tmpfs which can only be backed by transparent huge pages; the policy is
+    // shown as e.g. 'always within_size [advise] never deny force' with the active one in brackets
+    constexpr size_t BUFFER_SIZE{128U};
+    char buffer[BUFFER_SIZE];
+
+    FILE* shmemEnabled = fopen("/sys/kernel/mm/transparent_hugepage/shmem_enabled", "r");
+    if (shmemEnabled == nullptr)
+    {
+        return 0U;
+    }
+    const char* policy = fgets(&buffer[0], BUFFER_SIZE, shmemEnabled);
+    fclose(shmemEnabled);
+    if (policy == nullptr || strstr(policy, "[never]") != nullptr || strstr(policy, "[deny]") != nullptr)
+    {
+        return 0U;
+    }
+
+    FILE* hugePageSize = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+    if (hugePageSize == nullptr)
+    {
+        return 0U;
+    }
+    unsigned long long size{0U};
+    if (fscanf(hugePageSize, "%llu", &size) != 1)
+    {
+        size = 0U;
+    }
+    fclose(hugePageSize);
+
+    return static_cast<size_t>(size);
+}
+
+int iox_shm_advise_huge_pages(void* addr, size_t length)
+{
+#ifdef MADV_HUGEPAGE
+    return madvise(addr, length, MADV_HUGEPAGE);
+#else
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+size_t iox_shm_mapped_huge_page_size(const void* addr, size_t length)
+{
+    // the huge pages of shared memory are listed as 'ShmemPmdMapped' below the header line of the mapping in smaps
+    FILE* smaps = fopen("/proc/self/smaps", "r");
+    if (smaps == nullptr)
+    {
+        return 0U;
+    }
+
+    constexpr size_t BUFFER_SIZE{512U};
+    char buffer[BUFFER_SIZE];
+    bool isRequestedMapping{false};
+    unsigned long long pmdMappedKiB{0U};
+    while (fgets(&buffer[0], BUFFER_SIZE, smaps) != nullptr)
+    {
+        unsigned long long start{0U};
+        unsigned long long end{0U};
+        if (sscanf(&buffer[0], "%llx-%llx ", &start, &end) == 2)
+        {
+            if (isRequestedMapping)
+            {
+                break;
+            }
+            isRequestedMapping = (start == reinterpret_cast<uintptr_t>(addr));
+        }
+        else if (isRequestedMapping && sscanf(&buffer[0], "ShmemPmdMapped: %llu kB", &pmdMappedKiB) == 1)
+        {
+            break;
+        }
+    }
+    fclose(smaps);
+
+    constexpr unsigned long long BYTES_PER_KIB{1024U};
+    if (pmdMappedKiB == 0U || pmdMappedKiB * BYTES_PER_KIB < length)
+    {
+        return 0U;
+    }
+    return iox_shm_huge_page_size();
+}
+
+int iox_shm_lock(void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+namespace
+{
+// one word of the node mask is sufficient for the NUMA nodes of all currently available platforms
+constexpr unsigned long NUMA_NODE_MASK_BITS{sizeof(unsigned long) * 8U};
+// the kernel evaluates only 'maxnode - 1' bits of the node mask
+constexpr unsigned long NUMA_MAX_NODE{NUMA_NODE_MASK_BITS + 1U};
+} // namespace
+
+int iox_numa_bind_to_node(void* addr, size_t length, unsigned int node)
+{
+    if (node >= NUMA_NODE_MASK_BITS)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    const unsigned long nodeMask{1UL << node};
+    return static_cast<int>(syscall(SYS_mbind, addr, length, MPOL_BIND, &nodeMask, NUMA_MAX_NODE, MPOL_MF_MOVE));
+}
+
+int iox_numa_interleave(void* addr, size_t length)
+{
+    unsigned long allowedNodes{0U};
+    if (syscall(SYS_get_mempolicy, nullptr, &allowedNodes, NUMA_MAX_NODE, nullptr, MPOL_F_MEMS_ALLOWED) != 0)
+    {
+        return -1;
+    }
+
+    return static_cast<int>(
+        syscall(SYS_mbind, addr, length, MPOL_INTERLEAVE, &allowedNodes, NUMA_MAX_NODE, MPOL_MF_MOVE));
+}
+
+int iox_numa_node_of_address(const void* addr)
+{
+    int node{-1};
+    if (syscall(SYS_get_mempolicy, &node, nullptr, 0UL, addr, MPOL_F_NODE | MPOL_F_ADDR) != 0)
+    {
+        return -1;
+    }
+    return node;
+}
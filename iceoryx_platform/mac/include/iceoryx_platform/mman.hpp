@@ -23,4 +23,34 @@ int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
 int iox_shm_close(int fd);
 
+/// @brief returns the size of the huge pages which can back shared memory
+/// @return the huge page size in bytes or 0 when huge pages are not supported for shared memory
+size_t iox_shm_huge_page_size(void);
+
+/// @brief advises the system to back the mapped shared memory with huge pages
+/// @return 0 on success, -1 otherwise with errno set
+int iox_shm_advise_huge_pages(void* addr, size_t length);
+
+/// @brief acquires the size of the huge pages which actually back the mapped shared memory; only pages which were
+/// already touched by the calling process are taken into account
+/// @return the huge page size in bytes or 0 when the memory is not entirely backed by huge pages
+size_t iox_shm_mapped_huge_page_size(const void* addr, size_t length);
+
+/// @brief locks the mapped shared memory in RAM so that it cannot be paged out
+/// @return 0 on success, -1 otherwise with errno set
+int iox_shm_lock(void* addr, size_t length);
+
+/// @brief binds the memory to a NUMA node; pages which are already present are migrated to the node
+/// @return 0 on success, -1 otherwise with errno set
+int iox_numa_bind_to_node(void* addr, size_t length, unsigned int node);
+
+/// @brief interleaves the memory page by page over all NUMA nodes the process is allowed to use; pages which are
+/// already present are migrated accordingly
+/// @return 0 on success, -1 otherwise with errno set
+int iox_numa_interleave(void* addr, size_t length);
+
+/// @brief acquires the NUMA node of the page which contains the address
+/// @return the NUMA node on success, -1 otherwise with errno set
+int iox_numa_node_of_address(const void* addr);
+
 #endif // IOX_HOOFS_MAC_PLATFORM_MMAN_HPP
@@ -17,6 +17,7 @@
 #ifndef IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
 
+#include <cstdint>
 #include <pthread.h>
 
 #define IOX_PTHREAD_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
@@ -115,4 +116,9 @@ int iox_pthread_join(iox_pthread_t thread, void** retval);
 
 iox_pthread_t iox_pthread_self();
 
+/// @note pinning a thread to CPUs is not supported on this platform
+int iox_pthread_setaffinity_np(iox_pthread_t thread, uint64_t cpuMask);
+
+int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority);
+
 #endif // IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
@@ -43,3 +43,42 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+size_t iox_shm_huge_page_size(void)
+{
+    return 0U;
+}
+
+int iox_shm_advise_huge_pages(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+size_t iox_shm_mapped_huge_page_size(const void*, size_t)
+{
+    return 0U;
+}
+
+int iox_shm_lock(void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+int iox_numa_bind_to_node(void*, size_t, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_numa_interleave(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_numa_node_of_address(const void*)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -17,6 +17,7 @@
 
 #include "iceoryx_platform/pthread.hpp"
 
+#include <cerrno>
 #include <map>
 #include <mutex>
 #include <string>
@@ -71,6 +72,18 @@ iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+int iox_pthread_setaffinity_np(iox_pthread_t, uint64_t)
+{
+    return ENOSYS;
+}
+
+int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority)
+{
+    sched_param param{};
+    param.sched_priority = priority;
+    return pthread_setschedparam(thread, policy, &param);
+}
+
 int pthread_mutexattr_setrobust(pthread_mutexattr_t*, int)
 {
     return 0;
@@ -17,6 +17,8 @@
 #ifndef IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
 
+#include <cerrno>
+#include <cstdint>
 #include <pthread.h>
 
 #define IOX_PTHREAD_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
@@ -131,4 +133,17 @@ inline iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+/// @note pinning a thread to CPUs is not supported on this platform
+inline int iox_pthread_setaffinity_np(iox_pthread_t, uint64_t)
+{
+    return ENOSYS;
+}
+
+inline int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority)
+{
+    sched_param param{};
+    param.sched_priority = priority;
+    return pthread_setschedparam(thread, policy, &param);
+}
+
 #endif // IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
@@ -21,6 +21,7 @@
 #include "iceoryx_platform/win32_errorHandling.hpp"
 #include "iceoryx_platform/windows.hpp"
 
+#include <cstdint>
 #include <thread>
 #include <type_traits>
 
@@ -76,4 +77,8 @@ int iox_pthread_create(iox_pthread_t* thread, const iox_pthread_attr_t* attr, vo
 int iox_pthread_join(iox_pthread_t thread, void** retval);
 iox_pthread_t iox_pthread_self();
 
+/// @note pinning a thread to CPUs and changing its scheduling policy is not supported on this platform
+int iox_pthread_setaffinity_np(iox_pthread_t thread, uint64_t cpuMask);
+int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority);
+
 #endif // IOX_HOOFS_WIN_PLATFORM_PTHREAD_HPP
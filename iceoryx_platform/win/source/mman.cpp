@@ -266,3 +266,52 @@ off_t internal_iox_shm_get_size(int fd)
     fclose(shm_state);
     return shm_size;
 }
+
+size_t iox_shm_huge_page_size(void)
+{
+    return 0U;
+}
+
+int iox_shm_advise_huge_pages(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+size_t iox_shm_mapped_huge_page_size(const void*, size_t)
+{
+    return 0U;
+}
+
+int iox_shm_lock(void* addr, size_t length)
+{
+    if (Win32Call(VirtualLock, addr, length).value)
+    {
+        return 0;
+    }
+
+    std::stringstream stream;
+    stream << "Failed to lock memory region with iox_shm_lock( addr = " << std::hex << addr << std::dec
+           << ", length = " << length << ")";
+    IOX_PLATFORM_LOG(IOX_PLATFORM_LOG_LEVEL_ERROR, stream.str().c_str());
+    errno = ENOMEM;
+    return -1;
+}
+
+int iox_numa_bind_to_node(void*, size_t, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_numa_interleave(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_numa_node_of_address(const void*)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -20,6 +20,7 @@
 #include "iceoryx_platform/win32_errorHandling.hpp"
 #include "iceoryx_platform/windows.hpp"
 
+#include <cerrno>
 #include <cwchar>
 #include <sstream>
 #include <vector>
@@ -110,6 +111,16 @@ iox_pthread_t iox_pthread_self()
     return GetCurrentThread();
 }
 
+int iox_pthread_setaffinity_np(iox_pthread_t, uint64_t)
+{
+    return ENOSYS;
+}
+
+int iox_pthread_setschedparam(iox_pthread_t, int, int)
+{
+    return ENOSYS;
+}
+
 int iox_pthread_mutexattr_destroy(iox_pthread_mutexattr_t* attr)
 {
     return 0;
@@ -139,6 +139,14 @@ configure_option(
     NAME IOX_MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY
     DEFAULT_VALUE 4
 )
+configure_option(
+    NAME IOX_PRODUCER_SPIN_DURATION_US
+    DEFAULT_VALUE 100
+)
+configure_option(
+    NAME IOX_PRODUCER_BLOCKING_TIMEOUT_MS
+    DEFAULT_VALUE 10
+)
 
 configure_option(
     NAME IOX_DEFAULT_RESOURCE_PREFIX
@@ -151,6 +159,20 @@ else()
      set(IOX_EXPERIMENTAL_POSH_FLAG false)
 endif()
 
+# the IPC channel between the runtimes and RouDi; 'NamedPipe' is a lock-free queue in shared memory whose readers and
+# writers sleep on semaphores, 'UnixDomainSocket' and 'MessageQueue' copy each message through the kernel
+if(NOT IOX_IPC_CHANNEL_TYPE)
+    if(WIN32)
+        set(IOX_IPC_CHANNEL_TYPE NamedPipe)
+    else()
+        set(IOX_IPC_CHANNEL_TYPE UnixDomainSocket)
+    endif()
+endif()
+
+if(NOT IOX_IPC_CHANNEL_TYPE MATCHES "^(UnixDomainSocket|MessageQueue|NamedPipe)$")
+    message(FATAL_ERROR "IOX_IPC_CHANNEL_TYPE must be one of 'UnixDomainSocket', 'MessageQueue' or 'NamedPipe' but is '${IOX_IPC_CHANNEL_TYPE}'")
+endif()
+
 if(IOX_EXPERIMENTAL_32_64_BIT_MIX_MODE)
     set(IOX_INTERPROCESS_LOCK concurrent::SpinLock)
     set(IOX_INTERPROCESS_SEMAPHORE concurrent::SpinSemaphore)
@@ -162,6 +184,7 @@ endif()
 message(STATUS "[i] IOX_EXPERIMENTAL_POSH_FLAG: ${IOX_EXPERIMENTAL_POSH_FLAG}")
 message(STATUS "[i] IOX_INTERPROCESS_LOCK: ${IOX_INTERPROCESS_LOCK}")
 message(STATUS "[i] IOX_INTERPROCESS_SEMAPHORE: ${IOX_INTERPROCESS_SEMAPHORE}")
+message(STATUS "[i] IOX_IPC_CHANNEL_TYPE: ${IOX_IPC_CHANNEL_TYPE}")
 
 message(STATUS "[i] <<<<<<<<<<<<<< End iceoryx_posh configuration: >>>>>>>>>>>>>>")
 
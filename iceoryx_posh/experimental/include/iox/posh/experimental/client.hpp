@@ -24,6 +24,7 @@
 #include "iceoryx_posh/popo/untyped_client.hpp"
 #include "iox/builder.hpp"
 #include "iox/expected.hpp"
+#include "iox/posh/experimental/port_batch.hpp"
 #include "iox/unique_ptr.hpp"
 
 namespace iox::posh::experimental
@@ -76,11 +77,17 @@ class ClientBuilder
     /// @brief Creates an untyped client instance for the server-client messaging pattern
     expected<unique_ptr<UntypedClient>, ClientBuilderError> create() noexcept;
 
+    /// @brief Adds the client to a batch of ports which are created together, see 'PortBatch'
+    /// @return the index to take the client from the batch or 'PortBatchError::BATCH_FULL'
+    expected<PortBatch::Index, PortBatchError> add_to(PortBatch& batch) noexcept;
+
   private:
     friend class Node;
     explicit ClientBuilder(runtime::PoshRuntime& runtime,
                            const capro::ServiceDescription& service_description) noexcept;
 
+    popo::ClientOptions options() const noexcept;
+
   private:
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members) Intentionally used since the ClientBuilder is not intended to be moved
     runtime::PoshRuntime& m_runtime;
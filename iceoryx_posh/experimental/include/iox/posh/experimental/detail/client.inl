@@ -29,12 +29,25 @@ inline ClientBuilder::ClientBuilder(runtime::PoshRuntime& runtime,
 {
 }
 
+inline popo::ClientOptions ClientBuilder::options() const noexcept
+{
+    return {m_response_queue_capacity, "", m_connect_on_create, m_response_queue_full_policy, m_server_too_slow_policy};
+}
+
+inline expected<PortBatch::Index, PortBatchError> ClientBuilder::add_to(PortBatch& batch) noexcept
+{
+    auto index = batch.m_ports.addClient(m_service_description, options());
+    if (!index.has_value())
+    {
+        return err(PortBatchError::BATCH_FULL);
+    }
+    return ok(index.value());
+}
+
 template <typename Req, typename Res>
 inline expected<unique_ptr<Client<Req, Res>>, ClientBuilderError> ClientBuilder::create() noexcept
 {
-    auto* client_port_data = m_runtime.getMiddlewareClient(
-        m_service_description,
-        {m_response_queue_capacity, "", m_connect_on_create, m_response_queue_full_policy, m_server_too_slow_policy});
+    auto* client_port_data = m_runtime.getMiddlewareClient(m_service_description, options());
     if (client_port_data == nullptr)
     {
         return err(ClientBuilderError::OUT_OF_RESOURCES);
@@ -48,9 +61,7 @@ inline expected<unique_ptr<Client<Req, Res>>, ClientBuilderError> ClientBuilder:
 
 inline expected<unique_ptr<iox::popo::UntypedClient>, ClientBuilderError> ClientBuilder::create() noexcept
 {
-    auto* client_port_data = m_runtime.getMiddlewareClient(
-        m_service_description,
-        {m_response_queue_capacity, "", m_connect_on_create, m_response_queue_full_policy, m_server_too_slow_policy});
+    auto* client_port_data = m_runtime.getMiddlewareClient(m_service_description, options());
     if (client_port_data == nullptr)
     {
         return err(ClientBuilderError::OUT_OF_RESOURCES);
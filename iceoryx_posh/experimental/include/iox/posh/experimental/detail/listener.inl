@@ -35,7 +35,11 @@ inline expected<unique_ptr<Listener>, ListenerBuilderError> ListenerBuilder::cre
     {
         return err(ListenerBuilderError::OUT_OF_RESOURCES);
     }
-    return ok(unique_ptr<Listener>{new (std::nothrow) Listener{*condition_variable_data}, [&](auto* const listener) {
+    popo::ListenerOptions options;
+    options.numberOfWorkerThreads = m_number_of_worker_threads;
+    options.threadSchedulingOptions = m_thread_scheduling_options;
+    return ok(unique_ptr<Listener>{new (std::nothrow) Listener{*condition_variable_data, options},
+                                   [&](auto* const listener) {
                                        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory) raw pointer is required by the unique_ptr API
                                        delete listener;
                                    }});
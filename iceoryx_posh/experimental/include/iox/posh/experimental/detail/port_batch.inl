@@ -0,0 +1,104 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_EXPERIMENTAL_PORT_BATCH_INL
+#define IOX_POSH_EXPERIMENTAL_PORT_BATCH_INL
+
+#include "iox/posh/experimental/port_batch.hpp"
+
+namespace iox::posh::experimental
+{
+inline PortBatch::PortBatch(runtime::PoshRuntime& runtime) noexcept
+    : m_runtime(runtime)
+{
+}
+
+inline expected<void, PortBatchError> PortBatch::create() noexcept
+{
+    if (!m_runtime.getMiddlewarePorts(m_ports))
+    {
+        return err(PortBatchError::OUT_OF_RESOURCES);
+    }
+    return ok();
+}
+
+inline PortBatchError PortBatch::take_error(const Index index, const runtime::PortKind kind) const noexcept
+{
+    if (index >= m_ports.size() || m_ports[index].kind() != kind
+        || m_ports.getError(index) == runtime::IpcMessageErrorType::NOTYPE)
+    {
+        return PortBatchError::PORT_NOT_AVAILABLE;
+    }
+    return PortBatchError::OUT_OF_RESOURCES;
+}
+
+template <typename PortType, typename PortUserType>
+inline expected<unique_ptr<PortType>, PortBatchError> PortBatch::wrap(PortUserType&& port_user) noexcept
+{
+    return ok(unique_ptr<PortType>{new (std::nothrow) PortType{std::forward<PortUserType>(port_user)},
+                                   [&](auto* const port) {
+                                       // NOLINTNEXTLINE(cppcoreguidelines-owning-memory) raw pointer is required by the unique_ptr API
+                                       delete port;
+                                   }});
+}
+
+template <typename PublisherType>
+inline expected<unique_ptr<PublisherType>, PortBatchError> PortBatch::take_publisher(const Index index) noexcept
+{
+    auto* publisher_port_data = m_ports.takePublisher(index);
+    if (publisher_port_data == nullptr)
+    {
+        return err(take_error(index, runtime::PortKind::PUBLISHER));
+    }
+    return wrap<PublisherType>(iox::PublisherPortUserType{publisher_port_data});
+}
+
+template <typename SubscriberType>
+inline expected<unique_ptr<SubscriberType>, PortBatchError> PortBatch::take_subscriber(const Index index) noexcept
+{
+    auto* subscriber_port_data = m_ports.takeSubscriber(index);
+    if (subscriber_port_data == nullptr)
+    {
+        return err(take_error(index, runtime::PortKind::SUBSCRIBER));
+    }
+    return wrap<SubscriberType>(iox::SubscriberPortUserType{subscriber_port_data});
+}
+
+template <typename ClientType>
+inline expected<unique_ptr<ClientType>, PortBatchError> PortBatch::take_client(const Index index) noexcept
+{
+    auto* client_port_data = m_ports.takeClient(index);
+    if (client_port_data == nullptr)
+    {
+        return err(take_error(index, runtime::PortKind::CLIENT));
+    }
+    return wrap<ClientType>(iox::popo::ClientPortUser{*client_port_data});
+}
+
+template <typename ServerType>
+inline expected<unique_ptr<ServerType>, PortBatchError> PortBatch::take_server(const Index index) noexcept
+{
+    auto* server_port_data = m_ports.takeServer(index);
+    if (server_port_data == nullptr)
+    {
+        return err(take_error(index, runtime::PortKind::SERVER));
+    }
+    return wrap<ServerType>(iox::popo::ServerPortUser{*server_port_data});
+}
+
+} // namespace iox::posh::experimental
+
+#endif // IOX_POSH_EXPERIMENTAL_PORT_BATCH_INL
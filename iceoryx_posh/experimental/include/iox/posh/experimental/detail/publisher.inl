@@ -28,11 +28,25 @@ inline PublisherBuilder::PublisherBuilder(runtime::PoshRuntime& runtime,
 {
 }
 
+inline popo::PublisherOptions PublisherBuilder::options() const noexcept
+{
+    return {m_history_capacity, "", m_offer_on_create, m_subscriber_too_slow_policy};
+}
+
+inline expected<PortBatch::Index, PortBatchError> PublisherBuilder::add_to(PortBatch& batch) noexcept
+{
+    auto index = batch.m_ports.addPublisher(m_service_description, options());
+    if (!index.has_value())
+    {
+        return err(PortBatchError::BATCH_FULL);
+    }
+    return ok(index.value());
+}
+
 template <typename T, typename H>
 inline expected<unique_ptr<Publisher<T, H>>, PublisherBuilderError> PublisherBuilder::create() noexcept
 {
-    auto* publisher_port_data = m_runtime.getMiddlewarePublisher(
-        m_service_description, {m_history_capacity, "", m_offer_on_create, m_subscriber_too_slow_policy});
+    auto* publisher_port_data = m_runtime.getMiddlewarePublisher(m_service_description, options());
     if (publisher_port_data == nullptr)
     {
         return err(PublisherBuilderError::OUT_OF_RESOURCES);
@@ -46,8 +60,7 @@ inline expected<unique_ptr<Publisher<T, H>>, PublisherBuilderError> PublisherBui
 
 inline expected<unique_ptr<UntypedPublisher>, PublisherBuilderError> PublisherBuilder::create() noexcept
 {
-    auto* publisher_port_data = m_runtime.getMiddlewarePublisher(
-        m_service_description, {m_history_capacity, "", m_offer_on_create, m_subscriber_too_slow_policy});
+    auto* publisher_port_data = m_runtime.getMiddlewarePublisher(m_service_description, options());
     if (publisher_port_data == nullptr)
     {
         return err(PublisherBuilderError::OUT_OF_RESOURCES);
@@ -29,13 +29,26 @@ inline ServerBuilder::ServerBuilder(runtime::PoshRuntime& runtime,
 {
 }
 
+inline popo::ServerOptions ServerBuilder::options() const noexcept
+{
+    return {m_request_queue_capacity, "", m_offer_on_create, m_request_queue_full_policy, m_client_too_slow_policy};
+}
+
+inline expected<PortBatch::Index, PortBatchError> ServerBuilder::add_to(PortBatch& batch) noexcept
+{
+    auto index = batch.m_ports.addServer(m_service_description, options());
+    if (!index.has_value())
+    {
+        return err(PortBatchError::BATCH_FULL);
+    }
+    return ok(index.value());
+}
+
 
 template <typename Req, typename Res>
 inline expected<unique_ptr<Server<Req, Res>>, ServerBuilderError> ServerBuilder::create() noexcept
 {
-    auto* server_port_data = m_runtime.getMiddlewareServer(
-        m_service_description,
-        {m_request_queue_capacity, "", m_offer_on_create, m_request_queue_full_policy, m_client_too_slow_policy});
+    auto* server_port_data = m_runtime.getMiddlewareServer(m_service_description, options());
     if (server_port_data == nullptr)
     {
         return err(ServerBuilderError::OUT_OF_RESOURCES);
@@ -49,9 +62,7 @@ inline expected<unique_ptr<Server<Req, Res>>, ServerBuilderError> ServerBuilder:
 
 inline expected<unique_ptr<UntypedServer>, ServerBuilderError> ServerBuilder::create() noexcept
 {
-    auto* server_port_data = m_runtime.getMiddlewareServer(
-        m_service_description,
-        {m_request_queue_capacity, "", m_offer_on_create, m_request_queue_full_policy, m_client_too_slow_policy});
+    auto* server_port_data = m_runtime.getMiddlewareServer(m_service_description, options());
     if (server_port_data == nullptr)
     {
         return err(ServerBuilderError::OUT_OF_RESOURCES);
@@ -28,16 +28,30 @@ inline SubscriberBuilder::SubscriberBuilder(runtime::PoshRuntime& runtime,
 {
 }
 
+inline popo::SubscriberOptions SubscriberBuilder::options() const noexcept
+{
+    return {m_queue_capacity,
+            m_history_request,
+            "",
+            m_subscribe_on_create,
+            m_queue_full_policy,
+            m_requires_publisher_history_support};
+}
+
+inline expected<PortBatch::Index, PortBatchError> SubscriberBuilder::add_to(PortBatch& batch) noexcept
+{
+    auto index = batch.m_ports.addSubscriber(m_service_description, options());
+    if (!index.has_value())
+    {
+        return err(PortBatchError::BATCH_FULL);
+    }
+    return ok(index.value());
+}
+
 template <typename T, typename H>
 inline expected<unique_ptr<Subscriber<T, H>>, SubscriberBuilderError> SubscriberBuilder::create() noexcept
 {
-    auto* subscriber_port_data = m_runtime.getMiddlewareSubscriber(m_service_description,
-                                                                   {m_queue_capacity,
-                                                                    m_history_request,
-                                                                    "",
-                                                                    m_subscribe_on_create,
-                                                                    m_queue_full_policy,
-                                                                    m_requires_publisher_history_support});
+    auto* subscriber_port_data = m_runtime.getMiddlewareSubscriber(m_service_description, options());
     if (subscriber_port_data == nullptr)
     {
         return err(SubscriberBuilderError::OUT_OF_RESOURCES);
@@ -51,13 +65,7 @@ inline expected<unique_ptr<Subscriber<T, H>>, SubscriberBuilderError> Subscriber
 
 inline expected<unique_ptr<UntypedSubscriber>, SubscriberBuilderError> SubscriberBuilder::create() noexcept
 {
-    auto* subscriber_port_data = m_runtime.getMiddlewareSubscriber(m_service_description,
-                                                                   {m_queue_capacity,
-                                                                    m_history_request,
-                                                                    "",
-                                                                    m_subscribe_on_create,
-                                                                    m_queue_full_policy,
-                                                                    m_requires_publisher_history_support});
+    auto* subscriber_port_data = m_runtime.getMiddlewareSubscriber(m_service_description, options());
     if (subscriber_port_data == nullptr)
     {
         return err(SubscriberBuilderError::OUT_OF_RESOURCES);
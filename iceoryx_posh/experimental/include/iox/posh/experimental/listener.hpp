@@ -39,6 +39,13 @@ enum class ListenerBuilderError : uint8_t
 /// @brief A builder for the listener
 class ListenerBuilder
 {
+    /// @brief The number of worker threads which execute the callbacks; with zero the callbacks are executed by the
+    /// single thread of the listener
+    IOX_BUILDER_PARAMETER(uint32_t, number_of_worker_threads, 0U)
+
+    /// @brief The CPU affinity and the scheduling policy of the threads of the listener
+    IOX_BUILDER_PARAMETER(ThreadSchedulingOptions, thread_scheduling_options, ThreadSchedulingOptions())
+
   public:
     /// @brief Creates a listener
     /// @return a 'listener' on success and a 'ListenerBuilderError' on failure
@@ -29,6 +29,7 @@
 #include "iox/optional.hpp"
 #include "iox/posh/experimental/client.hpp"
 #include "iox/posh/experimental/listener.hpp"
+#include "iox/posh/experimental/port_batch.hpp"
 #include "iox/posh/experimental/publisher.hpp"
 #include "iox/posh/experimental/server.hpp"
 #include "iox/posh/experimental/subscriber.hpp"
@@ -68,6 +69,16 @@ class NodeBuilder
     /// tests
     IOX_BUILDER_PARAMETER(bool, shares_address_space_with_roudi, false)
 
+    /// @brief Determines whether the shared memory segments are prefaulted and locked in RAM when they are mapped; the
+    /// payload segments use at least the residency RouDi is configured with
+    IOX_BUILDER_PARAMETER(roudi::MemoryResidency, memory_residency, roudi::MemoryResidency::OFF)
+
+    /// @brief Determines whether the payload segments are mapped when the node registers at RouDi or on demand when
+    /// they are used the first time
+    IOX_BUILDER_PARAMETER(runtime::PayloadSegmentMapping,
+                          payload_segment_mapping,
+                          runtime::PayloadSegmentMapping::ON_REGISTRATION)
+
   public:
     /// @brief Determines which domain to use to register to a RouDi instance
     /// @param[in] domain_id to be used as domain ID
@@ -134,9 +145,20 @@ class Node
     /// @brief Initiates a 'WaitSetBuilder'
     WaitSetBuilder wait_set() noexcept;
 
+    /// @brief Initiates a 'PortBatch' to create many publisher, subscriber, clients and servers with as few round
+    /// trips to RouDi as possible
+    PortBatch port_batch() noexcept;
+
     /// @brief Initiates a 'Listener'
     ListenerBuilder listener() noexcept;
 
+    /// @brief Unmaps the payload segments which were mapped on demand; a segment is mapped again when it is used the
+    /// next time
+    /// @return the number of unmapped segments; no segment is unmapped while the node holds chunks, i.e. as long as
+    /// not all loaned and taken samples, requests and responses are released
+    /// @attention no chunk must be loaned or taken concurrently to this call
+    uint64_t unmap_payload_segments() noexcept;
+
   private:
     friend class NodeBuilder;
     Node(const NodeName_t& name,
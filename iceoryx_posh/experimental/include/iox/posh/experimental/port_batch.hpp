@@ -0,0 +1,112 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_EXPERIMENTAL_PORT_BATCH_HPP
+#define IOX_POSH_EXPERIMENTAL_PORT_BATCH_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/runtime/port_batch.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/expected.hpp"
+#include "iox/unique_ptr.hpp"
+
+namespace iox::posh::experimental
+{
+enum class PortBatchError : uint8_t
+{
+    BATCH_FULL,
+    OUT_OF_RESOURCES,
+    PORT_NOT_AVAILABLE,
+};
+
+/// @brief Collects publisher, subscriber, clients and servers which are created together with as few round trips to
+/// RouDi as possible. The ports are added with the 'add_to' method of the respective builder and taken from the batch
+/// after 'create' was called.
+/// @code
+///     auto batch = node.port_batch();
+///     auto publisher_index = node.publisher({"Radar", "FrontLeft", "Object"}).add_to(batch).expect("");
+///     auto subscriber_index = node.subscriber({"Radar", "FrontRight", "Object"}).add_to(batch).expect("");
+///     batch.create().expect("");
+///     auto publisher = batch.take_publisher<Publisher<Object>>(publisher_index).expect("");
+///     auto subscriber = batch.take_subscriber<UntypedSubscriber>(subscriber_index).expect("");
+/// @endcode
+class PortBatch
+{
+  public:
+    using Index = runtime::PortBatch::Index_t;
+
+    ~PortBatch() = default;
+
+    PortBatch(const PortBatch& other) = delete;
+    PortBatch& operator=(const PortBatch&) = delete;
+    PortBatch(PortBatch&& rhs) noexcept = delete;
+    PortBatch& operator=(PortBatch&& rhs) noexcept = delete;
+
+    /// @brief Requests all ports of the batch which were not created yet from RouDi
+    /// @return 'PortBatchError::OUT_OF_RESOURCES' if not all ports could be created; the other ports can be taken
+    /// nevertheless
+    expected<void, PortBatchError> create() noexcept;
+
+    /// @brief Takes a publisher out of the batch
+    /// @tparam PublisherType is either a 'Publisher<T, H>' or an 'UntypedPublisher'
+    /// @param[in] index which was returned by 'PublisherBuilder::add_to'
+    template <typename PublisherType>
+    expected<unique_ptr<PublisherType>, PortBatchError> take_publisher(const Index index) noexcept;
+
+    /// @brief Takes a subscriber out of the batch
+    /// @tparam SubscriberType is either a 'Subscriber<T, H>' or an 'UntypedSubscriber'
+    /// @param[in] index which was returned by 'SubscriberBuilder::add_to'
+    template <typename SubscriberType>
+    expected<unique_ptr<SubscriberType>, PortBatchError> take_subscriber(const Index index) noexcept;
+
+    /// @brief Takes a client out of the batch
+    /// @tparam ClientType is either a 'Client<Req, Res>' or an 'UntypedClient'
+    /// @param[in] index which was returned by 'ClientBuilder::add_to'
+    template <typename ClientType>
+    expected<unique_ptr<ClientType>, PortBatchError> take_client(const Index index) noexcept;
+
+    /// @brief Takes a server out of the batch
+    /// @tparam ServerType is either a 'Server<Req, Res>' or an 'UntypedServer'
+    /// @param[in] index which was returned by 'ServerBuilder::add_to'
+    template <typename ServerType>
+    expected<unique_ptr<ServerType>, PortBatchError> take_server(const Index index) noexcept;
+
+  private:
+    friend class Node;
+    friend class PublisherBuilder;
+    friend class SubscriberBuilder;
+    friend class ClientBuilder;
+    friend class ServerBuilder;
+
+    explicit PortBatch(runtime::PoshRuntime& runtime) noexcept;
+
+    /// @brief Returns the error for a port which could not be taken from the batch
+    PortBatchError take_error(const Index index, const runtime::PortKind kind) const noexcept;
+
+    template <typename PortType, typename PortUserType>
+    static expected<unique_ptr<PortType>, PortBatchError> wrap(PortUserType&& port_user) noexcept;
+
+  private:
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members) Intentionally used since the PortBatch is not intended to be moved
+    runtime::PoshRuntime& m_runtime;
+    runtime::PortBatch m_ports;
+};
+
+} // namespace iox::posh::experimental
+
+#include "iox/posh/experimental/detail/port_batch.inl"
+
+#endif // IOX_POSH_EXPERIMENTAL_PORT_BATCH_HPP
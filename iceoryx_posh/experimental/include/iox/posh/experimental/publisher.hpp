@@ -23,6 +23,7 @@
 #include "iceoryx_posh/popo/untyped_publisher.hpp"
 #include "iox/builder.hpp"
 #include "iox/expected.hpp"
+#include "iox/posh/experimental/port_batch.hpp"
 #include "iox/unique_ptr.hpp"
 
 namespace iox::posh::experimental
@@ -69,11 +70,17 @@ class PublisherBuilder
     /// @brief Creates an untyped publisher instance for the publish-subscribe messaging pattern
     expected<unique_ptr<UntypedPublisher>, PublisherBuilderError> create() noexcept;
 
+    /// @brief Adds the publisher to a batch of ports which are created together, see 'PortBatch'
+    /// @return the index to take the publisher from the batch or 'PortBatchError::BATCH_FULL'
+    expected<PortBatch::Index, PortBatchError> add_to(PortBatch& batch) noexcept;
+
   private:
     friend class Node;
     explicit PublisherBuilder(runtime::PoshRuntime& runtime,
                               const capro::ServiceDescription& service_description) noexcept;
 
+    popo::PublisherOptions options() const noexcept;
+
   private:
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members) Intentionally used since the PublisherBuilder is not intended to be moved
     runtime::PoshRuntime& m_runtime;
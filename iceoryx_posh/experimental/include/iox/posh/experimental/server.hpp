@@ -24,6 +24,7 @@
 #include "iceoryx_posh/popo/untyped_server.hpp"
 #include "iox/builder.hpp"
 #include "iox/expected.hpp"
+#include "iox/posh/experimental/port_batch.hpp"
 #include "iox/unique_ptr.hpp"
 
 namespace iox::posh::experimental
@@ -75,11 +76,17 @@ class ServerBuilder
     /// @brief Creates an untyped server instance for the server-client messaging pattern
     expected<unique_ptr<UntypedServer>, ServerBuilderError> create() noexcept;
 
+    /// @brief Adds the server to a batch of ports which are created together, see 'PortBatch'
+    /// @return the index to take the server from the batch or 'PortBatchError::BATCH_FULL'
+    expected<PortBatch::Index, PortBatchError> add_to(PortBatch& batch) noexcept;
+
   private:
     friend class Node;
     explicit ServerBuilder(runtime::PoshRuntime& runtime,
                            const capro::ServiceDescription& service_description) noexcept;
 
+    popo::ServerOptions options() const noexcept;
+
   private:
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members) Intentionally used since the ServerBuilder is not intended to be moved
     runtime::PoshRuntime& m_runtime;
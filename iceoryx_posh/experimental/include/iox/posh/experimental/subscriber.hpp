@@ -23,6 +23,7 @@
 #include "iceoryx_posh/popo/untyped_subscriber.hpp"
 #include "iox/builder.hpp"
 #include "iox/expected.hpp"
+#include "iox/posh/experimental/port_batch.hpp"
 #include "iox/unique_ptr.hpp"
 
 namespace iox::posh::experimental
@@ -76,11 +77,17 @@ class SubscriberBuilder
     /// @brief Creates an untyped subscriber instance for the publish-subscribe messaging pattern
     expected<unique_ptr<UntypedSubscriber>, SubscriberBuilderError> create() noexcept;
 
+    /// @brief Adds the subscriber to a batch of ports which are created together, see 'PortBatch'
+    /// @return the index to take the subscriber from the batch or 'PortBatchError::BATCH_FULL'
+    expected<PortBatch::Index, PortBatchError> add_to(PortBatch& batch) noexcept;
+
   private:
     friend class Node;
     explicit SubscriberBuilder(runtime::PoshRuntime& runtime,
                                const capro::ServiceDescription& service_description) noexcept;
 
+    popo::SubscriberOptions options() const noexcept;
+
   private:
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members) Intentionally used since the SubscriberBuilder is not intended to be moved
     runtime::PoshRuntime& m_runtime;
@@ -121,7 +121,9 @@ expected<Node, NodeBuilderError> NodeBuilder::create() noexcept
             runtime::SharedMemoryUser::create(domain_id,
                                               ipcRuntimeInterface.getSegmentId(),
                                               ipcRuntimeInterface.getShmTopicSize(),
-                                              ipcRuntimeInterface.getSegmentManagerAddressOffset())
+                                              ipcRuntimeInterface.getSegmentManagerAddressOffset(),
+                                              m_memory_residency,
+                                              m_payload_segment_mapping)
                 .and_then([&shmInterface](auto& value) { shmInterface.emplace(std::move(value)); });
         if (shmInterfaceResult.has_error())
         {
@@ -167,9 +169,19 @@ WaitSetBuilder Node::wait_set() noexcept
     return WaitSetBuilder{*m_runtime.get()};
 }
 
+PortBatch Node::port_batch() noexcept
+{
+    return PortBatch{*m_runtime.get()};
+}
+
 ListenerBuilder Node::listener() noexcept
 {
     return ListenerBuilder{*m_runtime.get()};
 }
 
+uint64_t Node::unmap_payload_segments() noexcept
+{
+    return m_runtime->unmapPayloadSegments();
+}
+
 } // namespace iox::posh::experimental
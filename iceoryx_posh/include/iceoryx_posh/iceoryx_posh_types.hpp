@@ -65,6 +65,13 @@ constexpr uint32_t MAX_SUBSCRIBERS_PER_PUBLISHER = build::IOX_MAX_SUBSCRIBERS_PE
 constexpr uint32_t MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY;
 constexpr uint64_t MAX_PUBLISHER_HISTORY = build::IOX_MAX_PUBLISHER_HISTORY;
+/// A producer which waits for a consumer (ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER) first busy waits for
+/// PRODUCER_SPIN_DURATION and then sleeps until the consumer frees a slot in its queue. The sleep is limited by
+/// PRODUCER_BLOCKING_TIMEOUT after which the producer checks again whether the queue still exists.
+constexpr units::Duration PRODUCER_SPIN_DURATION =
+    units::Duration::fromMicroseconds(build::IOX_PRODUCER_SPIN_DURATION_US);
+constexpr units::Duration PRODUCER_BLOCKING_TIMEOUT =
+    units::Duration::fromMilliseconds(build::IOX_PRODUCER_BLOCKING_TIMEOUT_MS);
 // Subscriber
 constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
@@ -111,11 +118,17 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+constexpr uint32_t MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER = 16U;
+/// @brief the number of TimerTriggers which can be attached to a single WaitSet or Listener
+constexpr uint32_t MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE = 8U;
 //--------- Communication Resources End---------------------
 
 // Memory
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = build::IOX_MAX_NUMBER_OF_MEMPOOLS;
 constexpr uint32_t MAX_SHM_SEGMENTS = build::IOX_MAX_SHM_SEGMENTS;
+/// @note each thread which uses a mempool with an enabled thread cache occupies one of these slots until it terminates
+constexpr uint32_t MAX_THREAD_CACHES_PER_MEMPOOL = 64U;
+constexpr uint32_t MAX_MEMPOOL_THREAD_CACHE_CAPACITY = 256U;
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
@@ -291,6 +304,9 @@ constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
 
+/// @brief the maximum number of threads which process the messages of the runtimes concurrently
+constexpr uint32_t MAX_RUNTIME_MESSAGE_WORKERS{16U};
+
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
 /// Contrarily, unmonitored processes can be restarted but registration will fail.
@@ -304,6 +320,20 @@ enum class MonitoringMode
 };
 
 iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const MonitoringMode& mode) noexcept;
+
+/// @brief Controls whether the pages of the shared memory segments are made resident when the segments are mapped.
+/// This avoids the page faults and the resulting latency spikes on the first access to a chunk.
+/// OFF - the pages are faulted in on the first access
+/// PREFAULT - every page is touched once when the segment is mapped
+/// PREFAULT_AND_LOCK - like PREFAULT and additionally the pages are locked in RAM
+enum class MemoryResidency : uint8_t
+{
+    OFF,
+    PREFAULT,
+    PREFAULT_AND_LOCK
+};
+
+iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const MemoryResidency& residency) noexcept;
 } // namespace roudi
 
 namespace mepoo
@@ -317,6 +347,19 @@ using namespace units::duration_literals;
 constexpr units::Duration PROCESS_WAITING_FOR_ROUDI_TIMEOUT = 60_s;
 constexpr units::Duration PROCESS_KEEP_ALIVE_INTERVAL = 3 * roudi::DISCOVERY_INTERVAL;  // > DISCOVERY_INTERVAL
 constexpr units::Duration PROCESS_KEEP_ALIVE_TIMEOUT = 5 * PROCESS_KEEP_ALIVE_INTERVAL; // > PROCESS_KEEP_ALIVE_INTERVAL
+
+/// @brief Controls when an application maps the payload segments it has access to.
+/// ON_REGISTRATION - all payload segments are mapped when the application registers at RouDi
+/// ON_DEMAND - a payload segment is mapped when a relative pointer into it is resolved for the first time, e.g. when
+///             a subscriber receives the first chunk from it, and when a publisher, client or server is created for
+///             the segments the application can write to
+enum class PayloadSegmentMapping : uint8_t
+{
+    ON_REGISTRATION,
+    ON_DEMAND
+};
+
+iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const PayloadSegmentMapping& mapping) noexcept;
 } // namespace runtime
 
 namespace version
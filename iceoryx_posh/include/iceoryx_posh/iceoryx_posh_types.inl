@@ -68,8 +68,48 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Mon
     }
     return logstream;
 }
+
+inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const MemoryResidency& residency) noexcept
+{
+    switch (residency)
+    {
+    case MemoryResidency::OFF:
+        logstream << "MemoryResidency::OFF";
+        break;
+    case MemoryResidency::PREFAULT:
+        logstream << "MemoryResidency::PREFAULT";
+        break;
+    case MemoryResidency::PREFAULT_AND_LOCK:
+        logstream << "MemoryResidency::PREFAULT_AND_LOCK";
+        break;
+    default:
+        logstream << "MemoryResidency::UNDEFINED";
+        break;
+    }
+    return logstream;
+}
 } // namespace roudi
 
+namespace runtime
+{
+inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const PayloadSegmentMapping& mapping) noexcept
+{
+    switch (mapping)
+    {
+    case PayloadSegmentMapping::ON_REGISTRATION:
+        logstream << "PayloadSegmentMapping::ON_REGISTRATION";
+        break;
+    case PayloadSegmentMapping::ON_DEMAND:
+        logstream << "PayloadSegmentMapping::ON_DEMAND";
+        break;
+    default:
+        logstream << "PayloadSegmentMapping::UNDEFINED";
+        break;
+    }
+    return logstream;
+}
+} // namespace runtime
+
 } // namespace iox
 
 #endif // IOX_POSH_ICEORYX_POSH_TYPES_INL
@@ -40,11 +40,18 @@ struct ChunkManagement
                     const not_null<MemPool*> mempool,
                     const not_null<MemPool*> chunkManagementPool) noexcept;
 
+    /// @brief Creates a ChunkManagement which is embedded in the prefix of the chunk it manages. The chunk is
+    /// released to the mempool with the address of the ChunkManagement.
+    ChunkManagement(const not_null<base_t*> chunkHeader, const not_null<MemPool*> mempool) noexcept;
+
+    /// @brief true if the ChunkManagement is stored in the prefix of its chunk and not in a separate pool
+    bool isEmbedded() const noexcept;
+
     iox::RelativePointer<base_t> m_chunkHeader;
     referenceCounter_t m_referenceCounter{1U};
 
     iox::RelativePointer<MemPool> m_mempool;
-    iox::RelativePointer<MemPool> m_chunkManagementPool;
+    iox::RelativePointer<MemPool> m_chunkManagementPool; // nullptr when the ChunkManagement is embedded
 };
 } // namespace mepoo
 } // namespace iox
@@ -23,9 +23,12 @@
 #include "iox/atomic.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/mpmc_loffli.hpp"
+#include "iox/numa_placement.hpp"
+#include "iox/optional.hpp"
 #include "iox/relative_pointer.hpp"
 
 #include <cstdint>
+#include <limits>
 
 
 namespace iox
@@ -50,11 +53,25 @@ class MemPool
   public:
     using freeList_t = concurrent::MpmcLoFFLi;
     static constexpr uint64_t CHUNK_MEMORY_ALIGNMENT = 8U; // default alignment for 64 bit
-
+    static constexpr uint32_t NO_THREAD_CACHE{0U};
+
+    /// @brief Creates a MemPool
+    /// @param[in] chunkSize is the size of a single chunk
+    /// @param[in] numberOfChunks is the number of chunks in the MemPool
+    /// @param[in] managementAllocator is used for the free list and the thread caches
+    /// @param[in] chunkMemoryAllocator is used for the chunks
+    /// @param[in] threadCacheCapacity is the number of free chunks each thread can keep in its own cache before
+    /// they are returned to the shared free list; with 'NO_THREAD_CACHE' every operation uses the shared free list
+    /// @param[in] numaPlacement defines on which NUMA node(s) the chunks are placed; if it cannot be applied the
+    /// chunks remain where the underlying memory was placed
     MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
             const greater_or_equal<uint32_t, 1> numberOfChunks,
             iox::BumpAllocator& managementAllocator,
-            iox::BumpAllocator& chunkMemoryAllocator) noexcept;
+            iox::BumpAllocator& chunkMemoryAllocator,
+            const uint32_t threadCacheCapacity = NO_THREAD_CACHE,
+            const NumaPlacement numaPlacement = NumaPlacement()) noexcept;
+
+    ~MemPool() noexcept;
 
     MemPool(const MemPool&) = delete;
     MemPool(MemPool&&) = delete;
@@ -66,10 +83,28 @@ class MemPool
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
+    uint32_t getThreadCacheCapacity() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Returns the free chunks in the thread caches of a process to the shared free list. This is used by
+    /// RouDi to clean up after a process terminated or crashed.
+    /// @param[in] pid of the process whose thread caches shall be released
+    /// @attention must only be called when the process is known to be terminated; the threads of a running process
+    /// would continue to use their thread caches while other threads already claimed them
+    void releaseThreadCachesOfProcess(const uint32_t pid) noexcept;
+
+    /// @brief Returns the free chunks in the thread caches of all threads of the current process to the shared free
+    /// lists of the corresponding MemPools. This is used by the runtime before it deregisters from RouDi.
+    /// @note must not be called while other threads of the current process are still using a MemPool
+    static void releaseThreadCachesOfCurrentProcess() noexcept;
+
+    /// @brief Calculates the management memory which is required for the thread caches of a MemPool
+    /// @param[in] threadCacheCapacity is the capacity of each thread cache
+    /// @return the required memory size
+    static uint64_t requiredThreadCacheMemorySize(const uint32_t threadCacheCapacity) noexcept;
+
     /// @brief Converts an index to a chunk in the MemPool to a pointer
     /// @param[in] index of the chunk
     /// @param[in] chunkSize is the size of the chunk
@@ -86,9 +121,36 @@ class MemPool
     pointerToIndex(const void* const chunk, const uint64_t chunkSize, const void* const rawMemoryBase) noexcept;
 
   private:
+    /// @brief a thread cache is a bounded stack of free indices which is owned by a single thread; it resides in the
+    /// shared memory in order to be released by RouDi when the owning process is gone
+    struct ThreadCache
+    {
+        static constexpr uint32_t NO_OWNER{0U};
+        static constexpr uint32_t OWNER_BUSY{std::numeric_limits<uint32_t>::max()};
+
+        /// the pid of the process the owning thread belongs to
+        concurrent::Atomic<uint32_t> m_owner{NO_OWNER};
+        /// incremented each time the thread cache is released; the owning thread compares it with the generation of
+        /// its claim in order to detect that it lost the ownership
+        concurrent::Atomic<uint32_t> m_generation{0U};
+        uint32_t m_numberOfIndices{0U};
+    };
+
+    /// @brief the process local part of the thread caches; defined in the translation unit
+    class LocalThreadCache;
+
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint64_t value) const noexcept;
 
+    bool acquireIndex(freeList_t::Index_t& index) noexcept;
+    void releaseIndex(const freeList_t::Index_t index) noexcept;
+    uint32_t threadCacheBatchSize() const noexcept;
+    ThreadCache* claimThreadCache(const uint32_t pid) noexcept;
+    freeList_t::Index_t* threadCacheIndices(const ThreadCache& threadCache) noexcept;
+    void releaseThreadCache(ThreadCache& threadCache,
+                            const uint32_t owner,
+                            const optional<uint32_t> generation = nullopt) noexcept;
+
     RelativePointer<void> m_rawMemory;
 
     uint64_t m_chunkSize{0U};
@@ -100,6 +162,10 @@ class MemPool
     concurrent::Atomic<uint32_t> m_minFree{0U};
 
     freeList_t m_freeIndices;
+
+    uint32_t m_threadCacheCapacity{NO_THREAD_CACHE};
+    RelativePointer<ThreadCache> m_threadCaches;
+    RelativePointer<freeList_t::Index_t> m_threadCacheIndices;
 };
 
 } // namespace mepoo
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
@@ -43,8 +44,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = range<uint64_t, 1, std::numeric_limits<uint64_t>::max() - sizeof(ChunkHeader)>;
@@ -69,6 +68,9 @@ class MemoryManager
                                 BumpAllocator& chunkMemoryAllocator) noexcept;
 
     /// @brief Obtains a chunk from the mempools
+    /// @note The best fitting mempool is selected with a size class table which is created in
+    /// 'configureMemoryManager'. If the mempool is exhausted, the chunk is acquired from a larger mempool when this is
+    /// enabled with MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL
     /// @param[in] chunkSettings for the requested chunk
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
@@ -81,6 +83,10 @@ class MemoryManager
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
+    /// @brief Returns the free chunks in the thread caches of a terminated process to the mempools
+    /// @param[in] pid of the terminated process
+    void releaseThreadCachesOfProcess(const uint32_t pid) noexcept;
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
@@ -88,19 +94,40 @@ class MemoryManager
   private:
     static uint64_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
 
+    /// @brief the size of the prefix of each chunk which is reserved for the embedded ChunkManagement; 0 when the
+    /// ChunkManagement is acquired from the separate chunk management pool
+    static uint64_t chunkManagementPrefixSize(const ChunkManagementLayout layout) noexcept;
+
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(BumpAllocator& managementAllocator,
                     BumpAllocator& chunkMemoryAllocator,
                     const greater_or_equal<uint64_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                    const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
+                    const greater_or_equal<uint32_t, 1> numberOfChunks,
+                    const uint32_t threadCacheCapacity = MemPool::NO_THREAD_CACHE,
+                    const NumaPlacement numaPlacement = NumaPlacement()) noexcept;
     void generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept;
+    void generateSizeClassTable() noexcept;
+    uint32_t findMemPoolIndex(const uint64_t requiredChunkSize) const noexcept;
+
+    /// @brief the size class of a chunk size is the number of bits required to represent 'chunkSize - 1', i.e. the
+    /// chunk sizes in (2^(n-1), 2^n] belong to size class n
+    static uint32_t sizeClass(const uint64_t chunkSize) noexcept;
 
   private:
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{std::numeric_limits<uint64_t>::digits + 1U};
+
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    ChunkManagementLayout m_chunkManagementLayout{ChunkManagementLayout::SEPARATE_POOL};
+    uint64_t m_chunkManagementPrefixSize{0U};
 
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     vector<MemPool, 1> m_chunkManagementPool;
+
+    MemPoolFallbackPolicy m_fallbackPolicy{MemPoolFallbackPolicy::NONE};
+    /// @brief index of the first mempool which can hold a chunk of the corresponding size class
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size lookup table in shared memory
+    uint32_t m_sizeClassToMemPoolIndex[NUMBER_OF_SIZE_CLASSES]{};
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
@@ -41,7 +41,10 @@ class MePooSegment
                  BumpAllocator& managementAllocator,
                  const PosixGroup& readerGroup,
                  const PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const bool useHugePages = false,
+                 const roudi::MemoryResidency memoryResidency = roudi::MemoryResidency::OFF,
+                 const NumaPlacement numaPlacement = NumaPlacement()) noexcept;
 
     PosixGroup getWriterGroup() const noexcept;
     PosixGroup getReaderGroup() const noexcept;
@@ -52,16 +55,30 @@ class MePooSegment
 
     uint64_t getSegmentSize() const noexcept;
 
+    /// @brief Returns the size of the pages which back the segment, this is the huge page size when the segment was
+    /// configured to use huge pages and they are available, otherwise the system page size
+    uint64_t getPageSize() const noexcept;
+
+    /// @brief Returns the NUMA node on which the start of the segment is placed or 'UNKNOWN_NUMA_NODE' if it cannot be
+    /// determined, e.g. since the platform does not support NUMA
+    int32_t getNumaNode() const noexcept;
+
+    static constexpr int32_t UNKNOWN_NUMA_NODE{-1};
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
                                                     const DomainId domainId,
-                                                    const PosixGroup& writerGroup) noexcept;
+                                                    const PosixGroup& writerGroup,
+                                                    const bool useHugePages,
+                                                    const roudi::MemoryResidency memoryResidency,
+                                                    const NumaPlacement numaPlacement) noexcept;
 
   protected:
     PosixGroup m_readerGroup;
     PosixGroup m_writerGroup;
     uint64_t m_segmentId{0};
     uint64_t m_segmentSize{0};
+    uint64_t m_pageSize{0};
     iox::mepoo::MemoryInfo m_memoryInfo;
     SharedMemoryObjectType m_sharedMemoryObject;
     MemoryManagerType m_memoryManager;
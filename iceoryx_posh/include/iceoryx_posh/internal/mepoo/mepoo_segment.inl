@@ -35,6 +35,9 @@ namespace mepoo
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 constexpr access_rights MePooSegment<SharedMemoryObjectType, MemoryManagerType>::SEGMENT_PERMISSIONS;
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+constexpr int32_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::UNKNOWN_NUMA_NODE;
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     const MePooConfig& mempoolConfig,
@@ -42,11 +45,15 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     BumpAllocator& managementAllocator,
     const PosixGroup& readerGroup,
     const PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const bool useHugePages,
+    const roudi::MemoryResidency memoryResidency,
+    const NumaPlacement numaPlacement) noexcept
     : m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
-    , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig, domainId, writerGroup))
+    , m_sharedMemoryObject(createSharedMemoryObject(
+          mempoolConfig, domainId, writerGroup, useHugePages, memoryResidency, numaPlacement))
 {
     using namespace detail;
     PosixAcl acl;
@@ -71,7 +78,12 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const DomainId domainId, const PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const DomainId domainId,
+    const PosixGroup& writerGroup,
+    const bool useHugePages,
+    const roudi::MemoryResidency memoryResidency,
+    const NumaPlacement numaPlacement) noexcept
 {
     return std::move(
         typename SharedMemoryObjectType::Builder()
@@ -94,6 +106,10 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
             .accessMode(AccessMode::ReadWrite)
             .openMode(OpenMode::PurgeAndCreate)
             .permissions(SEGMENT_PERMISSIONS)
+            .hugePages(useHugePages)
+            .prefault(memoryResidency != roudi::MemoryResidency::OFF)
+            .lockMemory(memoryResidency == roudi::MemoryResidency::PREFAULT_AND_LOCK)
+            .numaPlacement(numaPlacement)
             .create()
             .and_then([this](auto& sharedMemoryObject) {
                 auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
@@ -105,11 +121,12 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
                 }
                 this->m_segmentId = static_cast<uint64_t>(maybeSegmentId.value());
                 this->m_segmentSize = sharedMemoryObject.get_size().expect("Failed to get SHM size.");
+                this->m_pageSize = sharedMemoryObject.getPageSize();
 
                 IOX_LOG(Debug,
-                        "Roudi registered payload data segment " << iox::log::hex(sharedMemoryObject.getBaseAddress())
-                                                                 << " with size " << m_segmentSize << " to id "
-                                                                 << m_segmentId);
+                        "Roudi registered payload data segment "
+                            << iox::log::hex(sharedMemoryObject.getBaseAddress()) << " with size " << m_segmentSize
+                            << " and page size " << m_pageSize << " to id " << m_segmentId);
             })
             .or_else([](auto&) { IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT); })
             .value());
@@ -145,6 +162,19 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentSize;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getPageSize() const noexcept
+{
+    return m_pageSize;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline int32_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getNumaNode() const noexcept
+{
+    auto node = NumaPlacement::nodeOf(m_sharedMemoryObject.getBaseAddress());
+    return (node.has_value()) ? static_cast<int32_t>(node.value()) : UNKNOWN_NUMA_NODE;
+}
+
 } // namespace mepoo
 } // namespace iox
 
@@ -44,7 +44,8 @@ class SegmentManager
   public:
     SegmentManager(const SegmentConfig& segmentConfig,
                    const DomainId domainId,
-                   BumpAllocator* managementAllocator) noexcept;
+                   BumpAllocator* managementAllocator,
+                   const roudi::MemoryResidency memoryResidency = roudi::MemoryResidency::OFF) noexcept;
     ~SegmentManager() noexcept = default;
 
     SegmentManager(const SegmentManager& rhs) = delete;
@@ -60,11 +61,15 @@ class SegmentManager
                        uint64_t size,
                        bool isWritable,
                        uint64_t segmentId,
+                       bool useHugePages = false,
+                       roudi::MemoryResidency memoryResidency = roudi::MemoryResidency::OFF,
                        const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept
             : m_sharedMemoryName(sharedMemoryName)
             , m_size(size)
             , m_isWritable(isWritable)
             , m_segmentId(segmentId)
+            , m_useHugePages(useHugePages)
+            , m_memoryResidency(memoryResidency)
             , m_memoryInfo(memoryInfo)
 
         {
@@ -74,6 +79,8 @@ class SegmentManager
         uint64_t m_size{0};
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
+        bool m_useHugePages{false}; // the segment is backed by huge pages and should be mapped accordingly
+        roudi::MemoryResidency m_memoryResidency{roudi::MemoryResidency::OFF}; // residency configured by RouDi
         iox::mepoo::MemoryInfo m_memoryInfo; // we can specify additional info about a segments memory here
     };
 
@@ -88,6 +95,10 @@ class SegmentManager
     SegmentMappingContainer getSegmentMappings(const PosixUser& user) noexcept;
     SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const PosixUser& user) noexcept;
 
+    /// @brief Returns the free chunks in the thread caches of a terminated process to the mempools of all segments
+    /// @param[in] pid of the terminated process
+    void releaseThreadCachesOfProcess(const uint32_t pid) noexcept;
+
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredFullMemorySize(const SegmentConfig& config) noexcept;
@@ -95,6 +106,12 @@ class SegmentManager
   private:
     void createSegment(const SegmentConfig::SegmentEntry& segmentEntry, const DomainId domainId) noexcept;
 
+    /// @brief Returns the MePooConfig the segment is created with. The embedded ChunkManagement resides in the
+    /// payload segment, which is mapped read only by the members of the reader group. Since the readers have to
+    /// update the reference counters, the separate chunk management pool is used when the groups differ.
+    static MePooConfig effectiveMePooConfig(const SegmentConfig::SegmentEntry& segmentEntry) noexcept;
+    static bool isMappedReadOnlyByReaders(const SegmentConfig::SegmentEntry& segmentEntry) noexcept;
+
   private:
     template <typename MemoryManger, typename SegmentManager, typename PublisherPort>
     friend class roudi::MemPoolIntrospection;
@@ -102,6 +119,7 @@ class SegmentManager
     BumpAllocator* m_managementAllocator;
     vector<SegmentType, MAX_SHM_SEGMENTS> m_segmentContainer;
     bool m_createInterfaceEnabled{true};
+    roudi::MemoryResidency m_memoryResidency{roudi::MemoryResidency::OFF};
 };
 
 
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/assertions.hpp"
+#include "iox/detail/system_configuration.hpp"
 
 namespace iox
 {
@@ -30,8 +31,10 @@ namespace mepoo
 template <typename SegmentType>
 inline SegmentManager<SegmentType>::SegmentManager(const SegmentConfig& segmentConfig,
                                                    const DomainId domainId,
-                                                   BumpAllocator* managementAllocator) noexcept
+                                                   BumpAllocator* managementAllocator,
+                                                   const roudi::MemoryResidency memoryResidency) noexcept
     : m_managementAllocator(managementAllocator)
+    , m_memoryResidency(memoryResidency)
 {
     if (segmentConfig.m_sharedMemorySegments.capacity() > m_segmentContainer.capacity())
     {
@@ -53,12 +56,25 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
 {
     auto readerGroup = PosixGroup(segmentEntry.m_readerGroup);
     auto writerGroup = PosixGroup(segmentEntry.m_writerGroup);
-    m_segmentContainer.emplace_back(segmentEntry.m_mempoolConfig,
+    if (segmentEntry.m_mempoolConfig.m_chunkManagementLayout == ChunkManagementLayout::EMBEDDED
+        && isMappedReadOnlyByReaders(segmentEntry))
+    {
+        IOX_LOG(Warn,
+                "The segment of the writer group '"
+                    << segmentEntry.m_writerGroup << "' is mapped read only by the reader group '"
+                    << segmentEntry.m_readerGroup
+                    << "' which cannot update embedded reference counters; falling back to the separate chunk "
+                       "management pool.");
+    }
+    m_segmentContainer.emplace_back(effectiveMePooConfig(segmentEntry),
                                     domainId,
                                     *m_managementAllocator,
                                     readerGroup,
                                     writerGroup,
-                                    segmentEntry.m_memoryInfo);
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_useHugePages,
+                                    m_memoryResidency,
+                                    segmentEntry.m_numaPlacement);
 }
 
 template <typename SegmentType>
@@ -82,8 +98,12 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
                 // process
                 if (!foundInWriterGroup)
                 {
-                    mappingContainer.emplace_back(
-                        segment.getWriterGroup().getName(), segment.getSegmentSize(), true, segment.getSegmentId());
+                    mappingContainer.emplace_back(segment.getWriterGroup().getName(),
+                                                  segment.getSegmentSize(),
+                                                  true,
+                                                  segment.getSegmentId(),
+                                                  segment.getPageSize() > detail::pageSize(),
+                                                  m_memoryResidency);
                     foundInWriterGroup = true;
                 }
                 else
@@ -105,8 +125,12 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
                        return mapping.m_segmentId == segment.getSegmentId();
                    }) == mappingContainer.end())
             {
-                mappingContainer.emplace_back(
-                    segment.getWriterGroup().getName(), segment.getSegmentSize(), false, segment.getSegmentId());
+                mappingContainer.emplace_back(segment.getWriterGroup().getName(),
+                                              segment.getSegmentSize(),
+                                              false,
+                                              segment.getSegmentId(),
+                                              segment.getPageSize() > detail::pageSize(),
+                                              m_memoryResidency);
             }
         }
     }
@@ -139,13 +163,22 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const P
     return segmentInfo;
 }
 
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::releaseThreadCachesOfProcess(const uint32_t pid) noexcept
+{
+    for (auto& segment : m_segmentContainer)
+    {
+        segment.getMemoryManager().releaseThreadCachesOfProcess(pid);
+    }
+}
+
 template <typename SegmentType>
 uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const SegmentConfig& config) noexcept
 {
     uint64_t memorySize{0u};
     for (auto segment : config.m_sharedMemorySegments)
     {
-        memorySize += MemoryManager::requiredManagementMemorySize(segment.m_mempoolConfig);
+        memorySize += MemoryManager::requiredManagementMemorySize(effectiveMePooConfig(segment));
     }
     return memorySize;
 }
@@ -156,11 +189,30 @@ uint64_t SegmentManager<SegmentType>::requiredChunkMemorySize(const SegmentConfi
     uint64_t memorySize{0u};
     for (auto segment : config.m_sharedMemorySegments)
     {
-        memorySize += MemoryManager::requiredChunkMemorySize(segment.m_mempoolConfig);
+        memorySize += MemoryManager::requiredChunkMemorySize(effectiveMePooConfig(segment));
     }
     return memorySize;
 }
 
+template <typename SegmentType>
+inline MePooConfig
+SegmentManager<SegmentType>::effectiveMePooConfig(const SegmentConfig::SegmentEntry& segmentEntry) noexcept
+{
+    MePooConfig mePooConfig = segmentEntry.m_mempoolConfig;
+    if (isMappedReadOnlyByReaders(segmentEntry))
+    {
+        mePooConfig.m_chunkManagementLayout = ChunkManagementLayout::SEPARATE_POOL;
+    }
+    return mePooConfig;
+}
+
+template <typename SegmentType>
+inline bool
+SegmentManager<SegmentType>::isMappedReadOnlyByReaders(const SegmentConfig::SegmentEntry& segmentEntry) noexcept
+{
+    return segmentEntry.m_readerGroup != segmentEntry.m_writerGroup;
+}
+
 template <typename SegmentType>
 uint64_t SegmentManager<SegmentType>::requiredFullMemorySize(const SegmentConfig& config) noexcept
 {
@@ -29,6 +29,7 @@ namespace mepoo
 {
 template <typename>
 class SharedPointer;
+class ShmSafeUnmanagedChunk;
 
 /// @brief WARNING: SharedChunk is not thread safe! Don't share SharedChunk objects between threads! Use for each thread
 /// a separate copy
@@ -50,6 +51,12 @@ class SharedChunk
 
     ChunkManagement* release() noexcept;
 
+    /// @brief Acquires additional references to the chunk with a single atomic operation, e.g. to deliver the chunk
+    /// to multiple queues. Each reserved reference must be handed over to exactly one ShmSafeUnmanagedChunk with the
+    /// 'AdoptReservedReference' constructor, which takes over the ownership of the reference.
+    /// @param[in] count is the number of references to reserve
+    void reserveReferences(const uint64_t count) noexcept;
+
     bool operator==(const SharedChunk& rhs) const noexcept;
     /// @todo iox-#1617 use the newtype pattern to avoid the void pointer
     bool operator==(const void* const rhs) const noexcept;
@@ -61,6 +68,7 @@ class SharedChunk
 
     template <typename>
     friend class SharedPointer;
+    friend class ShmSafeUnmanagedChunk;
 
   private:
     void decrementReferenceCounter() noexcept;
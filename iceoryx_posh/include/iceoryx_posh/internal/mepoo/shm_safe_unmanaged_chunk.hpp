@@ -24,6 +24,14 @@ namespace iox
 {
 namespace mepoo
 {
+/// @brief struct used to select the constructor of the ShmSafeUnmanagedChunk which adopts a reference that was
+/// reserved with 'SharedChunk::reserveReferences'
+struct AdoptReservedReference_t
+{
+    explicit AdoptReservedReference_t() = default;
+};
+constexpr AdoptReservedReference_t AdoptReservedReference{};
+
 /// @brief This class to safely store a chunk in shared memory. To be able to do so, torn writes/reads need to
 /// prevented, since they create Frankenstein objects. Therefore, the class must not be larger than 64 bits and
 /// trivially copy-able in case an application dies while writing this and RouDi needs to clean up.
@@ -35,6 +43,10 @@ class ShmSafeUnmanagedChunk
     /// @brief takes a SharedChunk without decrementing the chunk reference counter
     ShmSafeUnmanagedChunk(SharedChunk chunk) noexcept;
 
+    /// @brief takes one of the references which were reserved with 'SharedChunk::reserveReferences' without changing
+    /// the chunk reference counter; the SharedChunk keeps its own reference
+    ShmSafeUnmanagedChunk(const SharedChunk& chunk, AdoptReservedReference_t) noexcept;
+
     /// @brief Creates a SharedChunk without incrementing the chunk reference counter and invalidates itself
     SharedChunk releaseToSharedChunk() noexcept;
 
@@ -20,9 +20,11 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iox/deadline_timer.hpp"
 #include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/not_null.hpp"
+#include "iox/optional.hpp"
 
 #include <algorithm>
 #include <iterator>
@@ -50,6 +52,10 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
+/// The waiting threads of the queues are woken up after a chunk was delivered to all queues, therefore a condition
+/// variable which is shared by multiple queues is woken up only once per delivery.
+/// With the LockFreePolicy the senders access the queues without a lock while modifications of the queues are
+/// published RCU-like, see the ChunkDistributorData specialization. This variant has no history.
 /// @todo iox-#1713 There are currently some challenges:
 /// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
 /// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
@@ -68,6 +74,7 @@ class ChunkDistributor
     using MemberType_t = ChunkDistributorDataType;
     using ChunkQueueData_t = typename ChunkDistributorDataType::ChunkQueueData_t;
     using ChunkQueuePusher_t = typename ChunkDistributorDataType::ChunkQueuePusher_t;
+    using QueueContainer_t = typename ChunkDistributorDataType::QueueContainer_t;
 
     explicit ChunkDistributor(not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept;
 
@@ -140,11 +147,27 @@ class ChunkDistributor
     void cleanup() noexcept;
 
   protected:
+    /// @brief a condition variable whose notification was set active but whose waiting thread is not yet woken up
+    struct PendingWakeUp
+    {
+        ConditionVariableData* conditionVariable{nullptr};
+        ChunkQueueData_t* queue{nullptr};
+    };
+    using PendingWakeUpContainer_t =
+        vector<PendingWakeUp, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES>;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief wakes up each condition variable of the pending wake-ups once
+    void wakeUpConditionVariables(const PendingWakeUpContainer_t& pendingWakeUps) noexcept;
+
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
+    static optional<uint32_t> findQueueIndex(const QueueContainer_t& queues,
+                                             const UniqueId uniqueQueueId,
+                                             const uint32_t lastKnownQueueIndex) noexcept;
+
   private:
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
@@ -51,109 +51,133 @@ inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_t* const> queueToAdd,
                                                         const uint64_t requestedHistory) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
-    const auto alreadyKnownReceiver =
-        std::find_if(getMembers()->m_queues.begin(),
-                     getMembers()->m_queues.end(),
-                     [&](const RelativePointer<ChunkQueueData_t> queue) { return queue.get() == queueToAdd; });
+    expected<void, ChunkDistributorError> result = ok();
+    getMembers()->modifyQueues([&](QueueContainer_t& queues) -> bool {
+        const auto alreadyKnownReceiver =
+            std::find_if(queues.begin(), queues.end(), [&](const RelativePointer<ChunkQueueData_t> queue) {
+                return queue.get() == queueToAdd;
+            });
+
+        // check if the queue is not already in the list
+        if (alreadyKnownReceiver != queues.end())
+        {
+            return false;
+        }
 
-    // check if the queue is not already in the list
-    if (alreadyKnownReceiver == getMembers()->m_queues.end())
-    {
-        if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
+        if (queues.size() >= queues.capacity())
         {
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
-            // pushing will be fine
-            getMembers()->m_queues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
+            // that's not the fault of the chunk distributor user, we report a moderate error and indicate that
+            // adding the queue was not possible
+            IOX_REPORT(PoshError::POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER, iox::er::RUNTIME_ERROR);
 
-            const auto currChunkHistorySize = getMembers()->m_history.size();
+            result = err(ChunkDistributorError::QUEUE_CONTAINER_OVERFLOW);
+            return false;
+        }
 
-            if (requestedHistory > getMembers()->m_historyCapacity)
-            {
-                IOX_LOG(Warn,
-                        "Chunk history request exceeds history capacity! Request is "
-                            << requestedHistory << ". Capacity is " << getMembers()->m_historyCapacity << ".");
-            }
+        // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
+        // pushing will be fine
+        queues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
 
-            // if the current history is large enough we send the requested number of chunks, else we send the
-            // total history
-            const auto startIndex =
-                (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
-            for (auto i = startIndex; i < currChunkHistorySize; ++i)
-            {
-                pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
-            }
+        typename MemberType_t::LockGuard_t lock(*getMembers());
 
-            return ok();
-        }
-        else
+        const auto currChunkHistorySize = getMembers()->m_history.size();
+
+        if (requestedHistory > getMembers()->m_historyCapacity)
         {
-            // that's not the fault of the chunk distributor user, we report a moderate error and indicate that
-            // adding the queue was not possible
-            IOX_REPORT(PoshError::POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER, iox::er::RUNTIME_ERROR);
+            IOX_LOG(Warn,
+                    "Chunk history request exceeds history capacity! Request is "
+                        << requestedHistory << ". Capacity is " << getMembers()->m_historyCapacity << ".");
+        }
 
-            return err(ChunkDistributorError::QUEUE_CONTAINER_OVERFLOW);
+        // if the current history is large enough we send the requested number of chunks, else we send the
+        // total history
+        const auto startIndex =
+            (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
+        for (auto i = startIndex; i < currChunkHistorySize; ++i)
+        {
+            pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
         }
-    }
 
-    return ok();
+        return true;
+    });
+
+    return result;
 }
 
 template <typename ChunkDistributorDataType>
 inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueData_t* const> queueToRemove) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    expected<void, ChunkDistributorError> result = ok();
+    getMembers()->modifyQueues([&](QueueContainer_t& queues) -> bool {
+        const auto iter = std::find(queues.begin(), queues.end(), static_cast<ChunkQueueData_t* const>(queueToRemove));
+        if (iter == queues.end())
+        {
+            result = err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+            return false;
+        }
 
-    const auto iter = std::find(getMembers()->m_queues.begin(),
-                                getMembers()->m_queues.end(),
-                                static_cast<ChunkQueueData_t* const>(queueToRemove));
-    if (iter != getMembers()->m_queues.end())
-    {
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
-        getMembers()->m_queues.erase(iter);
+        queues.erase(iter);
+        return true;
+    });
 
-        return ok();
-    }
-    else
-    {
-        return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
-    }
+    return result;
 }
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
-    getMembers()->m_queues.clear();
+    getMembers()->modifyQueues([](QueueContainer_t& queues) -> bool {
+        queues.clear();
+        return true;
+    });
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    typename MemberType_t::QueueReader queueReader(*getMembers());
 
-    return !getMembers()->m_queues.empty();
+    return !queueReader.queues().empty();
 }
 
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
-    using QueueContainer = decltype(getMembers()->m_queues);
-    QueueContainer fullQueuesAwaitingDelivery;
+    QueueContainer_t fullQueuesAwaitingDelivery;
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        typename MemberType_t::QueueReader queueReader(*getMembers());
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+        // the references for all queues are acquired with a single atomic operation instead of one per queue; each
+        // push consumes exactly one of them, either by storing it in the queue or by releasing it when the queue is
+        // full, therefore no reference is left over
+        chunk.reserveReferences(queueReader.queues().size());
+
+        // the waiting threads are woken up after all queues were served, so that queues which share a condition
+        // variable, e.g. by being attached to the same WaitSet, cause only a single wake-up
+        PendingWakeUpContainer_t pendingWakeUps;
+
         // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+        for (auto& queue : queueReader.queues())
         {
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-            if (pushToQueue(queue.get(), chunk))
+            mepoo::ShmSafeUnmanagedChunk reservedChunk{chunk, mepoo::AdoptReservedReference};
+            ConditionVariableData* attachedConditionVariable{nullptr};
+            bool wasPushed =
+                ChunkQueuePusher_t(queue.get()).pushWithDeferredWakeUp(reservedChunk, attachedConditionVariable);
+            if (attachedConditionVariable != nullptr)
+            {
+                // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : there is at most one
+                // pending wake-up per queue, so the capacity is sufficient
+                pendingWakeUps.push_back({attachedConditionVariable, queue.get()});
+            }
+
+            if (wasPushed)
             {
                 ++numberOfQueuesTheChunkWasDeliveredTo;
             }
@@ -170,46 +194,61 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
                 }
             }
         }
+
+        wakeUpConditionVariables(pendingWakeUps);
     }
 
-    // busy waiting until every queue is served
+    // busy waiting for PRODUCER_SPIN_DURATION and sleeping afterwards until every queue is served; the spin phase is
+    // only started when a queue is full to keep the time measurement out of the common path
     iox::detail::adaptive_wait adaptiveWait;
+    optional<deadline_timer> spinPhase;
     while (!fullQueuesAwaitingDelivery.empty())
     {
-        adaptiveWait.wait();
+        if (!spinPhase.has_value())
+        {
+            spinPhase.emplace(PRODUCER_SPIN_DURATION);
+        }
+        bool mayBlock = spinPhase->hasExpired();
+        if (!mayBlock)
+        {
+            adaptiveWait.wait();
+        }
         {
             // create intersection of current queues and fullQueuesAwaitingDelivery
             // reason: it is possible that since the last iteration some subscriber have already unsubscribed
             //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            QueueContainer remainingQueues;
-            using QueueContainerValue = typename QueueContainer::value_type;
-            auto greaterThan = [](const QueueContainerValue& a, const QueueContainerValue& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#endif
-            std::sort(fullQueuesAwaitingDelivery.begin(), fullQueuesAwaitingDelivery.end(), greaterThan);
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic pop
-#endif
-
-            std::set_intersection(getMembers()->m_queues.begin(),
-                                  getMembers()->m_queues.end(),
-                                  fullQueuesAwaitingDelivery.begin(),
-                                  fullQueuesAwaitingDelivery.end(),
-                                  std::back_inserter(remainingQueues),
-                                  greaterThan);
+            // the stored queues must not be modified by a sender, therefore they are searched instead of sorted
+            typename MemberType_t::QueueReader queueReader(*getMembers());
+            const auto& currentQueues = queueReader.queues();
+            QueueContainer_t remainingQueues;
+            for (auto& queue : fullQueuesAwaitingDelivery)
+            {
+                auto isSameQueue = [&](const typename QueueContainer_t::value_type& currentQueue) {
+                    return currentQueue.get() == queue.get();
+                };
+                if (std::find_if(currentQueues.begin(), currentQueues.end(), isSameQueue) != currentQueues.end())
+                {
+                    remainingQueues.push_back(queue);
+                }
+            }
             fullQueuesAwaitingDelivery.clear();
 
-            // deliver to remaining queues
+            // deliver to remaining queues; the producer sleeps on at most one queue per iteration so that the
+            // stored queues are checked again at least every PRODUCER_BLOCKING_TIMEOUT
             for (auto& queue : remainingQueues)
             {
-                if (pushToQueue(queue.get(), chunk))
+                bool wasPushed{false};
+                if (mayBlock)
+                {
+                    mayBlock = false;
+                    wasPushed = ChunkQueuePusher_t(queue.get()).pushOrWaitForSpace(chunk, PRODUCER_BLOCKING_TIMEOUT);
+                }
+                else
+                {
+                    wasPushed = pushToQueue(queue.get(), chunk);
+                }
+
+                if (wasPushed)
                 {
                     ++numberOfQueuesTheChunkWasDeliveredTo;
                 }
@@ -226,6 +265,32 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::wakeUpConditionVariables(
+    const PendingWakeUpContainer_t& pendingWakeUps) noexcept
+{
+    vector<const ConditionVariableData*, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES> wokenUp;
+
+    // a condition variable is woken up via the last queue it is attached to; when it was detached from this queue in
+    // the meantime, one of the preceding queues it was attached to is used
+    for (auto i = pendingWakeUps.size(); i > 0U; --i)
+    {
+        const auto& pendingWakeUp = pendingWakeUps[i - 1U];
+        const auto conditionVariable = pendingWakeUp.conditionVariable;
+        if (std::find(wokenUp.begin(), wokenUp.end(), conditionVariable) != wokenUp.end())
+        {
+            continue;
+        }
+
+        if (ChunkQueuePusher_t(pendingWakeUp.queue).wakeUpIfAttachedTo(conditionVariable))
+        {
+            // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : there are not more condition
+            // variables than pending wake-ups
+            wokenUp.push_back(conditionVariable);
+        }
+    }
+}
+
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<ChunkQueueData_t* const> queue,
                                                                     mepoo::SharedChunk chunk) noexcept
@@ -240,25 +305,44 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
                                                            mepoo::SharedChunk chunk [[maybe_unused]]) noexcept
 {
     bool retry{false};
+    iox::detail::adaptive_wait adaptiveWait;
+    optional<deadline_timer> spinPhase;
     do
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        bool mayBlock{false};
+        if (retry)
+        {
+            if (!spinPhase.has_value())
+            {
+                spinPhase.emplace(PRODUCER_SPIN_DURATION);
+            }
+            mayBlock = spinPhase->hasExpired();
+            if (!mayBlock)
+            {
+                adaptiveWait.wait();
+            }
+        }
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+        typename MemberType_t::QueueReader queueReader(*getMembers());
+
+        auto queueIndex = findQueueIndex(queueReader.queues(), uniqueQueueId, lastKnownQueueIndex);
 
         if (!queueIndex.has_value())
         {
             return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
         }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+        auto& queue = queueReader.queues()[queueIndex.value()];
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
 
         bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
         retry = false;
-        if (!pushToQueue(queue.get(), chunk))
+        bool wasPushed = (isBlockingQueue && mayBlock)
+                             ? ChunkQueuePusher_t(queue.get()).pushOrWaitForSpace(chunk, PRODUCER_BLOCKING_TIMEOUT)
+                             : pushToQueue(queue.get(), chunk);
+        if (!wasPushed)
         {
             if (isBlockingQueue)
             {
@@ -279,10 +363,17 @@ inline optional<uint32_t>
 ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQueueId,
                                                           const uint32_t lastKnownQueueIndex) const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    typename MemberType_t::QueueReader queueReader(*getMembers());
 
-    auto& queues = getMembers()->m_queues;
+    return findQueueIndex(queueReader.queues(), uniqueQueueId, lastKnownQueueIndex);
+}
 
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueueIndex(const QueueContainer_t& queues,
+                                                           const UniqueId uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex) noexcept
+{
     if (queues.size() > lastKnownQueueIndex && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
     {
         return lastKnownQueueIndex;
@@ -350,6 +441,8 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
 {
+    getMembers()->releaseStaleQueueReaders();
+
     if (getMembers()->tryLock())
     {
         clearHistory();
@@ -361,6 +454,7 @@ inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
         /// and a sending application dies when having the lock for sending. If the RouDi daemon wants to
         /// cleanup or does discovery changes we have a deadlock or an exception when destroying the mutex
         /// As long as we don't have a multi-threaded lock-free ChunkDistributor or another concept we die here
+        /// The LockFreePolicy variant is not affected since its senders never hold the lock
         IOX_REPORT_FATAL(PoshError::POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION);
     }
 }
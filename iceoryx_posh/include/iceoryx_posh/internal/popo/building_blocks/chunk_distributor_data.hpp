@@ -19,9 +19,12 @@
 
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/algorithm.hpp"
+#include "iox/atomic.hpp"
+#include "iox/detail/adaptive_wait.hpp"
 #include "iox/logging.hpp"
 #include "iox/mutex.hpp"
 #include "iox/relative_pointer.hpp"
@@ -50,6 +53,34 @@ struct ChunkDistributorData : public LockingPolicy
     using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
     QueueContainer_t m_queues;
 
+    /// @brief Provides read access to the stored queues. The lock is held during the lifetime of the QueueReader
+    class QueueReader
+    {
+      public:
+        explicit QueueReader(const ThisType_t& data) noexcept;
+
+        QueueReader(const QueueReader&) = delete;
+        QueueReader(QueueReader&&) = delete;
+        QueueReader& operator=(const QueueReader&) = delete;
+        QueueReader& operator=(QueueReader&&) = delete;
+        ~QueueReader() noexcept = default;
+
+        const QueueContainer_t& queues() const noexcept;
+
+      private:
+        LockGuard_t m_lock;
+        const QueueContainer_t& m_queues;
+    };
+
+    /// @brief Calls the modifier with the stored queues while holding the lock
+    /// @param[in] modifier callable with the signature 'bool(QueueContainer_t&)' which returns whether it changed the
+    /// queues
+    template <typename Modifier>
+    void modifyQueues(Modifier&& modifier) noexcept;
+
+    /// @brief Nothing to release for the lock based variant, a lock held by a terminated sender is detected by tryLock
+    void releaseStaleQueueReaders() noexcept;
+
     /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
     /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
@@ -60,6 +91,99 @@ struct ChunkDistributorData : public LockingPolicy
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
 };
 
+/// @brief Variant of the ChunkDistributorData whose queues can be accessed by the senders without a lock. The queues
+/// are stored in two queue sets. A modification is applied to a copy of the active set which is then published by
+/// atomically swapping the active index (RCU-like). Senders only register as reader of the set they are iterating,
+/// therefore they never block on discovery changes and a sender which terminates while delivering cannot leave a
+/// locked mutex behind.
+/// The history is not supported by this variant, since a late joining queue would need a consistent view of the
+/// history while the senders are modifying it. It is intended for the request and response path of clients and
+/// servers, which have no history and where multiple threads are sending concurrently.
+/// @note Modifications of the queues are serialized among each other, but they wait until no sender uses the replaced
+/// queue set anymore. This grace period ensures that a removed queue is not accessed once tryRemoveQueue returned.
+/// Each sender registers in a reader slot together with its pid, therefore the grace period only ends early for
+/// senders whose process does not exist anymore. A sender which is alive but stalled delays the modification.
+template <typename ChunkDistributorDataProperties, typename ChunkQueuePusherType>
+struct ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>
+    : public LockFreePolicy
+{
+    using ThisType_t = ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>;
+    using LockGuard_t = std::lock_guard<const ThisType_t>;
+    using ChunkQueuePusher_t = ChunkQueuePusherType;
+    using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
+    using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
+
+    /// @brief the maximum number of threads which can deliver concurrently; further senders wait for a free slot
+    static constexpr uint32_t MAX_QUEUE_READERS{32U};
+
+    ChunkDistributorData(const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
+
+    const uint64_t m_historyCapacity;
+
+    using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
+
+    /// @brief Provides read access to the active queue set. The queue set is not modified during the lifetime of the
+    /// QueueReader, concurrent modifications are applied to the other queue set.
+    class QueueReader
+    {
+      public:
+        explicit QueueReader(const ThisType_t& data) noexcept;
+
+        QueueReader(const QueueReader&) = delete;
+        QueueReader(QueueReader&&) = delete;
+        QueueReader& operator=(const QueueReader&) = delete;
+        QueueReader& operator=(QueueReader&&) = delete;
+        ~QueueReader() noexcept;
+
+        const QueueContainer_t& queues() const noexcept;
+
+      private:
+        bool tryAcquireReaderSlot(const uint64_t registration) noexcept;
+
+        const ThisType_t& m_data;
+        uint64_t m_queueSetIndex{0U};
+        uint32_t m_readerSlot{0U};
+    };
+
+    /// @brief Calls the modifier with a copy of the active queue set and publishes the copy if the modifier changed it.
+    /// Returns after the grace period of the replaced queue set
+    /// @param[in] modifier callable with the signature 'bool(QueueContainer_t&)' which returns whether it changed the
+    /// queues
+    template <typename Modifier>
+    void modifyQueues(Modifier&& modifier) noexcept;
+
+    /// @brief Resets the reader registrations of senders which were terminated while delivering a chunk. Must only be
+    /// called when no sender is active anymore, e.g. when RouDi cleans up the port of a terminated application.
+    /// Modifications also reclaim the reader slots of terminated senders on their own when they wait for them.
+    void releaseStaleQueueReaders() noexcept;
+
+    /// @note always empty since the history is not supported by this variant
+    using HistoryContainer_t = vector<mepoo::ShmSafeUnmanagedChunk, 1U>;
+    HistoryContainer_t m_history;
+    const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+
+  private:
+    void waitForReadersOfQueueSet(const uint64_t queueSetIndex) const noexcept;
+
+    /// @brief a reader slot contains the pid of the sender, an epoch which distinguishes the registrations of a slot
+    /// and the index of the queue set the sender is iterating
+    static constexpr uint64_t NO_QUEUE_READER{0U};
+    static constexpr uint64_t PID_SHIFT{32U};
+    static constexpr uint64_t EPOCH_SHIFT{1U};
+    static constexpr uint64_t EPOCH_MASK{0x7FFFFFFFU};
+    static constexpr uint64_t QUEUE_SET_MASK{1U};
+    static uint64_t encodeQueueReader(const uint32_t pid, const uint32_t epoch, const uint64_t queueSetIndex) noexcept;
+
+    static constexpr uint64_t NUMBER_OF_QUEUE_SETS{2U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size storage in shared memory
+    QueueContainer_t m_queueSets[NUMBER_OF_QUEUE_SETS];
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size storage in shared memory
+    mutable concurrent::Atomic<uint64_t> m_queueReaders[MAX_QUEUE_READERS];
+    mutable concurrent::Atomic<uint32_t> m_queueReaderEpoch{0U};
+    concurrent::Atomic<uint64_t> m_activeQueueSet{0U};
+    concurrent::Atomic<bool> m_isModifyingQueues{false};
+};
+
 } // namespace popo
 } // namespace iox
 
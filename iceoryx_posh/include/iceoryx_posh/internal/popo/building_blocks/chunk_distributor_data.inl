@@ -46,6 +46,200 @@ inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, Chunk
     }
 }
 
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::QueueReader::
+    QueueReader(const ThisType_t& data) noexcept
+    : m_lock(data)
+    , m_queues(data.m_queues)
+{
+}
+
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+inline const typename ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::
+    QueueContainer_t&
+    ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::QueueReader::queues()
+        const noexcept
+{
+    return m_queues;
+}
+
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+template <typename Modifier>
+inline void ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::modifyQueues(
+    Modifier&& modifier) noexcept
+{
+    LockGuard_t lock(*this);
+    modifier(m_queues);
+}
+
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+inline void ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::
+    releaseStaleQueueReaders() noexcept
+{
+}
+
+template <typename ChunkDistributorDataProperties, typename ChunkQueuePusherType>
+inline ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>::ChunkDistributorData(
+    const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity) noexcept
+    : LockFreePolicy()
+    , m_historyCapacity(0U)
+    , m_consumerTooSlowPolicy(policy)
+{
+    if (historyCapacity != 0U)
+    {
+        IOX_LOG(Warn,
+                "The lock-free chunk distributor does not support a history, reducing it from " << historyCapacity
+                                                                                                 << " to 0");
+    }
+
+    for (auto& reader : m_queueReaders)
+    {
+        reader.store(NO_QUEUE_READER, std::memory_order_relaxed);
+    }
+}
+
+template <typename ChunkDistributorDataProperties, typename ChunkQueuePusherType>
+inline uint64_t
+ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>::encodeQueueReader(
+    const uint32_t pid, const uint32_t epoch, const uint64_t queueSetIndex) noexcept
+{
+    return (static_cast<uint64_t>(pid) << PID_SHIFT) | ((static_cast<uint64_t>(epoch) & EPOCH_MASK) << EPOCH_SHIFT)
+           | (queueSetIndex & QUEUE_SET_MASK);
+}
+
+template <typename ChunkDistributorDataProperties, typename ChunkQueuePusherType>
+inline ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>::QueueReader::
+    QueueReader(const ThisType_t& data) noexcept
+    : m_data(data)
+{
+    const auto pid = LockFreePolicy::currentProcessId();
+    const auto epoch = m_data.m_queueReaderEpoch.fetch_add(1U, std::memory_order_relaxed);
+
+    m_queueSetIndex = m_data.m_activeQueueSet.load(std::memory_order_seq_cst);
+    iox::detail::adaptive_wait adaptiveWait;
+    while (!tryAcquireReaderSlot(encodeQueueReader(pid, epoch, m_queueSetIndex)))
+    {
+        adaptiveWait.wait();
+    }
+
+    // a writer could publish the other queue set between loading the index and registering as reader; the writer
+    // might then already have waited for the readers of this set, therefore the registration is only valid when
+    // the set is still the active one afterwards
+    for (auto activeQueueSet = m_data.m_activeQueueSet.load(std::memory_order_seq_cst);
+         activeQueueSet != m_queueSetIndex;
+         activeQueueSet = m_data.m_activeQueueSet.load(std::memory_order_seq_cst))
+    {
+        m_queueSetIndex = activeQueueSet;
+        m_data.m_queueReaders[m_readerSlot].store(encodeQueueReader(pid, epoch, m_queueSetIndex),
+                                                  std::memory_order_seq_cst);
+    }
+}
+
+template <typename ChunkDistributorDataProperties, typename ChunkQueuePusherType>
+inline bool ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>::QueueReader::
+    tryAcquireReaderSlot(const uint64_t registration) noexcept
+{
+    for (m_readerSlot = 0U; m_readerSlot < MAX_QUEUE_READERS; ++m_readerSlot)
+    {
+        auto freeSlot = NO_QUEUE_READER;
+        if (m_data.m_queueReaders[m_readerSlot].compare_exchange_strong(
+                freeSlot, registration, std::memory_order_seq_cst))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename ChunkDistributorDataProperties, typename ChunkQueuePusherType>
+inline ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>::QueueReader::
+    ~QueueReader() noexcept
+{
+    m_data.m_queueReaders[m_readerSlot].store(NO_QUEUE_READER, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataProperties, typename ChunkQueuePusherType>
+inline const typename ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>::
+    QueueContainer_t&
+    ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>::QueueReader::queues()
+        const noexcept
+{
+    return m_data.m_queueSets[m_queueSetIndex];
+}
+
+template <typename ChunkDistributorDataProperties, typename ChunkQueuePusherType>
+template <typename Modifier>
+inline void ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>::modifyQueues(
+    Modifier&& modifier) noexcept
+{
+    iox::detail::adaptive_wait adaptiveWait;
+    bool isModifyingQueues{false};
+    while (!m_isModifyingQueues.compare_exchange_weak(
+        isModifyingQueues, true, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        isModifyingQueues = false;
+        adaptiveWait.wait();
+    }
+
+    const auto activeQueueSet = m_activeQueueSet.load(std::memory_order_relaxed);
+    const auto inactiveQueueSet = (activeQueueSet + 1U) % NUMBER_OF_QUEUE_SETS;
+
+    // senders which registered for the inactive set before the previous modification must have left it before
+    // it can be overwritten
+    waitForReadersOfQueueSet(inactiveQueueSet);
+
+    m_queueSets[inactiveQueueSet] = m_queueSets[activeQueueSet];
+    if (modifier(m_queueSets[inactiveQueueSet]))
+    {
+        m_activeQueueSet.store(inactiveQueueSet, std::memory_order_seq_cst);
+
+        // grace period; afterwards no sender accesses the queues which were removed by the modification
+        waitForReadersOfQueueSet(activeQueueSet);
+    }
+
+    m_isModifyingQueues.store(false, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataProperties, typename ChunkQueuePusherType>
+inline void ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>::
+    waitForReadersOfQueueSet(const uint64_t queueSetIndex) const noexcept
+{
+    for (auto& reader : m_queueReaders)
+    {
+        iox::detail::adaptive_wait adaptiveWait;
+        for (auto registration = reader.load(std::memory_order_seq_cst);
+             registration != NO_QUEUE_READER && (registration & QUEUE_SET_MASK) == queueSetIndex;
+             registration = reader.load(std::memory_order_seq_cst))
+        {
+            // only a sender whose process does not exist anymore is skipped; a stalled sender might still access
+            // the queues of the set
+            const auto pid = static_cast<uint32_t>(registration >> PID_SHIFT);
+            if (!LockFreePolicy::isProcessAlive(pid))
+            {
+                if (reader.compare_exchange_strong(registration, NO_QUEUE_READER, std::memory_order_seq_cst))
+                {
+                    IOX_LOG(Warn,
+                            "Released the queue set of a chunk distributor which was still used by the terminated "
+                            "process with pid "
+                                << pid);
+                }
+                continue;
+            }
+            adaptiveWait.wait();
+        }
+    }
+}
+
+template <typename ChunkDistributorDataProperties, typename ChunkQueuePusherType>
+inline void ChunkDistributorData<ChunkDistributorDataProperties, LockFreePolicy, ChunkQueuePusherType>::
+    releaseStaleQueueReaders() noexcept
+{
+    for (auto& reader : m_queueReaders)
+    {
+        reader.store(NO_QUEUE_READER, std::memory_order_seq_cst);
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/atomic.hpp"
 #include "iox/detail/unique_id.hpp"
@@ -50,6 +51,12 @@ struct ChunkQueueData : public LockingPolicy
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief posted by the consumer when it frees a slot while producers are waiting for it; only created for queues
+    /// with QueueFullPolicy::BLOCK_PRODUCER
+    optional<build::InterProcessSemaphore> m_spaceAvailableSemaphore;
+    /// @brief number of producers which are waiting on m_spaceAvailableSemaphore
+    concurrent::Atomic<uint64_t> m_numberOfWaitingProducers{0U};
 };
 
 } // namespace popo
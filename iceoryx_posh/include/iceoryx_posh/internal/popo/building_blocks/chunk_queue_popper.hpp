@@ -97,6 +97,8 @@ class ChunkQueuePopper
     MemberType_t* getMembers() noexcept;
 
   private:
+    void notifyWaitingProducers() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
@@ -53,6 +53,8 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        notifyWaitingProducers();
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
         auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
@@ -118,11 +120,37 @@ inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getMaximumCapacity() const
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
 {
+    bool hasFreedSlots{false};
     while (auto maybeUnmanagedChunk = getMembers()->m_queue.pop())
     {
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
         // side effect here and return value does not need to be evaluated
         maybeUnmanagedChunk.value().releaseToSharedChunk();
+        hasFreedSlots = true;
+    }
+
+    if (hasFreedSlots)
+    {
+        notifyWaitingProducers();
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::notifyWaitingProducers() noexcept
+{
+    // only queues with the BLOCK_PRODUCER policy have a semaphore; the others skip the fence
+    if (!getMembers()->m_spaceAvailableSemaphore.has_value())
+    {
+        return;
+    }
+
+    // pairs with the fence in ChunkQueuePusher::pushOrWaitForSpace
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_numberOfWaitingProducers.load(std::memory_order_relaxed) > 0U)
+    {
+        getMembers()->m_spaceAvailableSemaphore->post().or_else([](auto) {
+            IOX_LOG(Error, "Unable to wake up the producers which are waiting for a free slot in the chunk queue!");
+        });
     }
 }
 
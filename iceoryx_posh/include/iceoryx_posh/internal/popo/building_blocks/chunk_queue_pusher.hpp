@@ -18,8 +18,10 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_PUSHER_HPP
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iox/duration.hpp"
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 
@@ -50,6 +52,33 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push a chunk which already owns a reference to the chunk queue; the reference is either stored in the
+    /// queue or released when the queue is full
+    /// @param[in] chunk which owns a reference to the chunk
+    /// @return false if a queue overflow occurred, otherwise true
+    bool push(mepoo::ShmSafeUnmanagedChunk chunk) noexcept;
+
+    /// @brief like push(ShmSafeUnmanagedChunk) but the notification of the attached condition variable is only set
+    /// active; the waiting thread must be woken up afterwards with wakeUpIfAttachedTo
+    /// @param[in] chunk which owns a reference to the chunk
+    /// @param[out] attachedConditionVariable is set to the attached condition variable or to nullptr if there is none
+    /// @return false if a queue overflow occurred, otherwise true
+    bool pushWithDeferredWakeUp(mepoo::ShmSafeUnmanagedChunk chunk,
+                                ConditionVariableData*& attachedConditionVariable) noexcept;
+
+    /// @brief wakes up the thread waiting on the provided condition variable if it is still attached to the queue
+    /// @param[in] conditionVariable which was returned by pushWithDeferredWakeUp
+    /// @return true if the condition variable is attached and was woken up, otherwise false
+    bool wakeUpIfAttachedTo(const ConditionVariableData* const conditionVariable) noexcept;
+
+    /// @brief push a new chunk to the chunk queue; when the queue is full, the calling thread sleeps until the consumer
+    /// frees a slot or the timeout has passed and tries once more. For queues without QueueFullPolicy::BLOCK_PRODUCER
+    /// this is the same as push
+    /// @param[in] chunk shared chunk object
+    /// @param[in] timeout the maximum time to wait for a free slot
+    /// @return false if the queue is still full, otherwise true
+    bool pushOrWaitForSpace(mepoo::SharedChunk chunk, const units::Duration timeout) noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
@@ -58,6 +87,8 @@ class ChunkQueuePusher
     MemberType_t* getMembers() noexcept;
 
   private:
+    bool pushToQueue(mepoo::ShmSafeUnmanagedChunk chunk) noexcept;
+
     MemberType_t* m_chunkQueueDataPtr{nullptr};
 };
 
@@ -17,6 +17,9 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_PUSHER_INL
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_PUSHER_INL
 
+#include "iox/logging.hpp"
+
+#include <atomic>
 
 namespace iox
 {
@@ -45,16 +48,13 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
 {
-    auto pushRet = getMembers()->m_queue.push(chunk);
-    bool hasQueueOverflow = false;
+    return push(mepoo::ShmSafeUnmanagedChunk(std::move(chunk)));
+}
 
-    // drop the chunk if one is returned by an overflow
-    if (pushRet.has_value())
-    {
-        pushRet.value().releaseToSharedChunk();
-        // tell the ChunkDistributor that we had an overflow and dropped a sample
-        hasQueueOverflow = true;
-    }
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::ShmSafeUnmanagedChunk chunk) noexcept
+{
+    bool hasQueueOverflow = !pushToQueue(chunk);
 
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
@@ -69,6 +69,93 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
     return !hasQueueOverflow;
 }
 
+template <typename ChunkQueueDataType>
+inline bool
+ChunkQueuePusher<ChunkQueueDataType>::pushWithDeferredWakeUp(mepoo::ShmSafeUnmanagedChunk chunk,
+                                                             ConditionVariableData*& attachedConditionVariable) noexcept
+{
+    bool hasQueueOverflow = !pushToQueue(chunk);
+
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        attachedConditionVariable = getMembers()->m_conditionVariableDataPtr.get();
+        if (attachedConditionVariable != nullptr)
+        {
+            ConditionNotifier(*attachedConditionVariable, *getMembers()->m_conditionVariableNotificationIndex)
+                .setNotificationActive();
+        }
+    }
+
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::wakeUpIfAttachedTo(
+    const ConditionVariableData* const conditionVariable) noexcept
+{
+    // the lock ensures that the condition variable is not detached and destroyed while it is woken up
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (conditionVariable == nullptr || getMembers()->m_conditionVariableDataPtr.get() != conditionVariable)
+    {
+        return false;
+    }
+
+    ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                      *getMembers()->m_conditionVariableNotificationIndex)
+        .wakeUp();
+    return true;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushOrWaitForSpace(mepoo::SharedChunk chunk,
+                                                                     const units::Duration timeout) noexcept
+{
+    auto& semaphore = getMembers()->m_spaceAvailableSemaphore;
+    if (!semaphore.has_value())
+    {
+        return push(chunk);
+    }
+
+    // discard posts which were meant for a previous wait, they would only cause a spurious wake-up
+    while (semaphore->tryWait().value_or(false))
+    {
+    }
+
+    // the consumer checks the number of waiting producers after it popped a chunk; the fences ensure that either the
+    // consumer sees the registration or the producer sees the free slot when pushing again
+    getMembers()->m_numberOfWaitingProducers.fetch_add(1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    bool wasPushed = push(chunk);
+    if (!wasPushed)
+    {
+        semaphore->timedWait(timeout).or_else([](auto) {
+            IOX_LOG(Error, "Waiting for a free slot in the chunk queue failed! Retrying with busy waiting.");
+        });
+        wasPushed = push(chunk);
+    }
+
+    getMembers()->m_numberOfWaitingProducers.fetch_sub(1U, std::memory_order_relaxed);
+
+    return wasPushed;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushToQueue(mepoo::ShmSafeUnmanagedChunk chunk) noexcept
+{
+    auto pushRet = getMembers()->m_queue.push(chunk);
+
+    // drop the chunk if one is returned by an overflow
+    if (pushRet.has_value())
+    {
+        pushRet.value().releaseToSharedChunk();
+        // tell the ChunkDistributor that we had an overflow and dropped a sample
+        return false;
+    }
+
+    return true;
+}
+
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
 {
@@ -18,9 +18,13 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_LISTENER_HPP
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/wait_statistics.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/atomic.hpp"
+#include "iox/expected.hpp"
+#include "iox/optional.hpp"
 
 namespace iox
 {
@@ -33,7 +37,7 @@ class ConditionListener
     using NotificationVector_t = vector<BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>, MAX_NUMBER_OF_NOTIFIERS>;
 
     explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
-    ~ConditionListener() noexcept = default;
+    ~ConditionListener() noexcept;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
     ConditionListener& operator=(const ConditionListener& rhs) = delete;
@@ -51,7 +55,8 @@ class ConditionListener
 
     /// @brief returns a sorted vector of indices of active notifications; blocking if ConditionVariableData was
     /// not notified unless destroy() was called before. The indices of active notifications are
-    /// never empty unless destroy() was called, then it's always empty.
+    /// never empty unless destroy() was called, then it's always empty. While a timer is running, the semaphore is
+    /// only waited on until its deadline and the expired timer is returned as active notification.
     ///
     /// @return a sorted vector of active notifications
     NotificationVector_t wait() noexcept;
@@ -65,19 +70,69 @@ class ConditionListener
     /// @return a sorted vector of active notifications
     NotificationVector_t timedWait(const units::Duration& timeToWait) noexcept;
 
+    /// @brief returns a sorted vector of indices of active notifications without blocking. When the ConditionListener
+    /// is pollable, the file descriptor is drained before. Timers whose deadline has passed are expired. The vector
+    /// can be empty and is always empty after destroy() was called.
+    ///
+    /// @return a sorted vector of active notifications
+    NotificationVector_t tryWait() noexcept;
+
+    /// @brief Makes the ConditionListener pollable. The returned file descriptor becomes readable when a notifier
+    /// notifies while no thread waits in wait() or timedWait(); tryWait() collects the notifications and drains it.
+    /// The NotificationSocket behind the file descriptor is created with the first call.
+    /// @note This method is not thread-safe. Notifications which were active before the first call are not signaled
+    /// by the file descriptor but returned by the next tryWait()
+    /// @return the file descriptor or the reason why the NotificationSocket could not be created
+    expected<int32_t, NotificationSocketError> getFileDescriptor() noexcept;
+
+    /// @brief Sets the duration for which wait() and timedWait() poll the notifications before they block on the
+    /// semaphore. While polling, the notifiers skip the semaphore post which removes the wake-up latency of the
+    /// operating system at the cost of a busy CPU core. Zero, the default, disables the busy polling. The polling ends
+    /// at the latest at the earliest deadline of the running timers.
+    /// @note This method can be called concurrently to wait() and timedWait() and affects the next wait
+    /// @param[in] duration the maximum time to poll before blocking
+    void setBusyPollDuration(const units::Duration duration) noexcept;
+
+    /// @brief returns the duration for which the notifications are polled before blocking
+    units::Duration getBusyPollDuration() const noexcept;
+
+    /// @brief returns the statistics of all waits since the construction of the ConditionListener
+    WaitStatistics getStatistics() const noexcept;
+
   protected:
     const ConditionVariableData* getMembers() volatile const noexcept;
     ConditionVariableData* getMembers() volatile noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
     void resetSemaphore() noexcept;
+    void collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept;
+    bool pollForNotifications(const units::Duration pollDuration) noexcept;
+    void recordWakeUpLatency() noexcept;
+    /// @brief sets the notifications of all timers whose deadline has passed active and arms the periodic timers for
+    /// their next deadline
+    void expireTimers() noexcept;
+    /// @brief returns the earliest deadline of all running timers or nullopt when no timer is running
+    optional<uint64_t> earliestTimerDeadline() const noexcept;
+    /// @brief limits the busy polling to the time until the earliest timer deadline since an expired timer is only
+    /// detected after the polling
+    units::Duration limitToEarliestTimerDeadline(const units::Duration pollDuration) const noexcept;
 
-    NotificationVector_t waitImpl(const function_ref<bool()> waitCall) noexcept;
+    NotificationVector_t waitImpl(const units::Duration pollDuration, const function_ref<bool()> waitCall) noexcept;
 
   private:
+    /// @brief the number of polls before the polling thread starts to yield the CPU
+    static constexpr uint64_t POLLS_BEFORE_YIELD{1000U};
+
     ConditionVariableData* m_condVarDataPtr{nullptr};
     concurrent::Atomic<bool> m_toBeDestroyed{false};
+    concurrent::Atomic<uint64_t> m_busyPollDurationInNanoseconds{0U};
+
+    concurrent::Atomic<uint64_t> m_numberOfSpinHits{0U};
+    concurrent::Atomic<uint64_t> m_numberOfBlockingWaits{0U};
+    concurrent::Atomic<uint64_t> m_numberOfWakeUpLatencySamples{0U};
+    concurrent::Atomic<uint64_t> m_accumulatedWakeUpLatencyInNanoseconds{0U};
+
+    optional<NotificationSocket> m_notificationSocket;
 };
 
 } // namespace popo
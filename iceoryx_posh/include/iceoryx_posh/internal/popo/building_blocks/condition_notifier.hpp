@@ -40,10 +40,26 @@ class ConditionNotifier
     /// @brief If threads are waiting on the condition variable, this call unblocks one of the waiting threads
     void notify() noexcept;
 
+    /// @brief Sets the notification active without unblocking a waiting thread. This allows to coalesce multiple
+    /// notifications of the same condition variable into a single wakeUp call, which must follow afterwards
+    void setNotificationActive() noexcept;
+
+    /// @brief Unblocks one of the threads waiting on the condition variable without setting a notification active
+    /// The semaphore post is skipped while the ConditionListener is spinning since it polls the notifications anyway
+    /// and replaced by a datagram to the NotificationSocket when a pollable ConditionListener is not waiting
+    void wakeUp() noexcept;
+
+    /// @brief Unblocks a ConditionListener which is blocked on the semaphore without setting a notification active,
+    /// so that it takes the changed deadline of a timer into account
+    void interruptBlockingWait() noexcept;
+
   protected:
     const ConditionVariableData* getMembers() const noexcept;
     ConditionVariableData* getMembers() noexcept;
 
+  private:
+    void signalNotificationSocket() noexcept;
+
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
     uint64_t m_notificationIndex = INVALID_NOTIFICATION_INDEX;
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_deployment.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/atomic.hpp"
 #include "iox/spin_semaphore.hpp"
@@ -39,11 +40,81 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
+    /// @brief describes how the ConditionListener is waiting for notifications
+    enum class ListenerState : uint8_t
+    {
+        /// the ConditionListener is not waiting
+        IDLE,
+        /// the ConditionListener polls the active notifications, a semaphore post is not required to wake it up
+        SPINNING,
+        /// the ConditionListener waits on the semaphore
+        BLOCKING
+    };
+
+    /// @brief a timer of a TimerTrigger which is expired by the ConditionListener while it waits; the timers are
+    /// stored in the condition variable so that the waiting thread can block until the earliest deadline instead of
+    /// relying on an additional thread which notifies at the deadline
+    struct Timer_t
+    {
+        /// @brief the time of the monotonic clock in nanoseconds at which the timer expires, zero when it is stopped
+        concurrent::Atomic<uint64_t> m_deadline{0U};
+        /// @brief the period in nanoseconds of a periodic timer, zero for a one-shot timer
+        concurrent::Atomic<uint64_t> m_period{0U};
+        /// @brief the notification which is set active when the timer expires
+        concurrent::Atomic<uint64_t> m_notificationIndex{0U};
+        concurrent::Atomic<bool> m_isInUse{false};
+    };
+
+    static constexpr uint64_t NOTIFICATIONS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{(MAX_NUMBER_OF_NOTIFIERS + NOTIFICATIONS_PER_WORD - 1U)
+                                                           / NOTIFICATIONS_PER_WORD};
+
+    /// @brief marks the notification with the provided index as active
+    /// @param[in] index of the notification, must be smaller than MAX_NUMBER_OF_NOTIFIERS
+    void setNotificationActive(const uint64_t index) noexcept;
+
+    /// @brief checks whether the notification with the provided index is active
+    /// @param[in] index of the notification, must be smaller than MAX_NUMBER_OF_NOTIFIERS
+    /// @return true if the notification is active, otherwise false
+    bool isNotificationActive(const uint64_t index) const noexcept;
+
+    /// @brief checks whether any notification is active
+    /// @return true if at least one notification is active, otherwise false
+    bool hasActiveNotifications() const noexcept;
+
+    /// @brief the current time of the monotonic clock, which is shared by all processes, in nanoseconds
+    static uint64_t currentTimestamp() noexcept;
+
     optional<build::InterProcessSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     concurrent::Atomic<bool> m_toBeDestroyed{false};
-    concurrent::Atomic<bool> m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief the active notifications packed into words; the notification with index i is the bit
+    /// (i % NOTIFICATIONS_PER_WORD) of the word (i / NOTIFICATIONS_PER_WORD). This allows the ConditionListener to
+    /// collect all active notifications of a word with a single exchange
+    concurrent::Atomic<uint64_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
     concurrent::Atomic<bool> m_wasNotified{false};
+
+    /// @brief number of notifications which were set active by the notifiers
+    concurrent::Atomic<uint64_t> m_numberOfNotifications{0U};
+    /// @brief number of semaphore posts and notification socket datagrams to wake up the waiting thread; the difference
+    /// to m_numberOfNotifications is the number of wake-ups which were saved by coalescing notifications or by a
+    /// spinning ConditionListener
+    concurrent::Atomic<uint64_t> m_numberOfWakeUps{0U};
+
+    concurrent::Atomic<ListenerState> m_listenerState{ListenerState::IDLE};
+    /// @brief time stamp of the first wake-up since the ConditionListener started to wait, zero if there was none; used
+    /// to measure the wake-up latency
+    concurrent::Atomic<uint64_t> m_firstWakeUpTimestamp{0U};
+
+    /// @brief name of the NotificationSocket of a pollable ConditionListener; only valid when
+    /// m_hasNotificationSocket is true
+    NotificationSocket::Name_t m_notificationSocketName;
+    concurrent::Atomic<bool> m_hasNotificationSocket{false};
+    /// @brief true when a datagram was sent to the NotificationSocket since the ConditionListener drained it the last
+    /// time; further notifications do not send a datagram but are collected together with the first one
+    concurrent::Atomic<bool> m_isNotificationSocketSignaled{false};
+
+    Timer_t m_timers[MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE];
 };
 
 } // namespace popo
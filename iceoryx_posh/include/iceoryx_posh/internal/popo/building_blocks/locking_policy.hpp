@@ -47,6 +47,27 @@ class SingleThreadedPolicy
     bool tryLock() const noexcept;
 };
 
+/// @brief Policy for building blocks which synchronize the data shared with the senders without a lock. The lock
+/// methods are no-ops and are only provided to be able to use the same std::lock_guard based code paths for the
+/// parts which do not need to be synchronized, e.g. the disabled history of a lock-free ChunkDistributorData.
+class LockFreePolicy
+{
+  public:
+    // needs to be public since we want to use std::lock_guard
+    void lock() const noexcept;
+    void unlock() const noexcept;
+    bool tryLock() const noexcept;
+
+  protected:
+    /// @brief Returns the pid which identifies the process of a sender registered in the shared data
+    static uint32_t currentProcessId() noexcept;
+
+    /// @brief Checks whether the process of a registered sender still exists
+    /// @param[in] pid of the process to check
+    /// @return false only if the process is known to be terminated, otherwise true
+    static bool isProcessAlive(const uint32_t pid) noexcept;
+};
+
 } // namespace popo
 } // namespace iox
 
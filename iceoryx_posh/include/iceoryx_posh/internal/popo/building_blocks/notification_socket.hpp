@@ -0,0 +1,86 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
+
+#include "iceoryx_platform/un.hpp"
+#include "iox/expected.hpp"
+#include "iox/string.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+enum class NotificationSocketError : uint8_t
+{
+    SOCKET_CREATION_FAILED,
+    BINDING_FAILED,
+    UNABLE_TO_SET_NON_BLOCKING
+};
+
+/// @brief A datagram unix domain socket which makes the notifications of a condition variable pollable. The socket
+/// is bound by the process of the ConditionListener which provides its file descriptor to the user, e.g. to add it to
+/// an epoll set. The name of the socket is stored in the shared ConditionVariableData so that the notifiers of all
+/// processes can send a wake-up datagram to it.
+class NotificationSocket
+{
+  public:
+    using Name_t = string<sizeof(sockaddr_un::sun_path) - 1U>;
+
+    /// @brief creates and binds a non-blocking socket with a name which is unique on this host
+    /// @return the NotificationSocket or the reason why it could not be created
+    static expected<NotificationSocket, NotificationSocketError> create() noexcept;
+
+    NotificationSocket(const NotificationSocket&) = delete;
+    NotificationSocket(NotificationSocket&& rhs) noexcept;
+    NotificationSocket& operator=(const NotificationSocket&) = delete;
+    NotificationSocket& operator=(NotificationSocket&& rhs) noexcept;
+    ~NotificationSocket() noexcept;
+
+    /// @brief the file descriptor which becomes readable when a wake-up datagram was sent to the socket
+    int32_t getFileDescriptor() const noexcept;
+
+    /// @brief the name the notifiers use to send their wake-up datagrams
+    const Name_t& getName() const noexcept;
+
+    /// @brief receives all pending wake-up datagrams without blocking so that the file descriptor is no longer
+    /// readable
+    void drain() const noexcept;
+
+    /// @brief sends a wake-up datagram to the socket with the provided name; a failure is only logged since the
+    /// notification itself is stored in the ConditionVariableData
+    /// @param[in] name of the socket to wake up
+    static void signal(const Name_t& name) noexcept;
+
+  private:
+    NotificationSocket(const int32_t fileDescriptor, const Name_t& name) noexcept;
+
+    void destroy() noexcept;
+
+  private:
+    static constexpr int32_t INVALID_FD{-1};
+
+    int32_t m_fileDescriptor{INVALID_FD};
+    Name_t m_name;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
@@ -24,7 +24,9 @@ namespace popo
 {
 template <typename T, typename ContextDataType>
 inline expected<void, ListenerError>
-Listener::attachEvent(T& eventOrigin, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+Listener::attachEvent(T& eventOrigin,
+                      const NotificationCallback<T, ContextDataType>& eventCallback,
+                      const ListenerEventPriority priority) noexcept
 {
     if (eventCallback.m_callback == nullptr)
     {
@@ -37,7 +39,8 @@ Listener::attachEvent(T& eventOrigin, const NotificationCallback<T, ContextDataT
                     typeid(NoEnumUsed).hash_code(),
                     reinterpret_cast<internal::GenericCallbackRef_t>(*eventCallback.m_callback),
                     internal::TranslateAndCallTypelessCallback<T, ContextDataType>::call,
-                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin))
+                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin),
+                    priority)
         .and_then([&](auto& eventId) {
             NotificationAttorney::enableEvent(
                 eventOrigin, TriggerHandle(*m_conditionVariableData, {*this, &Listener::removeTrigger}, eventId));
@@ -45,8 +48,11 @@ Listener::attachEvent(T& eventOrigin, const NotificationCallback<T, ContextDataT
 }
 
 template <typename T, typename EventType, typename ContextDataType, typename>
-inline expected<void, ListenerError> Listener::attachEvent(
-    T& eventOrigin, const EventType eventType, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+inline expected<void, ListenerError>
+Listener::attachEvent(T& eventOrigin,
+                      const EventType eventType,
+                      const NotificationCallback<T, ContextDataType>& eventCallback,
+                      const ListenerEventPriority priority) noexcept
 {
     if (eventCallback.m_callback == nullptr)
     {
@@ -59,7 +65,8 @@ inline expected<void, ListenerError> Listener::attachEvent(
                     typeid(EventType).hash_code(),
                     reinterpret_cast<internal::GenericCallbackRef_t>(*eventCallback.m_callback),
                     internal::TranslateAndCallTypelessCallback<T, ContextDataType>::call,
-                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin))
+                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin),
+                    priority)
         .and_then([&](auto& eventId) {
             NotificationAttorney::enableEvent(
                 eventOrigin,
@@ -75,7 +82,8 @@ Listener::addEvent(void* const origin,
                    const uint64_t eventTypeHash,
                    internal::GenericCallbackRef_t callback,
                    internal::TranslationCallbackRef_t translationCallback,
-                   const function<void(uint64_t)> invalidationCallback) noexcept
+                   const function<void(uint64_t)> invalidationCallback,
+                   const ListenerEventPriority priority) noexcept
 {
     std::lock_guard<std::mutex> lock(m_addEventMutex);
 
@@ -93,6 +101,7 @@ Listener::addEvent(void* const origin,
         return err(ListenerError::LISTENER_FULL);
     }
 
+    m_eventPriorities[index].store(priority, std::memory_order_relaxed);
     m_events[index]->init(
         index, origin, userType, eventType, eventTypeHash, callback, translationCallback, invalidationCallback);
     return ok(index);
@@ -55,11 +55,13 @@ using ClientChunkQueueData_t = ChunkQueueData<ClientChunkQueueConfig, ThreadSafe
 
 using ServerChunkQueueData_t = ChunkQueueData<ServerChunkQueueConfig, ThreadSafePolicy>;
 
+// requests and responses can be sent concurrently from multiple threads and have no history, therefore the senders
+// access the queues lock-free
 using ClientChunkDistributorData_t =
-    ChunkDistributorData<ClientChunkDistributorConfig, ThreadSafePolicy, ChunkQueuePusher<ServerChunkQueueData_t>>;
+    ChunkDistributorData<ClientChunkDistributorConfig, LockFreePolicy, ChunkQueuePusher<ServerChunkQueueData_t>>;
 
 using ServerChunkDistributorData_t =
-    ChunkDistributorData<ServerChunkDistributorConfig, ThreadSafePolicy, ChunkQueuePusher<ClientChunkQueueData_t>>;
+    ChunkDistributorData<ServerChunkDistributorConfig, LockFreePolicy, ChunkQueuePusher<ClientChunkQueueData_t>>;
 
 using ClientChunkReceiverData_t = ChunkReceiverData<MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY, ClientChunkQueueData_t>;
 
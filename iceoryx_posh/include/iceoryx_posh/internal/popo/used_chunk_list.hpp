@@ -60,6 +60,11 @@ class UsedChunkList
     /// @note only from runtime context
     bool remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Checks whether the application holds any chunk of this list
+    /// @return true if no chunk is in use, otherwise false
+    /// @note only from runtime context
+    bool isEmpty() noexcept;
+
     /// @brief Cleans up all the remaining chunks from the list.
     /// @note from RouDi context once the applications walked the plank. It is unsafe to call this if the application is
     /// still running.
@@ -100,6 +100,14 @@ bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepo
     return false;
 }
 
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::isEmpty() noexcept
+{
+    // pairs with the release in insert and remove, which might have been called by another thread of the application
+    m_synchronizer.test_and_set(std::memory_order_acquire);
+    return m_usedListHead == INVALID_INDEX;
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::cleanup() noexcept
 {
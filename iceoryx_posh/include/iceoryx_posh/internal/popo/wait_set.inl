@@ -333,6 +333,23 @@ inline typename WaitSet<Capacity>::NotificationInfoVector WaitSet<Capacity>::wai
     return waitAndReturnTriggeredTriggers([this] { return this->m_conditionListener.wait(); });
 }
 
+template <uint64_t Capacity>
+inline typename WaitSet<Capacity>::NotificationInfoVector WaitSet<Capacity>::tryWait() noexcept
+{
+    return waitAndReturnTriggeredTriggers([this] { return this->m_conditionListener.tryWait(); });
+}
+
+template <uint64_t Capacity>
+inline expected<int32_t, WaitSetError> WaitSet<Capacity>::getFileDescriptor() noexcept
+{
+    auto fileDescriptor = m_conditionListener.getFileDescriptor();
+    if (fileDescriptor.has_error())
+    {
+        return err(WaitSetError::FILE_DESCRIPTOR_NOT_AVAILABLE);
+    }
+    return ok(fileDescriptor.value());
+}
+
 template <uint64_t Capacity>
 inline typename WaitSet<Capacity>::NotificationInfoVector
 WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
@@ -402,6 +419,18 @@ WaitSet<Capacity>::waitAndReturnTriggeredTriggers(const WaitFunction& wait) noex
     return createVectorWithTriggeredTriggers();
 }
 
+template <uint64_t Capacity>
+inline void WaitSet<Capacity>::setBusyPollDuration(const units::Duration duration) noexcept
+{
+    m_conditionListener.setBusyPollDuration(duration);
+}
+
+template <uint64_t Capacity>
+inline WaitStatistics WaitSet<Capacity>::getStatistics() const noexcept
+{
+    return m_conditionListener.getStatistics();
+}
+
 template <uint64_t Capacity>
 inline uint64_t WaitSet<Capacity>::size() const noexcept
 {
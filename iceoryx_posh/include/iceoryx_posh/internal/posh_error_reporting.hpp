@@ -166,6 +166,10 @@ namespace iox
     error(IPC_INTERFACE__REG_UNABLE_TO_WRITE_TO_ROUDI_CHANNEL) \
     error(IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS) \
     error(IPC_INTERFACE__REG_ACK_NO_RESPONSE) \
+    error(POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE) \
+    error(POPO__LISTENER_FAILED_TO_CREATE_WORKER_SEMAPHORE) \
+    error(POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED) \
+    error(POPO__TIMER_TRIGGER_NO_FREE_TIMER) \
     error(DO_NOT_USE_AS_ERROR_THIS_IS_AN_INTERNAL_MARKER) // keep this always at the end of the error list
 
 
@@ -80,7 +80,9 @@ class MemPoolIntrospection
     static void prepareIntrospectionSample(MemPoolIntrospectionInfo& sample,
                                            const PosixGroup& readerGroup,
                                            const PosixGroup& writerGroup,
-                                           uint32_t id) noexcept;
+                                           uint32_t id,
+                                           uint64_t pageSize,
+                                           int32_t numaNode) noexcept;
 
     /// @brief copy data fro internal struct into interface struct
     void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
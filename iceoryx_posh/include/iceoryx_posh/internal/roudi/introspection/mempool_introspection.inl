@@ -18,6 +18,7 @@
 #define IOX_POSH_ROUDI_INTROSPECTION_MEMPOOL_INTROSPECTION_INL
 
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/thread.hpp"
 #include "mempool_introspection.hpp"
 
@@ -71,13 +72,17 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
     MemPoolIntrospectionInfo& sample,
     const PosixGroup& readerGroup,
     const PosixGroup& writerGroup,
-    uint32_t id) noexcept
+    uint32_t id,
+    uint64_t pageSize,
+    int32_t numaNode) noexcept
 {
     sample.m_readerGroupName.assign("");
     sample.m_readerGroupName.append(TruncateToCapacity, readerGroup.getName());
     sample.m_writerGroupName.assign("");
     sample.m_writerGroupName.append(TruncateToCapacity, writerGroup.getName());
     sample.m_id = id;
+    sample.m_pageSize = pageSize;
+    sample.m_numaNode = numaNode;
 }
 
 
@@ -108,7 +113,9 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
             prepareIntrospectionSample(memPoolIntrospectionInfo,
                                        PosixGroup::getGroupOfCurrentProcess(),
                                        PosixGroup::getGroupOfCurrentProcess(),
-                                       id);
+                                       id,
+                                       detail::pageSize(),
+                                       MemPoolIntrospectionInfo::UNKNOWN_NUMA_NODE);
             copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo);
             ++id;
 
@@ -118,8 +125,12 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                 if (sample->emplace_back())
                 {
                     auto& memPoolIntrospectionInfo = sample->back();
-                    prepareIntrospectionSample(
-                        memPoolIntrospectionInfo, segment.getReaderGroup(), segment.getWriterGroup(), id);
+                    prepareIntrospectionSample(memPoolIntrospectionInfo,
+                                               segment.getReaderGroup(),
+                                               segment.getWriterGroup(),
+                                               id,
+                                               segment.getPageSize(),
+                                               segment.getNumaNode());
                     copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo.m_mempoolInfo);
                 }
                 else
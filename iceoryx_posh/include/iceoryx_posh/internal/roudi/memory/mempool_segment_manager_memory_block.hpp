@@ -34,7 +34,9 @@ namespace roudi
 class MemPoolSegmentManagerMemoryBlock : public MemoryBlock
 {
   public:
-    MemPoolSegmentManagerMemoryBlock(const mepoo::SegmentConfig& segmentConfig, const DomainId domainId) noexcept;
+    MemPoolSegmentManagerMemoryBlock(const mepoo::SegmentConfig& segmentConfig,
+                                     const DomainId domainId,
+                                     const MemoryResidency memoryResidency = MemoryResidency::OFF) noexcept;
     ~MemPoolSegmentManagerMemoryBlock() noexcept;
 
     MemPoolSegmentManagerMemoryBlock(const MemPoolSegmentManagerMemoryBlock&) = delete;
@@ -67,6 +69,7 @@ class MemPoolSegmentManagerMemoryBlock : public MemoryBlock
     mepoo::SegmentManager<>* m_segmentManager{nullptr};
     mepoo::SegmentConfig m_segmentConfig;
     const DomainId m_domainId;
+    const MemoryResidency m_memoryResidency;
 };
 
 } // namespace roudi
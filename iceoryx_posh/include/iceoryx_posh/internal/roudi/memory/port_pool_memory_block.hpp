@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/roudi/roudi_config.hpp"
 #include "iceoryx_posh/roudi/memory/memory_block.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
@@ -32,10 +33,9 @@ namespace roudi
 class PortPoolMemoryBlock : public MemoryBlock
 {
   public:
-    /// @todo iox-#1709 the PortPool needs to be refactored to use a typed MemPool
-    /// once that is done, the cTor needs a configuration similar to MemPoolCollectionMemoryProvider
     /// @param[in] uniqueRouDiId to tie the ports to
-    PortPoolMemoryBlock(const roudi::UniqueRouDiId uniqueRouDiId) noexcept;
+    /// @param[in] capacity is the number of ports of each kind; it is limited to the compile time maxima
+    PortPoolMemoryBlock(const roudi::UniqueRouDiId uniqueRouDiId, const config::PortPoolCapacity& capacity) noexcept;
     ~PortPoolMemoryBlock() noexcept;
 
     PortPoolMemoryBlock(const PortPoolMemoryBlock&) = delete;
@@ -67,6 +67,7 @@ class PortPoolMemoryBlock : public MemoryBlock
   private:
     PortPoolData* m_portPoolData{nullptr};
     const roudi::UniqueRouDiId m_uniqueRouDiId;
+    const config::PortPoolCapacity m_capacity;
 };
 
 } // namespace roudi
@@ -0,0 +1,235 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_PORT_DATA_CONTAINER_HPP
+#define IOX_POSH_ROUDI_PORT_DATA_CONTAINER_HPP
+
+#include "iox/assertions.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/relocatable_ptr.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Container for the port data in the PortPool with a capacity which is set at runtime. It has the semantics
+/// of the FixedPositionContainer, i.e. the elements remain at fixed positions and the iteration always moves forward
+/// in memory, but the storage for the elements is acquired from a BumpAllocator. The container must therefore be
+/// placed in the same memory as its storage, e.g. the management segment, and is neither copyable nor movable.
+/// @tparam T is the type the container holds
+template <typename T>
+class PortDataContainer final
+{
+  private:
+    template <bool IsConst>
+    class IteratorBase;
+
+  public:
+    using ValueType = T;
+    using IndexType = uint32_t;
+    using Iterator = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+
+    /// @brief calculates the memory the container acquires from the BumpAllocator, including the padding which might
+    /// be required for the alignment
+    /// @param[in] capacity of the container
+    /// @return the required memory size in bytes
+    static constexpr uint64_t requiredMemorySize(const IndexType capacity) noexcept;
+
+    /// @brief creates an empty container
+    /// @param[in] capacity is the maximum number of elements the container can hold
+    /// @param[in] allocator to acquire the storage for the elements from; it must provide at least
+    /// 'requiredMemorySize(capacity)' bytes
+    PortDataContainer(const IndexType capacity, BumpAllocator& allocator) noexcept;
+    ~PortDataContainer() noexcept;
+
+    PortDataContainer(const PortDataContainer&) = delete;
+    PortDataContainer(PortDataContainer&&) = delete;
+    PortDataContainer& operator=(const PortDataContainer&) = delete;
+    PortDataContainer& operator=(PortDataContainer&&) = delete;
+
+    /// @brief Constructs a new element at the next free position
+    /// @param[in] args the arguments for the constructor of the element
+    /// @return iterator pointing to the new element or 'end' iterator if the container was full
+    template <typename... Targs>
+    Iterator emplace(Targs&&... args) noexcept;
+
+    /// @brief Removes the element at the given index
+    /// @param[in] index of the element to remove
+    /// @return iterator to the element after the removed element or 'end' iterator if there is none
+    /// @attention aborts if the index is out of range or the slot is not in use
+    Iterator erase(const IndexType index) noexcept;
+
+    /// @brief Removes the element the pointer points to
+    /// @param[in] ptr to the element to remove
+    /// @return iterator to the element after the removed element or 'end' iterator if there is none
+    /// @attention aborts if the pointer does not point to an element of the container
+    Iterator erase(const T* ptr) noexcept;
+
+    /// @brief Checks if the container is empty
+    /// @return 'true' if the container is empty, 'false' otherwise
+    bool empty() const noexcept;
+
+    /// @brief Checks if the container is full
+    /// @return 'true' if the container is full, 'false' otherwise
+    bool full() const noexcept;
+
+    /// @brief Get the number of elements in the container
+    /// @return the number of elements
+    uint64_t size() const noexcept;
+
+    /// @brief Get the maximum number of elements the container can hold
+    /// @return the capacity which was set at construction
+    uint64_t capacity() const noexcept;
+
+    /// @brief Get an iterator pointing to the beginning of the container
+    /// @return iterator pointing to the first element or 'end' iterator if the container is empty
+    Iterator begin() noexcept;
+
+    /// @copydoc begin
+    ConstIterator begin() const noexcept;
+
+    /// @brief Get an iterator pointing to the end of the container
+    /// @return iterator pointing behind the last element
+    Iterator end() noexcept;
+
+    /// @copydoc end
+    ConstIterator end() const noexcept;
+
+  private:
+    enum class SlotStatus : uint8_t
+    {
+        FREE,
+        USED,
+    };
+
+    template <bool IsConst>
+    class IteratorBase
+    {
+      public:
+        using Container = std::conditional_t<IsConst, const PortDataContainer, PortDataContainer>;
+        using Value = std::conditional_t<IsConst, const T, T>;
+
+        friend class PortDataContainer;
+        template <bool>
+        friend class IteratorBase;
+
+        /// @brief Converts a mutable iterator to a const iterator
+        template <bool IsRhsConst = IsConst, typename = std::enable_if_t<IsRhsConst>>
+        // NOLINTJUSTIFICATION a mutable iterator shall be usable where a const iterator is expected
+        // NOLINTNEXTLINE(hicpp-explicit-conversions)
+        IteratorBase(const IteratorBase<false>& other) noexcept
+            : m_container(other.m_container)
+            , m_index(other.m_index)
+        {
+        }
+
+        /// @brief Increment the iterator to point to the next element in the container
+        /// @return reference to the iterator after the increment
+        IteratorBase& operator++() noexcept
+        {
+            if (m_index < m_container->m_capacity)
+            {
+                m_index = m_container->m_next[m_index];
+            }
+            return *this;
+        }
+
+        /// @brief Increment the iterator to point to the next element in the container
+        /// @return iterator pointing to the element before the increment
+        IteratorBase operator++(int) noexcept
+        {
+            auto ret = *this;
+            ++(*this);
+            return ret;
+        }
+
+        /// @brief Dereference the iterator to access the element it points to
+        /// @attention aborts if the iterator is an 'end' iterator or the slot is not in use
+        [[nodiscard]] Value& operator*() const noexcept
+        {
+            return *to_ptr();
+        }
+
+        /// @brief Access the element pointed to by the iterator using the arrow operator
+        /// @attention aborts if the iterator is an 'end' iterator or the slot is not in use
+        [[nodiscard]] Value* operator->() const noexcept
+        {
+            return to_ptr();
+        }
+
+        /// @brief Get the pointer to the element the iterator points to
+        /// @attention aborts if the iterator is an 'end' iterator or the slot is not in use
+        [[nodiscard]] Value* to_ptr() const noexcept
+        {
+            IOX_ENFORCE(m_index < m_container->m_capacity, "Access with invalid index!");
+            IOX_ENFORCE(m_container->m_status[m_index] == SlotStatus::USED, "Invalid access! Slot not in use!");
+            return &m_container->m_data[m_index];
+        }
+
+        /// @brief Get the index of the element the iterator points to; the 'end' iterator has the capacity as index
+        [[nodiscard]] IndexType to_index() const noexcept
+        {
+            return m_index;
+        }
+
+        /// @brief Compares iterators for equality
+        template <bool IsRhsConst>
+        [[nodiscard]] bool operator==(const IteratorBase<IsRhsConst>& rhs) const noexcept
+        {
+            return m_container == rhs.m_container && m_index == rhs.m_index;
+        }
+
+        /// @brief Compares iterators for non-equality
+        template <bool IsRhsConst>
+        [[nodiscard]] bool operator!=(const IteratorBase<IsRhsConst>& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+      private:
+        IteratorBase(const IndexType index, Container& container) noexcept
+            : m_container(&container)
+            , m_index(index)
+        {
+        }
+
+        Container* m_container;
+        IndexType m_index;
+    };
+
+    template <typename S>
+    static S* allocateArray(const IndexType capacity, BumpAllocator& allocator) noexcept;
+
+  private:
+    IndexType m_capacity{0U};
+    relocatable_ptr<T> m_data;
+    relocatable_ptr<SlotStatus> m_status;
+    relocatable_ptr<IndexType> m_next;
+    IndexType m_size{0U};
+    IndexType m_beginFree{0U};
+    IndexType m_beginUsed{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/port_data_container.inl"
+
+#endif // IOX_POSH_ROUDI_PORT_DATA_CONTAINER_HPP
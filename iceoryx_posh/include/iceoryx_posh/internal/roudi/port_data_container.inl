@@ -0,0 +1,254 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_PORT_DATA_CONTAINER_INL
+#define IOX_POSH_ROUDI_PORT_DATA_CONTAINER_INL
+
+#include "iceoryx_posh/internal/roudi/port_data_container.hpp"
+
+#include <new>
+#include <utility>
+
+namespace iox
+{
+namespace roudi
+{
+template <typename T>
+inline constexpr uint64_t PortDataContainer<T>::requiredMemorySize(const IndexType capacity) noexcept
+{
+    if (capacity == 0U)
+    {
+        return 0U;
+    }
+    // the arrays are allocated one after another and each of them might need padding to be aligned
+    return (sizeof(T) * capacity + alignof(T) - 1U) + (sizeof(SlotStatus) * capacity + alignof(SlotStatus) - 1U)
+           + (sizeof(IndexType) * capacity + alignof(IndexType) - 1U);
+}
+
+template <typename T>
+template <typename S>
+inline S* PortDataContainer<T>::allocateArray(const IndexType capacity, BumpAllocator& allocator) noexcept
+{
+    auto memory = allocator.allocate(sizeof(S) * capacity, alignof(S));
+    IOX_ENFORCE(!memory.has_error(), "Not enough memory for the PortDataContainer!");
+    return static_cast<S*>(memory.value());
+}
+
+template <typename T>
+inline PortDataContainer<T>::PortDataContainer(const IndexType capacity, BumpAllocator& allocator) noexcept
+    : m_capacity(capacity)
+    , m_beginFree(0U)
+    , m_beginUsed(capacity)
+{
+    if (m_capacity == 0U)
+    {
+        return;
+    }
+
+    m_data = allocateArray<T>(m_capacity, allocator);
+    m_status = allocateArray<SlotStatus>(m_capacity, allocator);
+    m_next = allocateArray<IndexType>(m_capacity, allocator);
+
+    for (IndexType i = 0U; i < m_capacity; ++i)
+    {
+        m_status[i] = SlotStatus::FREE;
+        m_next[i] = i + 1U;
+    }
+}
+
+template <typename T>
+inline PortDataContainer<T>::~PortDataContainer() noexcept
+{
+    for (IndexType i = 0U; i < m_capacity; ++i)
+    {
+        if (m_status[i] == SlotStatus::USED)
+        {
+            m_data[i].~T();
+        }
+    }
+}
+
+template <typename T>
+template <typename... Targs>
+inline typename PortDataContainer<T>::Iterator PortDataContainer<T>::emplace(Targs&&... args) noexcept
+{
+    if (full())
+    {
+        return end();
+    }
+
+    // the free and the used slots are both kept in single linked lists which are sorted by the index; the new element
+    // takes the first free slot and is linked behind the closest used slot in front of it, see FixedPositionContainer
+    const auto index = m_beginFree;
+    m_beginFree = m_next[index];
+
+    new (&m_data[index]) T(std::forward<Targs>(args)...);
+    m_status[index] = SlotStatus::USED;
+    ++m_size;
+
+    if (index < m_beginUsed)
+    {
+        m_next[index] = m_beginUsed;
+        m_beginUsed = index;
+    }
+    else
+    {
+        IOX_ENFORCE(index != 0U, "Corruption detected!");
+        for (auto i = index - 1U;; --i)
+        {
+            if (m_status[i] == SlotStatus::USED)
+            {
+                m_next[index] = m_next[i];
+                m_next[i] = index;
+                break;
+            }
+            IOX_ENFORCE(i != 0U, "Corruption detected!");
+        }
+    }
+
+    return Iterator{index, *this};
+}
+
+template <typename T>
+inline typename PortDataContainer<T>::Iterator PortDataContainer<T>::erase(const IndexType index) noexcept
+{
+    IOX_ENFORCE(index < m_capacity, "Index out of range");
+    IOX_ENFORCE(m_status[index] == SlotStatus::USED, "Trying to erase from index pointing to an empty slot!");
+
+    const auto nextUsed = m_next[index];
+    const Iterator it{nextUsed, *this};
+
+    m_data[index].~T();
+    m_status[index] = SlotStatus::FREE;
+    --m_size;
+
+    // the slot is unlinked from the used list and linked into the free list; the closest slots in front of it with
+    // the respective status are the predecessors in the lists
+    bool isRemovedFromUsedList{false};
+    bool isAddedToFreeList{false};
+
+    if (index == m_beginUsed)
+    {
+        m_beginUsed = nextUsed;
+        isRemovedFromUsedList = true;
+    }
+
+    if (index < m_beginFree)
+    {
+        m_next[index] = m_beginFree;
+        m_beginFree = index;
+        isAddedToFreeList = true;
+    }
+
+    if (isRemovedFromUsedList && isAddedToFreeList)
+    {
+        return it;
+    }
+
+    IOX_ENFORCE(index != 0U, "Corruption detected! Index cannot be 0 at this location!");
+    for (auto i = index - 1U; !isRemovedFromUsedList || !isAddedToFreeList; --i)
+    {
+        if (!isRemovedFromUsedList && m_status[i] == SlotStatus::USED)
+        {
+            m_next[i] = nextUsed;
+            isRemovedFromUsedList = true;
+        }
+
+        if (!isAddedToFreeList && m_status[i] == SlotStatus::FREE)
+        {
+            m_next[index] = m_next[i];
+            m_next[i] = index;
+            isAddedToFreeList = true;
+        }
+
+        if (i == 0U)
+        {
+            break;
+        }
+    }
+    IOX_ENFORCE(isRemovedFromUsedList && isAddedToFreeList,
+                "Corruption detected! The container is in a corrupt state!");
+
+    return it;
+}
+
+template <typename T>
+inline typename PortDataContainer<T>::Iterator PortDataContainer<T>::erase(const T* ptr) noexcept
+{
+    IOX_ENFORCE(ptr != nullptr, "Pointer is a nullptr!");
+    IOX_ENFORCE(m_capacity != 0U, "Pointer pointing out of the container!");
+
+    const T* const firstElement = &m_data[0];
+    IOX_ENFORCE(ptr >= firstElement, "Pointer pointing out of the container!");
+
+    const auto index = static_cast<uint64_t>(ptr - firstElement);
+    IOX_ENFORCE(index < m_capacity, "Pointer pointing out of the container!");
+    IOX_ENFORCE(ptr == &m_data[index], "Pointer is not aligned to an element in the container!");
+
+    return erase(static_cast<IndexType>(index));
+}
+
+template <typename T>
+inline bool PortDataContainer<T>::empty() const noexcept
+{
+    return m_size == 0U;
+}
+
+template <typename T>
+inline bool PortDataContainer<T>::full() const noexcept
+{
+    return m_beginFree >= m_capacity;
+}
+
+template <typename T>
+inline uint64_t PortDataContainer<T>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename T>
+inline uint64_t PortDataContainer<T>::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+template <typename T>
+inline typename PortDataContainer<T>::Iterator PortDataContainer<T>::begin() noexcept
+{
+    return Iterator{m_beginUsed, *this};
+}
+
+template <typename T>
+inline typename PortDataContainer<T>::ConstIterator PortDataContainer<T>::begin() const noexcept
+{
+    return ConstIterator{m_beginUsed, *this};
+}
+
+template <typename T>
+inline typename PortDataContainer<T>::Iterator PortDataContainer<T>::end() noexcept
+{
+    return Iterator{m_capacity, *this};
+}
+
+template <typename T>
+inline typename PortDataContainer<T>::ConstIterator PortDataContainer<T>::end() const noexcept
+{
+    return ConstIterator{m_capacity, *this};
+}
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PORT_DATA_CONTAINER_INL
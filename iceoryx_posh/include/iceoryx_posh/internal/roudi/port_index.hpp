@@ -0,0 +1,91 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_PORT_INDEX_HPP
+#define IOX_POSH_ROUDI_PORT_INDEX_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/roudi/service_description_hash.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Indexes the ports of one kind by the hash of their service description. The PortManager uses it to visit
+/// only the ports which can match a service when it connects or disconnects a port, instead of all ports of the
+/// PortPool. The index lives in RouDi and stores pointers to the port data in the PortPool.
+/// @tparam PortData the type of the port data, e.g. PublisherPortData
+/// @tparam Capacity the maximum number of ports of this kind in the PortPool
+template <typename PortData, uint32_t Capacity>
+class PortIndex
+{
+  public:
+    PortIndex() noexcept;
+
+    PortIndex(const PortIndex&) = delete;
+    PortIndex(PortIndex&&) = delete;
+    PortIndex& operator=(const PortIndex&) = delete;
+    PortIndex& operator=(PortIndex&&) = delete;
+    ~PortIndex() noexcept = default;
+
+    /// @brief adds a port to the index
+    /// @param[in] port to add; it must not be in the index and must stay valid until it is removed
+    /// @note terminates if more than Capacity ports are added
+    void add(PortData* const port) noexcept;
+
+    /// @brief removes a port from the index; ports which are not in the index are ignored
+    /// @param[in] port to remove
+    void remove(const PortData* const port) noexcept;
+
+    /// @brief calls the callable for each port with the provided service description in the order the ports were added
+    /// @param[in] serviceDescription of the ports to visit
+    /// @param[in] callable which is called with a reference to the port data; it is allowed to remove the port it is
+    /// called with from the index
+    template <typename Callable>
+    void forEachPortWith(const capro::ServiceDescription& serviceDescription, const Callable& callable) noexcept;
+
+  private:
+    struct Entry
+    {
+        PortData* port{nullptr};
+        uint64_t hash{0U};
+        uint32_t next{NO_INDEX};
+    };
+
+    static constexpr uint32_t NO_INDEX{Capacity};
+    static constexpr uint32_t NUMBER_OF_BUCKETS{numberOfHashBuckets(Capacity)};
+
+    static uint32_t toBucket(const uint64_t hash) noexcept;
+
+    // NOLINTJUSTIFICATION fixed size index without dynamic memory
+    // NOLINTBEGIN(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    Entry m_entries[Capacity];
+    /// @brief the first and the last entry of the chain of each bucket; new entries are appended to keep the order
+    uint32_t m_bucketHeads[NUMBER_OF_BUCKETS];
+    uint32_t m_bucketTails[NUMBER_OF_BUCKETS];
+    // NOLINTEND(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+
+    /// @brief the first unused entry; the unused entries are chained by their next index
+    uint32_t m_freeIndex{0U};
+};
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/port_index.inl"
+
+#endif // IOX_POSH_ROUDI_PORT_INDEX_HPP
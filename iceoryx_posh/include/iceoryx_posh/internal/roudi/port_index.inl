@@ -0,0 +1,131 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_PORT_INDEX_INL
+#define IOX_POSH_ROUDI_PORT_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/port_index.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/assertions.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace roudi
+{
+template <typename PortData, uint32_t Capacity>
+inline PortIndex<PortData, Capacity>::PortIndex() noexcept
+{
+    for (uint32_t index = 0U; index < Capacity; ++index)
+    {
+        m_entries[index].next = index + 1U;
+    }
+    std::fill(std::begin(m_bucketHeads), std::end(m_bucketHeads), NO_INDEX);
+    std::fill(std::begin(m_bucketTails), std::end(m_bucketTails), NO_INDEX);
+}
+
+template <typename PortData, uint32_t Capacity>
+inline void PortIndex<PortData, Capacity>::add(PortData* const port) noexcept
+{
+    IOX_ENFORCE(port != nullptr, "port must not be a nullptr");
+    IOX_ENFORCE(m_freeIndex != NO_INDEX, "the port index is full");
+
+    const auto index = m_freeIndex;
+    auto& entry = m_entries[index];
+    m_freeIndex = entry.next;
+
+    entry = Entry{port, hashOfServiceDescription(port->m_serviceDescription), NO_INDEX};
+
+    const auto bucket = toBucket(entry.hash);
+    if (m_bucketTails[bucket] == NO_INDEX)
+    {
+        m_bucketHeads[bucket] = index;
+    }
+    else
+    {
+        m_entries[m_bucketTails[bucket]].next = index;
+    }
+    m_bucketTails[bucket] = index;
+}
+
+template <typename PortData, uint32_t Capacity>
+inline void PortIndex<PortData, Capacity>::remove(const PortData* const port) noexcept
+{
+    if (port == nullptr)
+    {
+        return;
+    }
+
+    const auto bucket = toBucket(hashOfServiceDescription(port->m_serviceDescription));
+    uint32_t previous{NO_INDEX};
+    for (auto index = m_bucketHeads[bucket]; index != NO_INDEX; index = m_entries[index].next)
+    {
+        if (m_entries[index].port != port)
+        {
+            previous = index;
+            continue;
+        }
+
+        const auto next = m_entries[index].next;
+        if (previous == NO_INDEX)
+        {
+            m_bucketHeads[bucket] = next;
+        }
+        else
+        {
+            m_entries[previous].next = next;
+        }
+        if (m_bucketTails[bucket] == index)
+        {
+            m_bucketTails[bucket] = previous;
+        }
+
+        m_entries[index] = Entry{nullptr, 0U, m_freeIndex};
+        m_freeIndex = index;
+        return;
+    }
+}
+
+template <typename PortData, uint32_t Capacity>
+template <typename Callable>
+inline void PortIndex<PortData, Capacity>::forEachPortWith(const capro::ServiceDescription& serviceDescription,
+                                                           const Callable& callable) noexcept
+{
+    const auto hash = hashOfServiceDescription(serviceDescription);
+    auto index = m_bucketHeads[toBucket(hash)];
+    while (index != NO_INDEX)
+    {
+        // the next index is read in advance since the callable may remove the current port
+        const auto& entry = m_entries[index];
+        index = entry.next;
+        if (entry.hash == hash && entry.port->m_serviceDescription == serviceDescription)
+        {
+            callable(*entry.port);
+        }
+    }
+}
+
+template <typename PortData, uint32_t Capacity>
+inline uint32_t PortIndex<PortData, Capacity>::toBucket(const uint64_t hash) noexcept
+{
+    static_assert(isPowerOfTwo(NUMBER_OF_BUCKETS), "the number of buckets must be a power of two");
+    return static_cast<uint32_t>(hash & (NUMBER_OF_BUCKETS - 1U));
+}
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PORT_INDEX_INL
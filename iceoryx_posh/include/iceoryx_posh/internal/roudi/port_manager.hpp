@@ -32,6 +32,7 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/port_introspection.hpp"
+#include "iceoryx_posh/internal/roudi/port_index.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -202,6 +203,12 @@ class PortManager
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
 
+    // the matching ports of a port are looked up by its service description instead of iterating the PortPool
+    PortIndex<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS> m_publisherIndex;
+    PortIndex<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS> m_subscriberIndex;
+    PortIndex<popo::ServerPortData, MAX_SERVERS> m_serverIndex;
+    PortIndex<popo::ClientPortData, MAX_CLIENTS> m_clientIndex;
+
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
@@ -28,28 +28,17 @@ inline optional<RuntimeName_t>
 PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription& service) noexcept
 {
     // check if the publisher is already in the list
-    auto& publisherPorts = m_portPool->getPublisherPortDataList();
-    auto port = publisherPorts.begin();
-    while (port != publisherPorts.end())
-    {
-        popo::PublisherPortRouDi publisherPort(port.to_ptr());
-
-        if (service == publisherPort.getCaProServiceDescription())
-        {
-            if (publisherPort.toBeDestroyed())
-            {
-                destroyPublisherPort(port.to_ptr());
-                port = publisherPorts.begin();
-                continue;
-            }
-            return make_optional<RuntimeName_t>(port->m_runtimeName);
-        }
-        else
+    optional<RuntimeName_t> usedByProcess;
+    m_publisherIndex.forEachPortWith(service, [&](auto& publisherPortData) {
+        popo::PublisherPortRouDi publisherPort(&publisherPortData);
+        if (publisherPort.toBeDestroyed())
         {
-            ++port;
+            destroyPublisherPort(&publisherPortData);
+            return;
         }
-    }
-    return nullopt;
+        usedByProcess = publisherPortData.m_runtimeName;
+    });
+    return usedByProcess;
 }
 
 template <typename T, std::enable_if_t<std::is_same<T, iox::build::ManyToManyPolicy>::value>*>
@@ -24,37 +24,48 @@
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
-#include "iox/fixed_position_container.hpp"
-#include "iox/optional.hpp"
-#include "iox/vector.hpp"
+#include "iceoryx_posh/internal/roudi/port_data_container.hpp"
+#include "iceoryx_posh/roudi/roudi_config.hpp"
+#include "iox/bump_allocator.hpp"
 
 namespace iox
 {
 namespace roudi
 {
+/// @brief The ports of RouDi. The storage for the ports follows the PortPoolData in the management segment and is
+/// sized by the PortPoolCapacity of the RouDi config
 struct PortPoolData
 {
-    PortPoolData(const roudi::UniqueRouDiId uniqueRouDiId) noexcept
-        : m_uniqueRouDiId(uniqueRouDiId)
-    {
-    }
+    /// @brief calculates the memory for the storage of the ports which has to follow the PortPoolData
+    /// @param[in] capacity is the number of ports of each kind
+    /// @return the required memory size in bytes
+    static uint64_t requiredStorageSize(const config::PortPoolCapacity& capacity) noexcept;
 
-    using InterfaceContainer = FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER>;
+    /// @brief creates an empty port pool
+    /// @param[in] uniqueRouDiId to tie the ports to
+    /// @param[in] capacity is the number of ports of each kind
+    /// @param[in] storage to acquire the memory for the ports from; it must provide at least
+    /// 'requiredStorageSize(capacity)' bytes
+    PortPoolData(const roudi::UniqueRouDiId uniqueRouDiId,
+                 const config::PortPoolCapacity& capacity,
+                 BumpAllocator& storage) noexcept;
+
+    using InterfaceContainer = PortDataContainer<popo::InterfacePortData>;
     InterfaceContainer m_interfacePortMembers;
 
-    using CondVarContainer = FixedPositionContainer<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES>;
+    using CondVarContainer = PortDataContainer<popo::ConditionVariableData>;
     CondVarContainer m_conditionVariableMembers;
 
-    using PublisherContainer = FixedPositionContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS>;
+    using PublisherContainer = PortDataContainer<iox::popo::PublisherPortData>;
     PublisherContainer m_publisherPortMembers;
 
-    using SubscriberContainer = FixedPositionContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS>;
+    using SubscriberContainer = PortDataContainer<iox::popo::SubscriberPortData>;
     SubscriberContainer m_subscriberPortMembers;
 
-    using ServerContainer = FixedPositionContainer<iox::popo::ServerPortData, MAX_SERVERS>;
+    using ServerContainer = PortDataContainer<iox::popo::ServerPortData>;
     ServerContainer m_serverPortMembers;
 
-    using ClientContainer = FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS>;
+    using ClientContainer = PortDataContainer<iox::popo::ClientPortData>;
     ClientContainer m_clientPortMembers;
 
     const roudi::UniqueRouDiId m_uniqueRouDiId;
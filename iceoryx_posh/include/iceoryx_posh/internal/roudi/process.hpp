@@ -27,11 +27,14 @@
 #include "iox/posix_user.hpp"
 
 #include <cstdint>
+#include <mutex>
 
 namespace iox
 {
 namespace roudi
 {
+class PendingReply;
+
 class Process
 {
   public:
@@ -57,7 +60,8 @@ class Process
     /// @note the move cTor and assignment operator are already implicitly deleted because of the atomic
     Process(Process&& other) = delete;
     Process& operator=(Process&& other) = delete;
-    ~Process() noexcept = default;
+    /// @note waits until a PendingReply which is sent concurrently released the IPC channel
+    ~Process() noexcept;
 
     uint32_t getPid() const noexcept;
 
@@ -75,14 +79,51 @@ class Process
 
     bool isMonitored() const noexcept;
 
+  private:
+    friend class PendingReply;
+
+    void sendViaLockedIpcChannel(const runtime::IpcMessage& data) noexcept;
+
   private:
     const uint32_t m_pid{0U};
+    std::mutex m_ipcChannelMutex;
     runtime::IpcInterfaceUser m_ipcChannel;
     HeartbeatPoolIndexType m_heartbeatPoolIndex;
     PosixUser m_user;
     concurrent::Atomic<uint64_t> m_sessionId{0U};
 };
 
+/// @brief The reply to a request of a process. It is built while the ProcessManager is locked and sent after the lock
+/// was released, so that other requests are not serialized with the IPC send. The reply holds the lock of the IPC
+/// channel of the process, which keeps the process from being removed before the reply was sent.
+class PendingReply
+{
+  public:
+    /// @brief creates a reply which sends nothing, e.g. for a request of an unknown process
+    PendingReply() noexcept = default;
+
+    /// @brief locks the IPC channel of the process until the reply was sent
+    /// @param [in] process which receives the reply
+    /// @param [in] message of the reply
+    PendingReply(Process& process, const runtime::IpcMessage& message) noexcept;
+
+    PendingReply(const PendingReply& other) = delete;
+    PendingReply& operator=(const PendingReply& other) = delete;
+    PendingReply(PendingReply&& rhs) noexcept;
+    PendingReply& operator=(PendingReply&& rhs) noexcept;
+
+    /// @note a reply which was not sent explicitly is sent on destruction, a process never misses its reply
+    ~PendingReply() noexcept;
+
+    /// @brief sends the reply and releases the IPC channel of the process; further calls have no effect
+    void send() noexcept;
+
+  private:
+    Process* m_process{nullptr};
+    std::unique_lock<std::mutex> m_ipcChannelLock;
+    runtime::IpcMessage m_message;
+};
+
 } // namespace roudi
 } // namespace iox
 
@@ -24,13 +24,16 @@
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/heartbeat_pool.hpp"
+#include "iceoryx_posh/runtime/port_batch.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 #include "iox/list.hpp"
+#include "iox/optional.hpp"
 #include "iox/posix_user.hpp"
 
 #include <cstdint>
 #include <ctime>
+#include <mutex>
 
 namespace iox
 {
@@ -44,6 +47,9 @@ class ProcessManagerInterface
     virtual ~ProcessManagerInterface() noexcept = default;
 };
 
+/// @brief Manages the registered processes and creates their ports. The process list and the PortManager are guarded by
+/// separate locks, e.g. the discovery does not block requests which only access the process list. The replies to the
+/// requests are returned as PendingReply and are sent after the locks were released.
 class ProcessManager : public ProcessManagerInterface
 {
   public:
@@ -73,14 +79,15 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
-    /// @return false if process was already registered, true otherwise
-    bool registerProcess(const RuntimeName_t& name,
+    /// @return the REG_ACK for the process if it was registered, nullopt otherwise
+    /// @note the reply must be sent before the same process is registered again from the same thread
+    optional<PendingReply> registerProcess(const RuntimeName_t& name,
                          const uint32_t pid,
-                         const PosixUser user,
-                         const bool isMonitored,
-                         const int64_t transmissionTimestamp,
-                         const uint64_t sessionId,
-                         const version::VersionInfo& versionInfo) noexcept;
+                                           const PosixUser user,
+                                           const bool isMonitored,
+                                           const int64_t transmissionTimestamp,
+                                           const uint64_t sessionId,
+                                           const version::VersionInfo& versionInfo) noexcept;
 
     /// @brief Unregisters a process at the ProcessManager
     /// @param [in] name of the process which wants to unregister
@@ -103,22 +110,23 @@ class ProcessManager : public ProcessManagerInterface
 
     /// @brief A process is about to shut down and needs to be unblock by a potentially block publisher
     /// @param [in] name of the process runtime which is about to shut down
-    void handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept;
+    /// @return the PREPARE_APP_TERMINATION_ACK for the process
+    PendingReply handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept;
 
     /// @brief Tries to gracefully terminate all registered processes
     void requestShutdownOfAllProcesses() noexcept;
 
-    void addInterfaceForProcess(const RuntimeName_t& name, capro::Interfaces commInterface) noexcept;
+    PendingReply addInterfaceForProcess(const RuntimeName_t& name, capro::Interfaces commInterface) noexcept;
 
-    void addSubscriberForProcess(const RuntimeName_t& name,
-                                 const capro::ServiceDescription& service,
-                                 const popo::SubscriberOptions& subscriberOptions,
-                                 const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+    PendingReply addSubscriberForProcess(const RuntimeName_t& name,
+                                         const capro::ServiceDescription& service,
+                                         const popo::SubscriberOptions& subscriberOptions,
+                                         const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
 
-    void addPublisherForProcess(const RuntimeName_t& name,
-                                const capro::ServiceDescription& service,
-                                const popo::PublisherOptions& publisherOptions,
-                                const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+    PendingReply addPublisherForProcess(const RuntimeName_t& name,
+                                        const capro::ServiceDescription& service,
+                                        const popo::PublisherOptions& publisherOptions,
+                                        const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
 
     /// @brief Adds a client port to the internal process object and sends it to the OS process
     /// @param[in] name is the name of the runtime requesting the port
@@ -126,11 +134,11 @@ class ProcessManager : public ProcessManagerInterface
     /// @param[in] clientOptions like the queue capacity and queue full policy by a client
     /// @param[in] portConfigInfo configuration information for the port
     /// (what type of port is requested, device where its payload memory is located on etc.)
-    /// @return pointer to a created client port data
-    void addClientForProcess(const RuntimeName_t& name,
-                             const capro::ServiceDescription& service,
-                             const popo::ClientOptions& clientOptions,
-                             const PortConfigInfo& portConfigInfo) noexcept;
+    /// @return the reply with the pointer to the created client port data
+    PendingReply addClientForProcess(const RuntimeName_t& name,
+                                     const capro::ServiceDescription& service,
+                                     const popo::ClientOptions& clientOptions,
+                                     const PortConfigInfo& portConfigInfo) noexcept;
 
     /// @brief Adds a server port to the internal process object and sends it to the OS process
     /// @param[in] name is the name of the runtime requesting the port
@@ -138,29 +146,68 @@ class ProcessManager : public ProcessManagerInterface
     /// @param[in] serverOptions like the queue capacity and queue full policy by a server
     /// @param[in] portConfigInfo configuration information for the port
     /// (what type of port is requested, device where its payload memory is located on etc.)
-    /// @return pointer to a created server port data
-    void addServerForProcess(const RuntimeName_t& name,
-                             const capro::ServiceDescription& service,
-                             const popo::ServerOptions& serverOptions,
-                             const PortConfigInfo& portConfigInfo) noexcept;
+    /// @return the reply with the pointer to the created server port data
+    PendingReply addServerForProcess(const RuntimeName_t& name,
+                                     const capro::ServiceDescription& service,
+                                     const popo::ServerOptions& serverOptions,
+                                     const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief Creates the ports of a batch and sends the results for all ports with a single message to the process
+    /// @param[in] name is the name of the runtime requesting the ports
+    /// @param[in] ports which shall be created; the results are sent in the same order
+    /// @return the reply with the results for all ports
+    PendingReply addPortsForProcess(const RuntimeName_t& name, const runtime::PortBatch& ports) noexcept;
 
-    void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
+    PendingReply addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
+    /// @brief Monitors the liveness of the processes and runs the discovery
     void run() noexcept;
 
+    /// @brief Runs only the discovery, e.g. after a port was created
+    void discoveryUpdate() noexcept override;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
-    void sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept;
+    /// @return the MESSAGE_NOT_SUPPORTED reply for the application
+    PendingReply sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept;
 
 
   private:
     optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
+    /// @brief Creates a publisher port for the process and appends either the ACK with the relative pointer to the
+    /// port or the ERROR_RESPONSE to the response
+    void createPublisherPort(Process& process,
+                             const capro::ServiceDescription& service,
+                             const popo::PublisherOptions& publisherOptions,
+                             const PortConfigInfo& portConfigInfo,
+                             runtime::IpcMessage& response) noexcept;
+
+    /// @brief Creates a subscriber port for the process and appends the result to the response
+    void createSubscriberPort(Process& process,
+                              const capro::ServiceDescription& service,
+                              const popo::SubscriberOptions& subscriberOptions,
+                              const PortConfigInfo& portConfigInfo,
+                              runtime::IpcMessage& response) noexcept;
+
+    /// @brief Creates a client port for the process and appends the result to the response
+    void createClientPort(Process& process,
+                          const capro::ServiceDescription& service,
+                          const popo::ClientOptions& clientOptions,
+                          const PortConfigInfo& portConfigInfo,
+                          runtime::IpcMessage& response) noexcept;
+
+    /// @brief Creates a server port for the process and appends the result to the response
+    void createServerPort(Process& process,
+                          const capro::ServiceDescription& service,
+                          const popo::ServerOptions& serverOptions,
+                          const PortConfigInfo& portConfigInfo,
+                          runtime::IpcMessage& response) noexcept;
+
     void monitorProcesses() noexcept;
-    void discoveryUpdate() noexcept override;
 
     /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
     /// @param [in] pid is the host system process id
@@ -169,14 +216,14 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
-    /// @return Returns if the process could be added successfully.
-    bool addProcess(const RuntimeName_t& name,
-                    const uint32_t pid,
-                    const PosixUser& user,
-                    const bool isMonitored,
-                    const int64_t transmissionTimestamp,
-                    const uint64_t sessionId,
-                    const version::VersionInfo& versionInfo) noexcept;
+    /// @return Returns the REG_ACK if the process could be added successfully.
+    optional<PendingReply> addProcess(const RuntimeName_t& name,
+                                      const uint32_t pid,
+                                      const PosixUser& user,
+                                      const bool isMonitored,
+                                      const int64_t transmissionTimestamp,
+                                      const uint64_t sessionId,
+                                      const version::VersionInfo& versionInfo) noexcept;
 
     /// @brief Removes the process from the managed client process list, identified by its id.
     /// @param [in] name The process name which should be removed.
@@ -210,6 +257,12 @@ class ProcessManager : public ProcessManagerInterface
     /// @return Returns true if the process is still alive, otherwise false.
     bool probeProcessAliveWithSigTerm(const Process& process) noexcept;
 
+    /// @brief Checks whether a process does not exist anymore. Only then the resources which are shared with the
+    /// threads of the process, like the thread caches of the mempools, can be reclaimed safely.
+    /// @param [in] process The process to check.
+    /// @return Returns true if the process is known to be terminated, otherwise false.
+    bool isProcessTerminated(const Process& process) const noexcept;
+
     /// @brief Evaluates eventual upcoming errors from kill() command in requestShutdownOfProcess
     /// Calls the errorhandler.
     /// @param [in] process process where the kill command was run on
@@ -227,6 +280,10 @@ class ProcessManager : public ProcessManagerInterface
     mepoo::SegmentManager<>* m_segmentManager{nullptr};
     mepoo::MemoryManager* m_introspectionMemoryManager{nullptr};
     segment_id_underlying_t m_mgmtSegmentId{UntypedRelativePointer::NULL_POINTER_ID};
+    /// @brief guards the process list, the heartbeats and the process introspection; it is always acquired before
+    /// m_portManagerMutex
+    mutable std::mutex m_processListMutex;
+    std::mutex m_portManagerMutex;
     ProcessList_t m_processList;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_frame.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
@@ -31,9 +32,12 @@
 #include "iox/posix_user.hpp"
 #include "iox/relative_pointer.hpp"
 #include "iox/scope_guard.hpp"
-#include "iox/smart_lock.hpp"
+#include "iox/vector.hpp"
 
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
+#include <queue>
 #include <thread>
 
 namespace iox
@@ -72,6 +76,10 @@ class RouDi
     virtual void processMessage(const runtime::IpcMessage& message,
                                 const iox::runtime::IpcMessageType& cmd,
                                 const RuntimeName_t& runtimeName) noexcept;
+    /// @brief Handles the requests which the runtimes send in the binary encoding
+    virtual void processBinaryMessage(const runtime::IpcFrame& frame,
+                                      const iox::runtime::IpcMessageType& cmd,
+                                      const RuntimeName_t& runtimeName) noexcept;
     virtual void cyclicUpdateHook() noexcept;
     void IpcMessageErrorHandler() noexcept;
 
@@ -99,8 +107,27 @@ class RouDi
     static uint64_t getUniqueSessionIdForProcess() noexcept;
 
   private:
+    /// @brief a thread with its queue of runtime messages; the messages of one runtime are always dispatched to the
+    /// same worker in order to process them in the order they were received
+    struct RuntimeMessageWorker
+    {
+        std::mutex mutex;
+        std::condition_variable messageAvailable;
+        std::queue<runtime::IpcFrame> messages;
+        bool stopRequested{false};
+        std::thread thread;
+    };
+
     void processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterface) noexcept;
 
+    void processRuntimeMessage(const runtime::IpcFrame& frame) noexcept;
+
+    void dispatchRuntimeMessage(runtime::IpcFrame&& frame) noexcept;
+
+    void processRuntimeMessagesOfWorker(RuntimeMessageWorker& worker) noexcept;
+
+    void stopRuntimeMessageWorkers() noexcept;
+
     void monitorAndDiscoveryUpdate() noexcept;
 
     ScopeGuard m_unregisterRelativePtr{[] { UntypedRelativePointer::unregisterAll(); }};
@@ -109,6 +136,9 @@ class RouDi
     concurrent::Atomic<bool> m_runHandleRuntimeMessageThread;
 
     popo::UserTrigger m_discoveryLoopTrigger;
+    /// @brief triggered after a runtime message which creates or removes ports was processed; it runs the discovery
+    /// immediately while the liveness monitoring stays periodic
+    popo::UserTrigger m_portChangeTrigger;
     optional<UnnamedSemaphore> m_discoveryFinishedSemaphore;
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
@@ -125,11 +155,13 @@ class RouDi
         };
     }};
     PortManager* m_portManager{nullptr};
-    concurrent::smart_lock<ProcessManager> m_prcMgr;
+    /// @note synchronizes the access to the processes and ports itself, the workers handle the requests concurrently
+    ProcessManager m_prcMgr;
 
   private:
     std::thread m_monitoringAndDiscoveryThread;
     std::thread m_handleRuntimeMessageThread;
+    vector<RuntimeMessageWorker, MAX_RUNTIME_MESSAGE_WORKERS> m_runtimeMessageWorkers;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
@@ -0,0 +1,78 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_SERVICE_DESCRIPTION_HASH_HPP
+#define IOX_POSH_ROUDI_SERVICE_DESCRIPTION_HASH_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief returns the smallest power of two which is not smaller than the capacity
+constexpr uint32_t numberOfHashBuckets(const uint32_t capacity) noexcept
+{
+    uint32_t numberOfBuckets{1U};
+    while (numberOfBuckets < capacity)
+    {
+        numberOfBuckets <<= 1U;
+    }
+    return numberOfBuckets;
+}
+
+/// @brief FNV-1a hash of the string
+inline uint64_t hashOfId(const capro::IdString_t& id) noexcept
+{
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+    constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+    uint64_t hash{FNV_OFFSET_BASIS};
+    const char* const data = id.c_str();
+    for (uint64_t i = 0U; i < id.size(); ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounded by the size of the string
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+inline uint64_t combineHashes(const uint64_t seed, const uint64_t hash) noexcept
+{
+    constexpr uint64_t GOLDEN_RATIO{0x9e3779b97f4a7c15ULL};
+    return seed ^ (hash + GOLDEN_RATIO + (seed << 6U) + (seed >> 2U));
+}
+
+/// @brief hash of the service, instance and event string; equal service descriptions have equal hashes
+inline uint64_t
+hashOfIds(const capro::IdString_t& service, const capro::IdString_t& instance, const capro::IdString_t& event) noexcept
+{
+    return combineHashes(combineHashes(hashOfId(service), hashOfId(instance)), hashOfId(event));
+}
+
+inline uint64_t hashOfServiceDescription(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return hashOfIds(serviceDescription.getServiceIDString(),
+                     serviceDescription.getInstanceIDString(),
+                     serviceDescription.getEventIDString());
+}
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_DESCRIPTION_HASH_HPP
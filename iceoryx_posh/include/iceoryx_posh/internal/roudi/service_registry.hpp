@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/service_description_hash.hpp"
 #include "iox/expected.hpp"
 #include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
@@ -32,6 +33,9 @@ namespace iox
 {
 namespace roudi
 {
+/// @brief Stores the offered services. The entries are indexed by hash tables over the complete service description
+/// and over each of its strings so that adding, removing and searching do not scale with the number of entries. The
+/// hash tables consist of indices only since the registry is copied into shared memory to be published.
 class ServiceRegistry
 {
   public:
@@ -42,6 +46,8 @@ class ServiceRegistry
 
     static constexpr uint32_t CAPACITY = iox::SERVICE_REGISTRY_CAPACITY;
 
+    ServiceRegistry() noexcept;
+
     using ReferenceCounter_t = uint64_t;
 
     struct ServiceDescriptionEntry
@@ -81,7 +87,8 @@ class ServiceRegistry
     /// @param[in] serviceDescription, service to be removed
     void purge(const capro::ServiceDescription& serviceDescription) noexcept;
 
-    /// @brief Searches for given service description in registry
+    /// @brief Searches for given service description in registry; the entries are visited in the order of
+    /// forEach. Only the entries which share the hash of the most specific given string are compared.
     /// @param[in] service, string or wildcard (= iox::nullopt) to search for
     /// @param[in] instance, string or wildcard (= iox::nullopt) to search for
     /// @param[in] event, string or wildcard (= iox::nullopt) to search for
@@ -104,13 +111,38 @@ class ServiceRegistry
     using Entry_t = optional<ServiceDescriptionEntry>;
     using ServiceDescriptionContainer_t = vector<Entry_t, CAPACITY>;
 
+    /// @brief the keys of the hash tables; FULL is used to look up an entry, the others for searches with wildcards
+    enum class Key : uint32_t
+    {
+        FULL,
+        SERVICE,
+        INSTANCE,
+        EVENT
+    };
+
+    /// @brief links an entry to the neighbours in the chain of its hash bucket
+    struct Link
+    {
+        uint32_t previous{NO_INDEX};
+        uint32_t next{NO_INDEX};
+    };
+
     static constexpr uint32_t NO_INDEX = CAPACITY;
+    static constexpr uint32_t NUMBER_OF_KEYS{4U};
+    static constexpr uint32_t NUMBER_OF_BUCKETS{numberOfHashBuckets(CAPACITY)};
 
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
-    // store the last known free Index (if any is known)
-    // we could use a queue (or stack) here since they are not optimal
-    // for the filling pattern of a vector (prefer entries close to the front)
+    // NOLINTJUSTIFICATION the registry is copied into shared memory and therefore stores plain indices
+    // NOLINTBEGIN(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    /// @brief the first entry of each hash bucket per key
+    uint32_t m_bucketHeads[NUMBER_OF_KEYS][NUMBER_OF_BUCKETS];
+    /// @brief the chains of the hash buckets per key; the FULL links of unused entries form the list of free slots
+    Link m_links[NUMBER_OF_KEYS][CAPACITY];
+    // NOLINTEND(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+
+    /// @brief the slot of the most recently removed entry which is reused by the next insertion; the other free slots
+    /// are reachable by its FULL link
     uint32_t m_freeIndex{NO_INDEX};
 
     bool m_dataChanged{true}; // initially true in order to also get notified of the empty registry
@@ -118,6 +150,12 @@ class ServiceRegistry
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
 
+    static uint64_t hashOf(const Key key, const capro::ServiceDescription& serviceDescription) noexcept;
+    static uint32_t toBucket(const uint64_t hash) noexcept;
+
+    void insertIntoHashTables(const uint32_t index) noexcept;
+    void removeFromHashTables(const uint32_t index) noexcept;
+    void removeEntry(const uint32_t index) noexcept;
 
     expected<void, Error> add(const capro::ServiceDescription& serviceDescription,
                               ReferenceCounter_t ServiceDescriptionEntry::*count);
@@ -0,0 +1,215 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_IPC_FRAME_HPP
+#define IOX_POSH_RUNTIME_IPC_FRAME_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_batch.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/string.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace runtime
+{
+class IpcFrameReader;
+
+/// @brief A fixed size frame for the messages which are sent from the runtimes to RouDi. It carries either a message
+/// in the binary encoding or a separator separated text message, see IpcMessage.
+/// @details The binary encoding is written and parsed without heap allocations. It starts with a header consisting of
+/// BINARY_MARKER, the encoding version, the IpcMessageType and the runtime name. The layout of the header is the same
+/// for all versions, which allows RouDi to reject a request with an unsupported version. Integers are stored with
+/// their fixed width in the byte order of the host since both sides of the channel run on the same machine. Strings
+/// are stored with a length prefix. A text message starts with the decimal message type and can therefore not be
+/// mistaken for a binary one.
+/// @code
+///     IpcFrame frame(IpcMessageType::CREATE_PUBLISHER, runtimeName);
+///     frame << service << publisherOptions << portConfigInfo;
+///
+///     IpcFrameReader reader(frame);
+///     reader >> service >> publisherOptions >> portConfigInfo;
+///     if (!reader.isValid() || !reader.isAtEnd()) { /* malformed message */ }
+/// @endcode
+class IpcFrame
+{
+  public:
+    static constexpr uint64_t CAPACITY{ROUDI_MESSAGE_SIZE};
+    static constexpr uint8_t BINARY_MARKER{0xB5U};
+    static constexpr uint8_t BINARY_VERSION{1U};
+
+    using Buffer_t = string<CAPACITY>;
+    using StringLength_t = uint16_t;
+
+    /// @brief Creates an empty frame, e.g. to receive a message
+    IpcFrame() noexcept = default;
+
+    /// @brief Creates a frame in the binary encoding which contains the header
+    /// @param[in] type of the message
+    /// @param[in] runtimeName of the sender
+    IpcFrame(const IpcMessageType type, const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Appends a field to a binary frame. If the field does not fit into the frame, the frame becomes invalid.
+    template <typename T>
+    std::enable_if_t<std::is_integral<T>::value, IpcFrame&> operator<<(const T value) noexcept;
+
+    /// @copydoc IpcFrame::operator<<
+    template <uint64_t N>
+    IpcFrame& operator<<(const string<N>& value) noexcept;
+
+    /// @copydoc IpcFrame::operator<<
+    IpcFrame& operator<<(const capro::ServiceDescription& value) noexcept;
+
+    /// @copydoc IpcFrame::operator<<
+    IpcFrame& operator<<(const popo::PublisherOptions& value) noexcept;
+
+    /// @copydoc IpcFrame::operator<<
+    IpcFrame& operator<<(const popo::SubscriberOptions& value) noexcept;
+
+    /// @copydoc IpcFrame::operator<<
+    IpcFrame& operator<<(const popo::ClientOptions& value) noexcept;
+
+    /// @copydoc IpcFrame::operator<<
+    IpcFrame& operator<<(const popo::ServerOptions& value) noexcept;
+
+    /// @copydoc IpcFrame::operator<<
+    IpcFrame& operator<<(const PortConfigInfo& value) noexcept;
+
+    /// @copydoc IpcFrame::operator<<
+    IpcFrame& operator<<(const PortBatch::Entry& value) noexcept;
+
+    /// @brief A binary frame is valid when all fields fit into it, a text frame when it follows the syntax of an
+    /// IpcMessage
+    bool isValid() const noexcept;
+
+    /// @brief Returns true if the frame contains a message in the binary encoding
+    bool isBinary() const noexcept;
+
+    /// @brief Returns the version of the binary encoding or 0 for a text message
+    uint8_t getVersion() const noexcept;
+
+    /// @brief Returns the type of the message in either encoding, IpcMessageType::NOTYPE if there is none
+    IpcMessageType getMessageType() const noexcept;
+
+    /// @brief Returns the name of the sender in either encoding, an empty string if there is none
+    RuntimeName_t getRuntimeName() const noexcept;
+
+    /// @brief Converts a text frame into an IpcMessage
+    IpcMessage toTextMessage() const noexcept;
+
+    /// @brief Returns the size of the message in bytes
+    uint64_t size() const noexcept;
+
+    template <typename IpcChannelType>
+    friend class IpcInterface;
+    friend class IpcFrameReader;
+
+  private:
+    void append(const void* const data, const uint64_t size) noexcept;
+
+    void appendNodeName(const NodeName_t& nodeName) noexcept;
+
+    /// @brief parses the header of a binary frame without checking the version
+    /// @return the size of the header or 0 if the frame contains no valid header
+    uint64_t readHeader(uint8_t& version, IpcMessageType& type, RuntimeName_t& runtimeName) const noexcept;
+
+    Buffer_t m_buffer;
+    bool m_isValid{true};
+};
+
+/// @brief Reads the fields after the header of a binary frame in the order they were written
+class IpcFrameReader
+{
+  public:
+    /// @brief Creates a reader for the frame which must outlive the reader. The reader is invalid if the frame
+    /// is no binary frame or uses another version of the encoding.
+    explicit IpcFrameReader(const IpcFrame& frame) noexcept;
+
+    /// @brief Reads the next field. If the frame contains no further field of this type the reader becomes invalid.
+    template <typename T>
+    std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, IpcFrameReader&>
+    operator>>(T& value) noexcept;
+
+    /// @copydoc IpcFrameReader::operator>>
+    template <uint64_t N>
+    IpcFrameReader& operator>>(string<N>& value) noexcept;
+
+    /// @copydoc IpcFrameReader::operator>>
+    IpcFrameReader& operator>>(bool& value) noexcept;
+
+    /// @copydoc IpcFrameReader::operator>>
+    IpcFrameReader& operator>>(capro::ServiceDescription& value) noexcept;
+
+    /// @copydoc IpcFrameReader::operator>>
+    IpcFrameReader& operator>>(popo::PublisherOptions& value) noexcept;
+
+    /// @copydoc IpcFrameReader::operator>>
+    IpcFrameReader& operator>>(popo::SubscriberOptions& value) noexcept;
+
+    /// @copydoc IpcFrameReader::operator>>
+    IpcFrameReader& operator>>(popo::ClientOptions& value) noexcept;
+
+    /// @copydoc IpcFrameReader::operator>>
+    IpcFrameReader& operator>>(popo::ServerOptions& value) noexcept;
+
+    /// @copydoc IpcFrameReader::operator>>
+    IpcFrameReader& operator>>(PortConfigInfo& value) noexcept;
+
+    /// @copydoc IpcFrameReader::operator>>
+    IpcFrameReader& operator>>(PortBatch::Entry& value) noexcept;
+
+    /// @brief Returns false if the frame could not be read or contained an invalid field
+    bool isValid() const noexcept;
+
+    /// @brief Returns true if all fields of the frame were read
+    bool isAtEnd() const noexcept;
+
+    friend class IpcFrame;
+
+  private:
+    /// @brief creates a reader which starts at position without checking the header
+    IpcFrameReader(const IpcFrame& frame, const uint64_t position) noexcept;
+
+    /// @brief returns the next size bytes of the frame or nullptr if there are not enough bytes left
+    const char* consume(const uint64_t size) noexcept;
+
+    void extract(void* const data, const uint64_t size) noexcept;
+
+    /// @brief reads the underlying value of an enum and checks that it is smaller than numberOfValues
+    template <typename Enum>
+    void extractEnum(Enum& value, const uint64_t numberOfValues) noexcept;
+
+    const IpcFrame* m_frame{nullptr};
+    uint64_t m_position{0U};
+    bool m_isValid{true};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#include "iceoryx_posh/internal/runtime/ipc_frame.inl"
+
+#endif // IOX_POSH_RUNTIME_IPC_FRAME_HPP
@@ -0,0 +1,88 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_IPC_FRAME_INL
+#define IOX_POSH_RUNTIME_IPC_FRAME_INL
+
+#include "iceoryx_posh/internal/runtime/ipc_frame.hpp"
+
+#include <limits>
+
+namespace iox
+{
+namespace runtime
+{
+template <typename T>
+inline std::enable_if_t<std::is_integral<T>::value, IpcFrame&> IpcFrame::operator<<(const T value) noexcept
+{
+    append(&value, sizeof(T));
+    return *this;
+}
+
+template <uint64_t N>
+inline IpcFrame& IpcFrame::operator<<(const string<N>& value) noexcept
+{
+    static_assert(N <= std::numeric_limits<StringLength_t>::max(), "The string capacity exceeds the length prefix");
+
+    *this << static_cast<StringLength_t>(value.size());
+    append(value.c_str(), value.size());
+    return *this;
+}
+
+template <typename T>
+inline std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, IpcFrameReader&>
+IpcFrameReader::operator>>(T& value) noexcept
+{
+    extract(&value, sizeof(T));
+    return *this;
+}
+
+template <uint64_t N>
+inline IpcFrameReader& IpcFrameReader::operator>>(string<N>& value) noexcept
+{
+    IpcFrame::StringLength_t length{0U};
+    *this >> length;
+    if (length > N)
+    {
+        m_isValid = false;
+        return *this;
+    }
+
+    const char* const data = consume(length);
+    if (data != nullptr)
+    {
+        value = string<N>(TruncateToCapacity, data, length);
+    }
+    return *this;
+}
+
+template <typename Enum>
+inline void IpcFrameReader::extractEnum(Enum& value, const uint64_t numberOfValues) noexcept
+{
+    std::underlying_type_t<Enum> underlyingValue{0};
+    *this >> underlyingValue;
+    if (!m_isValid || static_cast<uint64_t>(underlyingValue) >= numberOfValues)
+    {
+        m_isValid = false;
+        return;
+    }
+    value = static_cast<Enum>(underlyingValue);
+}
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_IPC_FRAME_INL
@@ -54,7 +54,8 @@ using IoxIpcChannelType = iox::NamedPipe;
 #elif defined(__FREERTOS__)
 using IoxIpcChannelType = iox::NamedPipe;
 #else
-using IoxIpcChannelType = iox::UnixDomainSocket;
+/// @note selected with the 'IOX_IPC_CHANNEL_TYPE' CMake option, see iceoryx_posh_deployment.hpp
+using IoxIpcChannelType = build::IpcChannelType;
 #endif
 } // namespace platform
 namespace runtime
@@ -86,6 +87,8 @@ enum class IpcMessageType : int32_t
     WAKEUP_TRIGGER,
     REPLAY,
     MESSAGE_NOT_SUPPORTED,
+    CREATE_PORTS,
+    CREATE_PORTS_ACK,
     // etc..
     END,
 };
@@ -149,6 +152,7 @@ InterfaceName_t ipcChannelNameToInterfaceName(RuntimeName_t channelName, DomainI
 
 class IpcInterfaceUser;
 class IpcInterfaceCreator;
+class IpcFrame;
 
 /// @brief Class should never be used by the end-user.
 ///     Handles the common properties and methods for the IpcChannelType. The handling of
@@ -180,6 +184,14 @@ class IpcInterface
     ///         It also returns false if clock_gettime() failed
     bool timedReceive(const units::Duration timeout, IpcMessage& answer) const noexcept;
 
+    /// @brief Tries to receive a message in the binary or in the text encoding from the IPC channel within a
+    ///         specified timeout. It stores the message in frame without allocating memory on the heap.
+    /// @param[in] timeout for receiving a message.
+    /// @param[out] frame The received message. If timedReceive failed the content of frame is undefined.
+    /// @return If a valid message was received before the timeout occures
+    ///             it returns true, otherwise false.
+    bool timedReceive(const units::Duration timeout, IpcFrame& frame) const noexcept;
+
     /// @brief Tries to send the message specified in msg.
     /// @param[in] msg Must be a valid message, if its an invalid message
     ///                 send will return false
@@ -187,6 +199,13 @@ class IpcInterface
     ///             otherwise if the message was invalid it will return false.
     bool send(const IpcMessage& msg) const noexcept;
 
+    /// @brief Tries to send the frame specified in frame.
+    /// @param[in] frame Must be a valid frame, if its an invalid frame
+    ///                 send will return false
+    /// @return If a valid frame was send it returns true,
+    ///             otherwise if the frame was invalid it will return false.
+    bool send(const IpcFrame& frame) const noexcept;
+
     /// @brief Tries to send the message specified in msg to the message
     ///        queue within a specified timeout.
     /// @param[in] msg Must be a valid message, if its an invalid message
@@ -18,6 +18,7 @@
 #ifndef IOX_POSH_RUNTIME_IPC_RUNTIME_INTERFACE_HPP
 #define IOX_POSH_RUNTIME_IPC_RUNTIME_INTERFACE_HPP
 
+#include "iceoryx_posh/internal/runtime/ipc_frame.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iox/expected.hpp"
@@ -61,6 +62,12 @@ class IpcRuntimeInterface
     /// @return true if communication was successful, false if not
     bool sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept;
 
+    /// @brief send a request in the binary encoding to the RouDi daemon
+    /// @param[in] frame request to RouDi
+    /// @param[out] answer response from RouDi
+    /// @return true if communication was successful, false if not
+    bool sendRequestToRouDi(const IpcFrame& frame, IpcMessage& answer) noexcept;
+
     /// @brief get the adress offset of the segment manager
     /// @return address offset as iox::RelativePointer::offset_t
     UntypedRelativePointer::offset_t getSegmentManagerAddressOffset() const noexcept;
@@ -18,6 +18,7 @@
 #define IOX_POSH_RUNTIME_POSH_RUNTIME_IMPL_HPP
 
 #include "iceoryx_posh/internal/runtime/heartbeat.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_frame.hpp"
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/detail/periodic_task.hpp"
@@ -75,6 +76,9 @@ class PoshRuntimeImpl : public PoshRuntime
                         const popo::ServerOptions& ServerOptions = {},
                         const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept override;
 
+    /// @copydoc PoshRuntime::getMiddlewarePorts
+    bool getMiddlewarePorts(PortBatch& ports) noexcept override;
+
     /// @copydoc PoshRuntime::getMiddlewareInterface
     popo::InterfacePortData* getMiddlewareInterface(const capro::Interfaces commInterface,
                                                     const NodeName_t& nodeName = {""}) noexcept override;
@@ -82,6 +86,9 @@ class PoshRuntimeImpl : public PoshRuntime
     /// @copydoc PoshRuntime::getMiddlewareConditionVariable
     popo::ConditionVariableData* getMiddlewareConditionVariable() noexcept override;
 
+    /// @copydoc PoshRuntime::unmapPayloadSegments
+    uint64_t unmapPayloadSegments() noexcept override;
+
     /// @copydoc PoshRuntime::sendRequestToRouDi
     bool sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept override;
 
@@ -99,27 +106,98 @@ class PoshRuntimeImpl : public PoshRuntime
                     std::pair<IpcRuntimeInterface, optional<SharedMemoryUser>>&& interfaces) noexcept;
 
   private:
+    using RequestedPorts_t = vector<PortBatch::Index_t, PortBatch::MAX_PORTS_PER_REQUEST>;
+
+    /// @brief a port created by this runtime; required to check whether the application holds chunks before the
+    /// payload segments are unmapped
+    struct TrackedPort
+    {
+        PortKind kind;
+        void* portData{nullptr};
+    };
+    static constexpr uint64_t MAX_TRACKED_PORTS{MAX_PUBLISHERS + MAX_SUBSCRIBERS + MAX_CLIENTS + MAX_SERVERS};
+    using TrackedPorts_t = vector<TrackedPort, MAX_TRACKED_PORTS>;
+
+    enum class PortCreationFailure
+    {
+        INVALID_RESPONSE,
+        WRONG_IPC_MESSAGE_RESPONSE,
+    };
+
+    bool sendRequestToRouDi(const IpcFrame& frame, IpcMessage& answer) noexcept;
+
+    popo::PublisherOptions adjustPublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept;
+
+    popo::SubscriberOptions adjustSubscriberOptions(const capro::ServiceDescription& service,
+                                                    const popo::SubscriberOptions& subscriberOptions) const noexcept;
+
+    popo::ClientOptions adjustClientOptions(const popo::ClientOptions& clientOptions) const noexcept;
+
+    popo::ServerOptions adjustServerOptions(const popo::ServerOptions& serverOptions) const noexcept;
+
+    PortBatch::Entry adjustPortOptions(const PortBatch::Entry& port) const noexcept;
+
+    void reportPublisherCreationError(const capro::ServiceDescription& service,
+                                      const IpcMessageErrorType error) const noexcept;
+
+    void reportSubscriberCreationError(const capro::ServiceDescription& service,
+                                       const IpcMessageErrorType error) const noexcept;
+
+    void reportClientCreationError(const capro::ServiceDescription& service,
+                                   const IpcMessageErrorType error) const noexcept;
+
+    void reportServerCreationError(const capro::ServiceDescription& service,
+                                   const IpcMessageErrorType error) const noexcept;
+
+    void reportPortCreationError(const PortBatch::Entry& port) const noexcept;
+
+    /// @brief maps the payload segments a created publisher, client or server loans its chunks from, if the
+    /// payload segments are mapped on demand
+    void mapWritablePayloadSegments() noexcept;
+
+    /// @brief remembers a port created by this runtime and forgets the ports which were destroyed in the meantime
+    void trackPort(const PortKind kind, void* const portData) noexcept;
+
+    /// @brief checks whether the tracked port still belongs to this runtime, i.e. it was not destroyed and its
+    /// memory was not reused for a port of another runtime
+    bool isPortOfThisRuntime(const TrackedPort& port) const noexcept;
+
+    /// @brief checks whether the application holds any chunk which was loaned or received with the tracked port
+    static bool holdsChunks(const TrackedPort& port) noexcept;
+
+    /// @brief requests the ports with the given indices which were written to the send buffer and stores the
+    /// results in the batch
+    /// @return true if all requested ports were created
+    bool requestPortsFromRoudi(const IpcFrame& sendBuffer,
+                               PortBatch& ports,
+                               const RequestedPorts_t& requestedPorts) noexcept;
+
+    static IpcMessageType portCreationAck(const PortKind kind) noexcept;
+
+    static IpcMessageErrorType portCreationError(const PortKind kind, const PortCreationFailure failure) noexcept;
+
     expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    requestPublisherFromRoudi(const IpcFrame& sendBuffer) noexcept;
 
     expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    requestSubscriberFromRoudi(const IpcFrame& sendBuffer) noexcept;
 
     expected<popo::ClientPortUser::MemberType_t*, IpcMessageErrorType>
-    requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    requestClientFromRoudi(const IpcFrame& sendBuffer) noexcept;
 
     expected<popo::ServerPortUser::MemberType_t*, IpcMessageErrorType>
-    requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    requestServerFromRoudi(const IpcFrame& sendBuffer) noexcept;
 
     expected<popo::ConditionVariableData*, IpcMessageErrorType>
     requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
     expected<std::tuple<segment_id_underlying_t, UntypedRelativePointer::offset_t>, IpcMessageErrorType>
-    convert_id_and_offset(IpcMessage& msg);
+    convert_id_and_offset(IpcMessage& msg, const uint32_t offsetIndex = 1U);
 
   private:
     concurrent::smart_lock<IpcRuntimeInterface> m_ipcChannelInterface;
     optional<SharedMemoryUser> m_ShmInterface;
+    concurrent::smart_lock<TrackedPorts_t> m_trackedPorts;
 
     optional<Heartbeat*> m_heartbeat;
     void sendKeepAliveAndHandleShutdownPreparation() noexcept;
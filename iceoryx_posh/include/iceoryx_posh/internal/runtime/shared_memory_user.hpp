@@ -51,37 +51,62 @@ class SharedMemoryUser
     /// @param[in] managementShmSize size of the shared memory management segment
     /// @param[in] segmentManagerAddressOffset adress of the segment manager that does the final mapping of memory in
     /// the process
+    /// @param[in] memoryResidency defines whether the segments are prefaulted and locked in RAM when they are mapped;
+    /// for the payload segments the stronger one of this and the residency configured in RouDi is used
+    /// @param[in] payloadSegmentMapping defines whether the payload segments are mapped right away or on demand
     /// @return a 'SharedMemoryUser' instance or an 'SharedMemoryUserError' on failure
+    /// @note since relative pointers are resolved with a process wide registry, only one 'SharedMemoryUser' per
+    /// process can map the payload segments on demand
     static expected<SharedMemoryUser, SharedMemoryUserError>
     create(const DomainId domainId,
            const uint64_t segmentId,
            const uint64_t managementShmSize,
-           const UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
+           const UntypedRelativePointer::offset_t segmentManagerAddressOffset,
+           const roudi::MemoryResidency memoryResidency = roudi::MemoryResidency::OFF,
+           const PayloadSegmentMapping payloadSegmentMapping = PayloadSegmentMapping::ON_REGISTRATION) noexcept;
 
     ~SharedMemoryUser() noexcept;
 
-    SharedMemoryUser(SharedMemoryUser&&) noexcept = default;
-    SharedMemoryUser& operator=(SharedMemoryUser&&) noexcept = default;
+    SharedMemoryUser(SharedMemoryUser&& rhs) noexcept;
+    SharedMemoryUser& operator=(SharedMemoryUser&& rhs) noexcept;
 
     SharedMemoryUser(const SharedMemoryUser&) = delete;
     SharedMemoryUser& operator=(const SharedMemoryUser&) = delete;
 
+    /// @brief Maps the payload segments the application has write access to, if they are mapped on demand and not
+    /// mapped yet; this is done when ports are created which loan chunks, to avoid the mapping on the first loan
+    void mapWritablePayloadSegments() noexcept;
+
+    /// @brief Unmaps the payload segments which were mapped on demand; a segment is mapped again when it is accessed
+    /// the next time
+    /// @return the number of unmapped segments
+    /// @attention the application must not hold any chunk of these segments, i.e. all loaned and taken samples,
+    /// requests and responses must be released, and no other thread may access a chunk while this call is running
+    uint64_t unmapPayloadSegments() noexcept;
+
   private:
-    SharedMemoryUser(ShmVector_t&& payloadShm) noexcept;
+    SharedMemoryUser(ShmVector_t&& payloadShm, const bool mapsPayloadSegmentsOnDemand) noexcept;
+
+    void destroy() noexcept;
 
     static void destroy(ShmVector_t& shmSegments) noexcept;
 
-    static expected<void, SharedMemoryUserError> openShmSegment(ShmVector_t& shmSegments,
-                                                                const DomainId domainId,
-                                                                const uint64_t segmentId,
-                                                                const ResourceType resourceType,
-                                                                const ShmName_t& shmName,
-                                                                const uint64_t shmSize,
-                                                                const AccessMode accessMode) noexcept;
+    static expected<PosixSharedMemoryObject, SharedMemoryUserError>
+    openShmSegment(const DomainId domainId,
+                   const uint64_t segmentId,
+                   const ResourceType resourceType,
+                   const ShmName_t& shmName,
+                   const uint64_t shmSize,
+                   const AccessMode accessMode,
+                   const bool useHugePages = false,
+                   const roudi::MemoryResidency memoryResidency = roudi::MemoryResidency::OFF) noexcept;
 
+    /// @brief registers the payload segment of the id when a relative pointer into it is resolved the first time
+    static void* mapPayloadSegmentOnDemand(const segment_id_underlying_t segmentId) noexcept;
 
   private:
     ShmVector_t m_shmSegments;
+    bool m_mapsPayloadSegmentsOnDemand{false};
 };
 
 } // namespace runtime
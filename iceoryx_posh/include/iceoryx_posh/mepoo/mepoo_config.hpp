@@ -17,6 +17,7 @@
 #define IOX_POSH_MEPOO_MEPOO_CONFIG_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/numa_placement.hpp"
 #include "iox/vector.hpp"
 
 #include <cstdint>
@@ -29,23 +30,56 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines what happens when the best fitting mempool for a chunk is exhausted
+/// NONE - the chunk allocation fails
+/// NEXT_LARGER_MEMPOOL - the chunk is acquired from the next larger mempool which still has free chunks
+enum class MemPoolFallbackPolicy : uint8_t
+{
+    NONE,
+    NEXT_LARGER_MEMPOOL
+};
+
+/// @brief Defines where the ChunkManagement with the reference counter of a chunk is stored
+/// SEPARATE_POOL - the ChunkManagement is acquired from a dedicated pool in the management memory
+/// EMBEDDED - the ChunkManagement is stored in a reserved prefix of the chunk itself, which saves the additional
+///            free list operations of the separate pool on each chunk acquisition and release
+enum class ChunkManagementLayout : uint8_t
+{
+    SEPARATE_POOL,
+    EMBEDDED
+};
+
 struct MePooConfig
 {
   public:
     struct Entry
     {
         /// @brief set the size and count of memory chunks
-        Entry(uint64_t size, uint32_t chunkCount) noexcept
+        /// @param[in] size of the chunk-payload
+        /// @param[in] chunkCount is the number of chunks
+        /// @param[in] threadCacheCapacity is the number of free chunks each thread can keep in a thread local cache;
+        /// 0 disables the thread cache
+        /// @param[in] numaPlacement defines on which NUMA node(s) the chunks of the mempool are placed
+        Entry(uint64_t size,
+              uint32_t chunkCount,
+              uint32_t threadCacheCapacity = 0U,
+              NumaPlacement numaPlacement = NumaPlacement()) noexcept
             : m_size(size)
             , m_chunkCount(chunkCount)
+            , m_threadCacheCapacity(threadCacheCapacity)
+            , m_numaPlacement(numaPlacement)
         {
         }
         uint64_t m_size{0};
         uint32_t m_chunkCount{0};
+        uint32_t m_threadCacheCapacity{0};
+        NumaPlacement m_numaPlacement;
     };
 
     using MePooConfigContainerType = vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    MemPoolFallbackPolicy m_fallbackPolicy{MemPoolFallbackPolicy::NONE};
+    ChunkManagementLayout m_chunkManagementLayout{ChunkManagementLayout::SEPARATE_POOL};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
@@ -34,11 +34,15 @@ struct SegmentConfig
         SegmentEntry(const PosixGroup::groupName_t& readerGroup,
                      const PosixGroup::groupName_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const bool useHugePages = false,
+                     const NumaPlacement numaPlacement = NumaPlacement()) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_useHugePages(useHugePages)
+            , m_numaPlacement(numaPlacement)
 
         {
         }
@@ -47,6 +51,10 @@ struct SegmentConfig
         PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        /// @brief if true the segment is backed by huge pages when they are available on the system
+        bool m_useHugePages{false};
+        /// @brief defines on which NUMA node(s) the segment is placed; the placement of a mempool takes precedence
+        NumaPlacement m_numaPlacement;
     };
 
     vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
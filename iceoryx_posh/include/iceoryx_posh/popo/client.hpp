@@ -22,6 +22,7 @@
 namespace iox::posh::experimental
 {
 class ClientBuilder;
+class PortBatch;
 }
 
 namespace iox
@@ -46,6 +47,7 @@ class Client : public ClientImpl<Req, Res>
 
   private:
     friend class iox::posh::experimental::ClientBuilder;
+    friend class iox::posh::experimental::PortBatch;
 
     explicit Client(typename ClientImpl<Req, Res>::PortType&& port) noexcept
         : ClientImpl<Req, Res>(std::move(port))
@@ -22,12 +22,17 @@
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_statistics.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/atomic.hpp"
+#include "iox/detail/mpmc_lockfree_queue.hpp"
 #include "iox/detail/mpmc_loffli.hpp"
 #include "iox/expected.hpp"
 #include "iox/function.hpp"
 #include "iox/smart_lock.hpp"
+#include "iox/thread.hpp"
+#include "iox/unnamed_semaphore.hpp"
+#include "iox/vector.hpp"
 
 #include <thread>
 
@@ -83,9 +88,32 @@ enum class ListenerError
     EMPTY_EVENT_CALLBACK,
 };
 
+/// @brief The priority class of an attached event. When multiple events are ready, the callbacks of a higher priority
+///        class are executed before the ones of a lower class, e.g. to let cheap control callbacks overtake heavy ones.
+enum class ListenerEventPriority : uint8_t
+{
+    HIGH,
+    NORMAL,
+    LOW
+};
+
+/// @brief Configures how the Listener executes the callbacks
+struct ListenerOptions
+{
+    /// @brief The number of worker threads which execute the callbacks, limited to
+    ///        MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER. With zero, the default, the callbacks are executed by the
+    ///        background thread which waits for the events. With worker threads, a slow callback delays only the
+    ///        events which are processed by the same worker.
+    uint32_t numberOfWorkerThreads{0U};
+    /// @brief The CPU affinity and the scheduling policy of the background thread and of the worker threads
+    ThreadSchedulingOptions threadSchedulingOptions;
+};
+
 /// @brief The Listener is a class which reacts to registered events by
 ///        executing a corresponding callback concurrently. This is achieved via
 ///        an encapsulated thread inside this class.
+///        Optionally, the callbacks are executed by a pool of worker threads, see ListenerOptions. The callback of
+///        one event is never executed concurrently, but the callbacks of different events are.
 /// @note  The Listener is threadsafe and can be used without any restrictions concurrently.
 /// @attention Calling detachEvent for the same event from multiple threads is supported but
 ///            can cause a race condition if you attach the same event again concurrently from
@@ -108,6 +136,7 @@ class Listener
 {
   public:
     Listener() noexcept;
+    explicit Listener(const ListenerOptions& options) noexcept;
     Listener(const Listener&) = delete;
     Listener(Listener&&) = delete;
     ~Listener() noexcept;
@@ -126,14 +155,17 @@ class Listener
     /// @param[in] eventType enum required to specify the type of event inside of eventOrigin
     /// @param[in] eventCallback callback which will be executed concurrently when the event occurs. has to be created
     /// with iox::popo::createNotificationCallback
+    /// @param[in] priority the priority class of the event
     /// @return If an error occurs the enum packed inside an expected which describes the error.
     template <typename T,
               typename EventType,
               typename ContextDataType,
               typename = std::enable_if_t<std::is_enum<EventType>::value>>
-    expected<void, ListenerError> attachEvent(T& eventOrigin,
-                                              const EventType eventType,
-                                              const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+    expected<void, ListenerError>
+    attachEvent(T& eventOrigin,
+                const EventType eventType,
+                const NotificationCallback<T, ContextDataType>& eventCallback,
+                const ListenerEventPriority priority = ListenerEventPriority::NORMAL) noexcept;
 
     /// @brief Attaches an event. Hereby the event is defined as a class T, the eventOrigin and
     ///        the corresponding callback which will be called when the event occurs.
@@ -144,10 +176,13 @@ class Listener
     /// @param[in] eventOrigin the object which will signal the event (the origin)
     /// @param[in] eventCallback callback which will be executed concurrently when the event occurs. Has to be created
     /// with iox::popo::createNotificationCallback
+    /// @param[in] priority the priority class of the event
     /// @return If an error occurs the enum packed inside an expected which describes the error.
     template <typename T, typename ContextDataType>
-    expected<void, ListenerError> attachEvent(T& eventOrigin,
-                                              const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+    expected<void, ListenerError>
+    attachEvent(T& eventOrigin,
+                const NotificationCallback<T, ContextDataType>& eventCallback,
+                const ListenerEventPriority priority = ListenerEventPriority::NORMAL) noexcept;
 
     /// @brief Detaches an event. Hereby, the event is defined as a class T, the eventOrigin and
     ///        the eventType with further specifies the event inside of eventOrigin
@@ -172,21 +207,53 @@ class Listener
     /// @return size of the Listener
     uint64_t size() const noexcept;
 
+    /// @brief Enables the busy-poll mode. The background thread polls the events for the provided duration before it
+    ///        blocks. This reduces the wake-up latency at the cost of a busy CPU core while waiting.
+    /// @note This method can be called from any thread concurrently. It affects the next wait of the background
+    ///        thread, a wait which is already blocking is not interrupted.
+    /// @param[in] duration how long to poll before blocking; zero, the default, disables the busy polling
+    void setBusyPollDuration(const units::Duration duration) noexcept;
+
+    /// @brief Returns how many waits were served by busy polling or had to block and the average wake-up latency
+    /// @note This method can be called from any thread concurrently
+    WaitStatistics getStatistics() const noexcept;
+
   protected:
     friend class iox::posh::experimental::ListenerBuilder;
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const ListenerOptions& options = {}) noexcept;
 
   private:
     class Event_t;
 
+    /// @brief the dispatch state of an event when the callbacks are executed by worker threads
+    enum class EventState : uint8_t
+    {
+        /// neither queued nor executed
+        IDLE,
+        /// waits in the queue of its priority class for a worker
+        QUEUED,
+        /// the callback is executed by a worker
+        RUNNING,
+        /// the callback is executed by a worker and the event was notified again in the meantime; the worker queues
+        /// the event again when the callback returns
+        RUNNING_AND_NOTIFIED
+    };
+
+    static constexpr uint64_t NUMBER_OF_PRIORITIES{static_cast<uint64_t>(ListenerEventPriority::LOW) + 1U};
+
     void threadLoop() noexcept;
+    void workerLoop() noexcept;
+    void executeQueuedEvent(const uint32_t index) noexcept;
+    void dispatchToWorker(const uint64_t index) noexcept;
+    void enqueue(const uint64_t index) noexcept;
     expected<uint32_t, ListenerError> addEvent(void* const origin,
                                                void* const userType,
                                                const uint64_t eventType,
                                                const uint64_t eventTypeHash,
                                                internal::GenericCallbackRef_t callback,
                                                internal::TranslationCallbackRef_t translationCallback,
-                                               const function<void(uint64_t)> invalidationCallback) noexcept;
+                                               const function<void(uint64_t)> invalidationCallback,
+                                               const ListenerEventPriority priority) noexcept;
 
     void removeTrigger(const uint64_t index) noexcept;
 
@@ -214,9 +281,19 @@ class Listener
     } m_indexManager;
 
 
+    ThreadSchedulingOptions m_threadSchedulingOptions;
     std::thread m_thread;
     concurrent::smart_lock<internal::Event_t, std::recursive_mutex> m_events[MAX_NUMBER_OF_EVENTS];
     std::mutex m_addEventMutex;
+    /// @brief stored outside of the events since the background thread must not wait for a running callback
+    concurrent::Atomic<ListenerEventPriority> m_eventPriorities[MAX_NUMBER_OF_EVENTS];
+
+    vector<std::thread, MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER> m_workerThreads;
+    concurrent::Atomic<EventState> m_eventStates[MAX_NUMBER_OF_EVENTS];
+    /// @brief an event is queued at most once, therefore the capacity of each queue suffices for all events
+    concurrent::MpmcLockFreeQueue<uint32_t, MAX_NUMBER_OF_EVENTS> m_queuedEvents[NUMBER_OF_PRIORITIES];
+    /// @brief counts the queued events to let the workers sleep while there is nothing to do
+    optional<UnnamedSemaphore> m_workerSemaphore;
 
     concurrent::Atomic<bool> m_wasDtorCalled{false};
     ConditionVariableData* m_conditionVariableData = nullptr;
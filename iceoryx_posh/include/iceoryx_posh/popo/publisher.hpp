@@ -23,6 +23,7 @@
 namespace iox::posh::experimental
 {
 class PublisherBuilder;
+class PortBatch;
 }
 
 namespace iox
@@ -40,6 +41,7 @@ class Publisher : public PublisherImpl<T, H>
 
   private:
     friend class iox::posh::experimental::PublisherBuilder;
+    friend class iox::posh::experimental::PortBatch;
 
     explicit Publisher(typename PublisherImpl<T, H>::PortType&& port) noexcept
         : PublisherImpl<T, H>(std::move(port))
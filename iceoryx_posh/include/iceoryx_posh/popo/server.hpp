@@ -22,6 +22,7 @@
 namespace iox::posh::experimental
 {
 class ServerBuilder;
+class PortBatch;
 }
 
 namespace iox
@@ -46,6 +47,7 @@ class Server : public ServerImpl<Req, Res>
 
   private:
     friend class iox::posh::experimental::ServerBuilder;
+    friend class iox::posh::experimental::PortBatch;
 
     explicit Server(typename ServerImpl<Req, Res>::PortType&& port) noexcept
         : ServerImpl<Req, Res>(std::move(port))
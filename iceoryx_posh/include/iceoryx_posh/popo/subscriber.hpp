@@ -23,6 +23,7 @@
 namespace iox::posh::experimental
 {
 class SubscriberBuilder;
+class PortBatch;
 }
 
 namespace iox
@@ -47,6 +48,7 @@ class Subscriber : public SubscriberImpl<T, H>
 
   private:
     friend class iox::posh::experimental::SubscriberBuilder;
+    friend class iox::posh::experimental::PortBatch;
 
     explicit Subscriber(typename SubscriberImpl<T, H>::PortType&& port) noexcept
         : SubscriberImpl<T, H>(std::move(port))
@@ -0,0 +1,112 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_TIMER_TRIGGER_HPP
+#define IOX_POSH_POPO_TIMER_TRIGGER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iox/duration.hpp"
+#include "iox/expected.hpp"
+
+#include <cstdint>
+#include <mutex>
+
+namespace iox
+{
+namespace popo
+{
+enum class TimerTriggerMode : uint8_t
+{
+    /// @brief the TimerTrigger triggers once after the interval
+    ONE_SHOT,
+    /// @brief the TimerTrigger triggers every interval; the deadlines are multiples of the interval after the start
+    /// so that late wake-ups do not accumulate drift
+    PERIODIC
+};
+
+enum class TimerTriggerError : uint8_t
+{
+    INVALID_INTERVAL
+};
+
+/// @brief An event based trigger which triggers the WaitSet/Listener it is attached to when its interval elapsed.
+///        The deadlines are measured with the monotonic clock and are expired by the thread which waits in the
+///        WaitSet/Listener, no additional thread is required. At most MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE
+///        TimerTriggers can be attached to a single WaitSet/Listener.
+/// @note When the WaitSet is used with its file descriptor, the file descriptor does not become readable at the
+///       deadline; the expired TimerTriggers are returned by the next call of a wait method
+class TimerTrigger
+{
+  public:
+    TimerTrigger() noexcept;
+    ~TimerTrigger() noexcept;
+    TimerTrigger(const TimerTrigger& rhs) = delete;
+    TimerTrigger(TimerTrigger&& rhs) = delete;
+    TimerTrigger& operator=(const TimerTrigger& rhs) = delete;
+    TimerTrigger& operator=(TimerTrigger&& rhs) = delete;
+
+    /// @brief Starts the timer, a running timer is restarted. The interval begins with this call even when the
+    /// TimerTrigger is attached later.
+    /// @param[in] interval the time after which the TimerTrigger triggers, must be greater than zero
+    /// @param[in] mode whether the TimerTrigger triggers once or periodically
+    /// @return TimerTriggerError::INVALID_INTERVAL when the interval is zero
+    expected<void, TimerTriggerError> start(const units::Duration interval, const TimerTriggerMode mode) noexcept;
+
+    /// @brief Stops the timer; a notification of an already expired deadline is still delivered
+    void stop() noexcept;
+
+    /// @brief Checks if the timer is running
+    /// @return false when the timer was stopped, never started or is an attached one-shot timer which already expired
+    bool isRunning() const noexcept;
+
+    /// @brief Checks if the TimerTrigger was triggered
+    /// @return true if the TimerTrigger is triggered, otherwise false.
+    /// @note The hasTrigger state will be reset after it was handled by a WaitSet/Listener
+    bool hasTriggered() const noexcept;
+
+    friend class NotificationAttorney;
+
+  private:
+    /// @brief Only usable by the WaitSet, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    void enableEvent(iox::popo::TriggerHandle&& triggerHandle) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Resets the internal triggerHandle
+    void disableEvent() noexcept;
+
+    void acquireTimer() noexcept;
+    void armTimer() noexcept;
+    void releaseTimer() noexcept;
+
+  private:
+    mutable std::recursive_mutex m_mutex;
+    TriggerHandle m_trigger;
+    ConditionVariableData::Timer_t* m_timer{nullptr};
+    uint64_t m_firstDeadline{0U};
+    uint64_t m_intervalInNanoseconds{0U};
+    TimerTriggerMode m_mode{TimerTriggerMode::ONE_SHOT};
+    bool m_isStarted{false};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_TIMER_TRIGGER_HPP
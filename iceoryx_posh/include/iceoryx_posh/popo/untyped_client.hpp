@@ -22,6 +22,7 @@
 namespace iox::posh::experimental
 {
 class ClientBuilder;
+class PortBatch;
 }
 
 namespace iox
@@ -42,6 +43,7 @@ class UntypedClient : public UntypedClientImpl<>
 
   private:
     friend class iox::posh::experimental::ClientBuilder;
+    friend class iox::posh::experimental::PortBatch;
 
     explicit UntypedClient(typename UntypedClientImpl<>::PortType&& port) noexcept
         : UntypedClientImpl<>(std::move(port))
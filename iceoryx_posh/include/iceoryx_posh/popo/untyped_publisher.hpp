@@ -23,6 +23,7 @@
 namespace iox::posh::experimental
 {
 class PublisherBuilder;
+class PortBatch;
 }
 
 namespace iox
@@ -37,6 +38,7 @@ class UntypedPublisher : public UntypedPublisherImpl<>
 
   private:
     friend class iox::posh::experimental::PublisherBuilder;
+    friend class iox::posh::experimental::PortBatch;
 
     explicit UntypedPublisher(typename UntypedPublisherImpl<>::PortType&& port) noexcept
         : UntypedPublisherImpl<>(std::move(port))
@@ -22,6 +22,7 @@
 namespace iox::posh::experimental
 {
 class ServerBuilder;
+class PortBatch;
 }
 
 namespace iox
@@ -42,6 +43,7 @@ class UntypedServer : public UntypedServerImpl<>
 
   private:
     friend class iox::posh::experimental::ServerBuilder;
+    friend class iox::posh::experimental::PortBatch;
 
     explicit UntypedServer(typename UntypedServerImpl<>::PortType&& port) noexcept
         : UntypedServerImpl<>(std::move(port))
@@ -23,6 +23,7 @@
 namespace iox::posh::experimental
 {
 class SubscriberBuilder;
+class PortBatch;
 }
 
 namespace iox
@@ -44,6 +45,7 @@ class UntypedSubscriber : public UntypedSubscriberImpl<>
 
   private:
     friend class iox::posh::experimental::SubscriberBuilder;
+    friend class iox::posh::experimental::PortBatch;
 
     explicit UntypedSubscriber(typename UntypedSubscriberImpl<>::PortType&& port) noexcept
         : UntypedSubscriberImpl<>(std::move(port))
@@ -26,6 +26,7 @@
 #include "iceoryx_posh/popo/notification_info.hpp"
 #include "iceoryx_posh/popo/trigger.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_statistics.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/assertions.hpp"
@@ -49,6 +50,7 @@ enum class WaitSetError : uint8_t
 {
     WAIT_SET_FULL,
     ALREADY_ATTACHED,
+    FILE_DESCRIPTOR_NOT_AVAILABLE,
 };
 
 /// @brief Logical disjunction of a certain number of Triggers
@@ -206,6 +208,29 @@ class WaitSet
     /// @return NotificationInfoVector of NotificationInfos that have been triggered
     NotificationInfoVector wait() noexcept;
 
+    /// @brief Non-blocking wait which returns the triggers that are triggered right now; intended to be called when the
+    /// file descriptor returned by getFileDescriptor() is readable
+    /// @return NotificationInfoVector of NotificationInfos that have been triggered, can be empty
+    NotificationInfoVector tryWait() noexcept;
+
+    /// @brief Returns a file descriptor which becomes readable when an attached event is triggered. It can be added to
+    /// an existing event loop, e.g. an epoll set, which calls tryWait() when it is readable. This avoids a dedicated
+    /// thread which blocks in wait().
+    /// @note A state based trigger whose state is still satisfied after tryWait() does not make the file descriptor
+    /// readable again, it is returned by the next tryWait(). The first call creates the underlying socket and is not
+    /// thread-safe.
+    /// @return the file descriptor or WaitSetError::FILE_DESCRIPTOR_NOT_AVAILABLE if it could not be created
+    expected<int32_t, WaitSetError> getFileDescriptor() noexcept;
+
+    /// @brief Enables the busy-poll mode. wait() and timedWait() poll the triggers for the provided duration before
+    /// they block. This reduces the wake-up latency at the cost of a busy CPU core while waiting. An attached
+    /// TimerTrigger which is due earlier shortens the polling.
+    /// @param[in] duration how long to poll before blocking; zero, the default, disables the busy polling
+    void setBusyPollDuration(const units::Duration duration) noexcept;
+
+    /// @brief Returns how many waits were served by busy polling or had to block and the average wake-up latency
+    WaitStatistics getStatistics() const noexcept;
+
     /// @brief Returns the amount of stored Trigger inside of the WaitSet
     uint64_t size() const noexcept;
 
@@ -0,0 +1,43 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_WAIT_STATISTICS_HPP
+#define IOX_POSH_POPO_WAIT_STATISTICS_HPP
+
+#include "iox/duration.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Statistics about how the waits of a WaitSet or Listener were served
+struct WaitStatistics
+{
+    /// @brief number of waits which were served while busy polling, without blocking on the semaphore
+    uint64_t spinHits{0U};
+    /// @brief number of times the waiting thread blocked on the semaphore
+    uint64_t blockingWaits{0U};
+    /// @brief average time from the first notification until the waiting thread returned with the notifications;
+    /// only waits which actually had to wait for a notification are taken into account
+    units::Duration averageWakeUpLatency{units::Duration::zero()};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_WAIT_STATISTICS_HPP
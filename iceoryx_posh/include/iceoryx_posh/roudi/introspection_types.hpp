@@ -52,9 +52,14 @@ using MemPoolInfoContainer = vector<MemPoolInfo, MAX_NUMBER_OF_MEMPOOLS>;
 struct MemPoolIntrospectionInfo
 {
     using GroupName_t = string<MAX_GROUP_NAME_LENGTH>;
+    static constexpr int32_t UNKNOWN_NUMA_NODE{-1};
     uint32_t m_id;
     GroupName_t m_writerGroupName;
     GroupName_t m_readerGroupName;
+    /// @brief size of the pages which back the segment; larger than the system page size for huge pages
+    uint64_t m_pageSize;
+    /// @brief NUMA node on which the segment is placed; UNKNOWN_NUMA_NODE e.g. when NUMA is not supported
+    int32_t m_numaNode;
     MemPoolInfoContainer m_mempoolInfo;
 };
 
@@ -41,10 +41,12 @@ class PosixShmMemoryProvider : public MemoryProvider
     /// @param[in] domainId to tie the shared memory to
     /// @param [in] accessMode defines the read and write access to the memory
     /// @param [in] openMode defines the creation/open mode of the shared memory.
+    /// @param [in] memoryResidency defines whether the shared memory is prefaulted and locked in RAM when created
     PosixShmMemoryProvider(const ShmName_t& shmName,
                            const DomainId domainId,
                            const AccessMode accessMode,
-                           const OpenMode openMode) noexcept;
+                           const OpenMode openMode,
+                           const MemoryResidency memoryResidency = MemoryResidency::OFF) noexcept;
     ~PosixShmMemoryProvider() noexcept;
 
     PosixShmMemoryProvider(PosixShmMemoryProvider&&) = delete;
@@ -67,6 +69,7 @@ class PosixShmMemoryProvider : public MemoryProvider
     const DomainId m_domainId;
     AccessMode m_accessMode{AccessMode::ReadOnly};
     OpenMode m_openMode{OpenMode::OpenExisting};
+    MemoryResidency m_memoryResidency{MemoryResidency::OFF};
     optional<PosixSharedMemoryObject> m_shmObject;
 
     static constexpr access_rights SHM_MEMORY_PERMISSIONS =
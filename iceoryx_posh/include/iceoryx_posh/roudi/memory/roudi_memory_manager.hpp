@@ -53,6 +53,11 @@ class RouDiMemoryManager
 {
   public:
     RouDiMemoryManager() noexcept = default;
+
+    /// @brief Creates a RouDiMemoryManager which additionally reports how long it took to make the memory resident
+    /// @param [in] memoryResidency is the residency the registered MemoryProvider and MemoryBlocks are configured with
+    explicit RouDiMemoryManager(const MemoryResidency memoryResidency) noexcept;
+
     /// @brief The Destructor of the RouDiMemoryManager also calls destroy on the registered MemoryProvider
     virtual ~RouDiMemoryManager() noexcept;
 
@@ -79,6 +84,7 @@ class RouDiMemoryManager
 
   private:
     vector<MemoryProvider*, MAX_NUMBER_OF_MEMORY_PROVIDER> m_memoryProvider;
+    MemoryResidency m_memoryResidency{MemoryResidency::OFF};
 };
 } // namespace roudi
 } // namespace iox
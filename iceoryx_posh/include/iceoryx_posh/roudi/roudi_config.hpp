@@ -18,6 +18,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
+#include "iox/thread.hpp"
 
 #include <cstdint>
 
@@ -25,6 +26,23 @@ namespace iox
 {
 namespace config
 {
+/// @brief The number of ports of each kind the PortPool of RouDi provides. The management segment only contains the
+/// storage for these ports, the numbers are however bounded by the compile time maxima like MAX_PUBLISHERS
+struct PortPoolCapacity
+{
+    uint32_t publishers{MAX_PUBLISHERS};
+    uint32_t subscribers{MAX_SUBSCRIBERS};
+    uint32_t servers{MAX_SERVERS};
+    uint32_t clients{MAX_CLIENTS};
+    uint32_t interfaces{MAX_INTERFACE_NUMBER};
+    uint32_t conditionVariables{MAX_NUMBER_OF_CONDITION_VARIABLES};
+
+    /// @brief limits the numbers to the compile time maxima and ensures that there are enough publishers for the
+    /// internal publishers of RouDi
+    /// @return a reference to the adjusted capacity
+    PortPoolCapacity& clamp() noexcept;
+};
+
 struct RouDiConfig
 {
     /// @brief The domain ID which is used to tie the iceoryx resources to when created in the file system
@@ -38,6 +56,8 @@ struct RouDiConfig
     iox::log::LogLevel logLevel{iox::log::LogLevel::Info};
     /// @brief Specifies whether RouDi monitors the process for abnormal termination
     roudi::MonitoringMode monitoringMode{roudi::MonitoringMode::OFF};
+    /// @brief Specifies whether the management and payload segments are prefaulted and locked in RAM at startup
+    roudi::MemoryResidency memoryResidency{roudi::MemoryResidency::OFF};
     /// @brief Specifies to which level the compatibility of applications trying to register with RouDi should be
     /// checked
     version::CompatibilityCheckLevel compatibilityCheckLevel{version::CompatibilityCheckLevel::PATCH};
@@ -46,6 +66,13 @@ struct RouDiConfig
     /// @brief Sets the delay in seconds before RouDi sends SIGKILL to application which did not respond to the initial
     /// SIGTERM signal
     units::Duration processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    /// @brief The CPU affinity and the scheduling policy of the threads spawned by RouDi
+    ThreadSchedulingOptions threadSchedulingOptions;
+    /// @brief The number of threads which process the messages of the runtimes; the messages of one runtime are always
+    /// processed in order by the same thread. With a single thread the messages are processed by the receiving thread
+    uint32_t runtimeMessageWorkerCount{1U};
+    /// @brief The number of ports of each kind RouDi reserves memory for in the management segment
+    PortPoolCapacity portPoolCapacity;
 
     // have some spare chunks to still deliver introspection data in case there are multiple subscribers to the data
     // which are caching different samples; could probably be reduced to 2 with the instruction to not cache the
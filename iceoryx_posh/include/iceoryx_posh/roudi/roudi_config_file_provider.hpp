@@ -35,6 +35,12 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// MEMPOOL_THREAD_CACHE_CAPACITY_EXCEEDED - the thread cache of a mempool exceeds MAX_MEMPOOL_THREAD_CACHE_CAPACITY
+/// INVALID_NUMA_NODE - the NUMA node of a segment or mempool is neither a node number nor "interleave"
+/// INVALID_THREAD_CPU_AFFINITY - the CPU affinity of the RouDi threads is not a non-empty list of CPUs in [0, 63]
+/// INVALID_THREAD_FIFO_PRIORITY - the FIFO priority of the RouDi threads is outside of the range of the scheduler
+/// INVALID_PORT_POOL_CAPACITY - a number of ports exceeds the compile time maximum or there are fewer publishers than
+/// RouDi uses internally
 enum class RouDiConfigFileParseError
 {
     FILE_OPEN_FAILED,
@@ -46,6 +52,11 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    MEMPOOL_THREAD_CACHE_CAPACITY_EXCEEDED,
+    INVALID_NUMA_NODE,
+    INVALID_THREAD_CPU_AFFINITY,
+    INVALID_THREAD_FIFO_PRIORITY,
+    INVALID_PORT_POOL_CAPACITY,
     EXCEPTION_IN_PARSER
 };
 
@@ -58,6 +69,11 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"FILE_OPEN_FAIL
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "MEMPOOL_THREAD_CACHE_CAPACITY_EXCEEDED",
+                                                                 "INVALID_NUMA_NODE",
+                                                                 "INVALID_THREAD_CPU_AFFINITY",
+                                                                 "INVALID_THREAD_FIFO_PRIORITY",
+                                                                 "INVALID_PORT_POOL_CAPACITY",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
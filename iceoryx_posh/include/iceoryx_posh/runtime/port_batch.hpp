@@ -0,0 +1,163 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_PORT_BATCH_HPP
+#define IOX_POSH_RUNTIME_PORT_BATCH_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/optional.hpp"
+#include "iox/variant.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief The kind of a port in a PortBatch; the value is the index of the options in PortBatch::Options_t
+enum class PortKind : uint8_t
+{
+    PUBLISHER,
+    SUBSCRIBER,
+    CLIENT,
+    SERVER,
+};
+
+/// @brief A set of publishers, subscribers, clients and servers which are requested from RouDi at once, see
+/// PoshRuntime::getMiddlewarePorts. The ports share the round trips to RouDi instead of needing one each, which
+/// shortens the startup of applications with many ports.
+/// @code
+///     PortBatch batch;
+///     auto publisherIndex = batch.addPublisher({"Radar", "FrontLeft", "Object"});
+///     auto subscriberIndex = batch.addSubscriber({"Radar", "FrontRight", "Object"});
+///
+///     PoshRuntime::getInstance().getMiddlewarePorts(batch);
+///     auto* publisherPortData = batch.takePublisher(publisherIndex.value());
+/// @endcode
+class PortBatch
+{
+  public:
+    /// @brief The maximum number of ports in a batch
+    static constexpr uint64_t CAPACITY{32U};
+
+    /// @brief The maximum number of ports which are requested with one message. The answer of RouDi contains the
+    /// relative pointers to all ports of the request and must fit into one message of the IPC channel.
+    static constexpr uint64_t MAX_PORTS_PER_REQUEST{8U};
+
+    using Index_t = uint64_t;
+    using Options_t =
+        variant<popo::PublisherOptions, popo::SubscriberOptions, popo::ClientOptions, popo::ServerOptions>;
+
+    /// @brief A port of the batch with the result of its creation
+    struct Entry
+    {
+        capro::ServiceDescription service;
+        Options_t options;
+        PortConfigInfo portConfigInfo;
+
+        /// @brief The port created by RouDi, nullptr if the port was not created yet or already taken
+        void* portData{nullptr};
+
+        /// @brief The reason why the port could not be created, IpcMessageErrorType::NOTYPE otherwise
+        IpcMessageErrorType error{IpcMessageErrorType::NOTYPE};
+
+        /// @brief Returns the kind of the port which is determined by its options
+        PortKind kind() const noexcept;
+    };
+
+    /// @brief Adds a publisher to the batch
+    /// @return the index of the publisher in the batch or nullopt if the batch is full
+    optional<Index_t> addPublisher(const capro::ServiceDescription& service,
+                                   const popo::PublisherOptions& publisherOptions = {},
+                                   const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief Adds a subscriber to the batch
+    /// @return the index of the subscriber in the batch or nullopt if the batch is full
+    optional<Index_t> addSubscriber(const capro::ServiceDescription& service,
+                                    const popo::SubscriberOptions& subscriberOptions = {},
+                                    const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief Adds a client to the batch
+    /// @return the index of the client in the batch or nullopt if the batch is full
+    optional<Index_t> addClient(const capro::ServiceDescription& service,
+                                const popo::ClientOptions& clientOptions = {},
+                                const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief Adds a server to the batch
+    /// @return the index of the server in the batch or nullopt if the batch is full
+    optional<Index_t> addServer(const capro::ServiceDescription& service,
+                                const popo::ServerOptions& serverOptions = {},
+                                const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief Adds an entry, e.g. one which was received from a runtime
+    /// @return the index of the entry in the batch or nullopt if the batch is full
+    optional<Index_t> add(const Entry& entry) noexcept;
+
+    /// @brief Hands over the created publisher port; the caller is responsible to wrap it into a port user
+    /// @return the port data or nullptr if the entry is no publisher, was not created or was already taken
+    PublisherPortUserType::MemberType_t* takePublisher(const Index_t index) noexcept;
+
+    /// @brief Hands over the created subscriber port; the caller is responsible to wrap it into a port user
+    /// @return the port data or nullptr if the entry is no subscriber, was not created or was already taken
+    SubscriberPortUserType::MemberType_t* takeSubscriber(const Index_t index) noexcept;
+
+    /// @brief Hands over the created client port; the caller is responsible to wrap it into a port user
+    /// @return the port data or nullptr if the entry is no client, was not created or was already taken
+    popo::ClientPortData* takeClient(const Index_t index) noexcept;
+
+    /// @brief Hands over the created server port; the caller is responsible to wrap it into a port user
+    /// @return the port data or nullptr if the entry is no server, was not created or was already taken
+    popo::ServerPortData* takeServer(const Index_t index) noexcept;
+
+    /// @brief Returns the reason why the port could not be created or IpcMessageErrorType::NOTYPE if there is none
+    IpcMessageErrorType getError(const Index_t index) const noexcept;
+
+    /// @brief Access to the entries for the runtime and RouDi; terminates if the index is out of bounds
+    Entry& operator[](const Index_t index) noexcept;
+
+    /// @copydoc PortBatch::operator[]
+    const Entry& operator[](const Index_t index) const noexcept;
+
+    uint64_t size() const noexcept;
+
+    bool empty() const noexcept;
+
+    /// @brief Removes all entries; ports which were created but not taken stay alive until the runtime terminates
+    void clear() noexcept;
+
+  private:
+    template <typename PortData>
+    PortData* take(const Index_t index, const PortKind kind) noexcept;
+
+    vector<Entry, CAPACITY> m_entries;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_BATCH_HPP
@@ -29,6 +29,7 @@
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_batch.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iox/atomic.hpp"
 #include "iox/optional.hpp"
@@ -131,6 +132,13 @@ class PoshRuntime
                         const popo::ServerOptions& serverOptions = {},
                         const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept = 0;
 
+    /// @brief request the RouDi daemon to create all ports of a batch which were not created yet; the ports share
+    /// the round trips to RouDi, i.e. as many ports as fit into one message are requested at once
+    /// @param[in] ports to create; the created ports and the reasons for failures are stored in the batch
+    /// @return true if all ports of the batch were created
+    /// @note the default implementation requests the ports one by one and does not store the reasons for failures
+    virtual bool getMiddlewarePorts(PortBatch& ports) noexcept;
+
     /// @brief request the RouDi daemon to create an interface port
     /// @param[in] commInterface of the interface to create
     /// @param[in] nodeName name of the node where the interface should belong to
@@ -142,6 +150,14 @@ class PoshRuntime
     /// @return pointer to a created condition variable data
     virtual popo::ConditionVariableData* getMiddlewareConditionVariable() noexcept = 0;
 
+    /// @brief unmaps the payload segments which were mapped on demand, see 'PayloadSegmentMapping::ON_DEMAND'; a
+    /// segment is mapped again when it is accessed the next time
+    /// @return the number of unmapped segments; no segment is unmapped while a port of the application holds chunks,
+    /// i.e. as long as not all loaned and taken samples, requests and responses are released
+    /// @attention no chunk must be loaned or taken concurrently to this call
+    /// @note the default implementation does not unmap any segment
+    virtual uint64_t unmapPayloadSegments() noexcept;
+
     /// @brief send a request to the RouDi daemon and get the response
     ///        currently each request is followed by a response
     /// @param[in] msg request message to send
@@ -34,6 +34,17 @@ ChunkManagement::ChunkManagement(const not_null<base_t*> chunkHeader,
                   "'MemPool::CHUNK_MEMORY_ALIGNMENT'!");
 }
 
+ChunkManagement::ChunkManagement(const not_null<base_t*> chunkHeader, const not_null<MemPool*> mempool) noexcept
+    : m_chunkHeader(chunkHeader)
+    , m_mempool(mempool)
+{
+}
+
+bool ChunkManagement::isEmbedded() const noexcept
+{
+    return !m_chunkManagementPool;
+}
+
 
 } // namespace mepoo
 } // namespace iox
@@ -18,10 +18,13 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_platform/unistd.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/assertions.hpp"
+#include "iox/memory.hpp"
 
 #include <algorithm>
+#include <mutex>
 
 namespace iox
 {
@@ -39,14 +42,207 @@ MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
 }
 
 constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
+constexpr uint32_t MemPool::NO_THREAD_CACHE;
+constexpr uint32_t MemPool::ThreadCache::NO_OWNER;
+constexpr uint32_t MemPool::ThreadCache::OWNER_BUSY;
+
+/// @brief The thread local bookkeeping of the thread caches which are owned by the current thread. All instances of
+/// the current process are linked together in order to release their thread caches when a MemPool is destroyed or
+/// the runtime shuts down. The list is only modified when a thread attaches to a MemPool for the first time, when a
+/// MemPool is destroyed and when a thread terminates, therefore the hot path does not need any locking.
+class MemPool::LocalThreadCache
+{
+  public:
+    struct Entry
+    {
+        concurrent::Atomic<MemPool*> m_memPool{nullptr};
+        ThreadCache* m_threadCache{nullptr};
+        freeList_t::Index_t* m_indices{nullptr};
+        uint32_t m_generation{0U};
+        /// the pid at the time the thread cache was claimed; a child process inherits the entries after a fork
+        uint32_t m_owner{0U};
+    };
+
+    LocalThreadCache() noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        m_next = head();
+        if (m_next != nullptr)
+        {
+            m_next->m_previous = this;
+        }
+        head() = this;
+    }
+
+    ~LocalThreadCache() noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        releaseEntries([](const MemPool&) { return true; });
+        if (m_previous != nullptr)
+        {
+            m_previous->m_next = m_next;
+        }
+        else
+        {
+            head() = m_next;
+        }
+        if (m_next != nullptr)
+        {
+            m_next->m_previous = m_previous;
+        }
+    }
+
+    LocalThreadCache(const LocalThreadCache&) = delete;
+    LocalThreadCache(LocalThreadCache&&) = delete;
+    LocalThreadCache& operator=(const LocalThreadCache&) = delete;
+    LocalThreadCache& operator=(LocalThreadCache&&) = delete;
+
+    static LocalThreadCache& ofCurrentThread() noexcept
+    {
+        static thread_local LocalThreadCache localThreadCache;
+        return localThreadCache;
+    }
+
+    Entry* entryFor(MemPool& memPool) noexcept
+    {
+        for (uint32_t i = 0U; i < m_numberOfEntries; ++i)
+        {
+            if (m_entries[i].m_memPool.load(std::memory_order_acquire) == &memPool)
+            {
+                auto* threadCache = m_entries[i].m_threadCache;
+                if (threadCache == nullptr)
+                {
+                    return nullptr;
+                }
+                if (threadCache->m_generation.load(std::memory_order_acquire) == m_entries[i].m_generation)
+                {
+                    return &m_entries[i];
+                }
+                // the thread cache was released by someone else and might already be used by another thread
+                std::lock_guard<std::mutex> lock(mutex());
+                reset(m_entries[i]);
+                break;
+            }
+        }
+        return attach(memPool);
+    }
+
+    /// @brief releases the thread caches of all threads of the current process which belong to a MemPool matching
+    /// the predicate
+    template <typename Predicate>
+    static void releaseAll(const Predicate& predicate) noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        for (auto* localThreadCache = head(); localThreadCache != nullptr; localThreadCache = localThreadCache->m_next)
+        {
+            localThreadCache->releaseEntries(predicate);
+        }
+    }
+
+  private:
+    static constexpr uint32_t MAX_NUMBER_OF_ENTRIES{16U};
+
+    static std::mutex& mutex() noexcept
+    {
+        static std::mutex registryMutex;
+        return registryMutex;
+    }
+
+    static LocalThreadCache*& head() noexcept
+    {
+        static LocalThreadCache* registryHead{nullptr};
+        return registryHead;
+    }
+
+    Entry* attach(MemPool& memPool) noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+
+        Entry* entry{nullptr};
+        for (uint32_t i = 0U; i < m_numberOfEntries && entry == nullptr; ++i)
+        {
+            if (m_entries[i].m_memPool.load(std::memory_order_relaxed) == nullptr)
+            {
+                entry = &m_entries[i];
+            }
+        }
+        if (entry == nullptr && m_numberOfEntries < MAX_NUMBER_OF_ENTRIES)
+        {
+            entry = &m_entries[m_numberOfEntries];
+            ++m_numberOfEntries;
+        }
+        if (entry == nullptr)
+        {
+            // all entries are in use; evict one in a round robin fashion
+            entry = &m_entries[m_nextEviction];
+            m_nextEviction = (m_nextEviction + 1U) % MAX_NUMBER_OF_ENTRIES;
+            release(*entry);
+        }
+
+        // if no thread cache is available, the entry is still stored to prevent further attempts of this thread
+        entry->m_owner = static_cast<uint32_t>(getpid());
+        entry->m_threadCache = memPool.claimThreadCache(entry->m_owner);
+        if (entry->m_threadCache != nullptr)
+        {
+            entry->m_indices = memPool.threadCacheIndices(*entry->m_threadCache);
+            entry->m_generation = entry->m_threadCache->m_generation.load(std::memory_order_acquire);
+        }
+        entry->m_memPool.store(&memPool, std::memory_order_release);
+
+        return (entry->m_threadCache != nullptr) ? entry : nullptr;
+    }
+
+    void release(Entry& entry) noexcept
+    {
+        auto* memPool = entry.m_memPool.load(std::memory_order_relaxed);
+        if (memPool != nullptr && entry.m_threadCache != nullptr)
+        {
+            memPool->releaseThreadCache(*entry.m_threadCache, entry.m_owner, entry.m_generation);
+        }
+        reset(entry);
+    }
+
+    static void reset(Entry& entry) noexcept
+    {
+        entry.m_memPool.store(nullptr, std::memory_order_release);
+        entry.m_threadCache = nullptr;
+        entry.m_indices = nullptr;
+        entry.m_generation = 0U;
+        entry.m_owner = 0U;
+    }
+
+    template <typename Predicate>
+    void releaseEntries(const Predicate& predicate) noexcept
+    {
+        for (uint32_t i = 0U; i < m_numberOfEntries; ++i)
+        {
+            auto* memPool = m_entries[i].m_memPool.load(std::memory_order_relaxed);
+            if (memPool != nullptr && predicate(*memPool))
+            {
+                release(m_entries[i]);
+            }
+        }
+    }
+
+  private:
+    uint32_t m_numberOfEntries{0U};
+    uint32_t m_nextEviction{0U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size process local storage
+    Entry m_entries[MAX_NUMBER_OF_ENTRIES];
+    LocalThreadCache* m_previous{nullptr};
+    LocalThreadCache* m_next{nullptr};
+};
 
 MemPool::MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
                  const greater_or_equal<uint32_t, 1> numberOfChunks,
                  iox::BumpAllocator& managementAllocator,
-                 iox::BumpAllocator& chunkMemoryAllocator) noexcept
+                 iox::BumpAllocator& chunkMemoryAllocator,
+                 const uint32_t threadCacheCapacity,
+                 const NumaPlacement numaPlacement) noexcept
     : m_chunkSize(chunkSize)
     , m_numberOfChunks(numberOfChunks)
     , m_minFree(numberOfChunks)
+    , m_threadCacheCapacity(threadCacheCapacity)
 {
     if (isMultipleOfAlignment(chunkSize))
     {
@@ -57,10 +253,40 @@ MemPool::MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkS
             chunkMemoryAllocator.allocate(static_cast<uint64_t>(m_numberOfChunks) * m_chunkSize, CHUNK_MEMORY_ALIGNMENT)
                 .expect("Allocating raw memory for 'MemPool'"));
 
+        numaPlacement.apply(m_rawMemory.get(), static_cast<uint64_t>(m_numberOfChunks) * m_chunkSize)
+            .or_else([&](auto& error) {
+                IOX_LOG(Warn,
+                        "Unable to apply the NUMA placement '" << numaPlacement << "' to the MemPool with chunk size "
+                                                               << m_chunkSize << " due to " << error);
+            });
+
         auto* memoryFreeList =
             managementAllocator.allocate(freeList_t::requiredIndexMemorySize(m_numberOfChunks), CHUNK_MEMORY_ALIGNMENT)
                 .expect("Allocating free list memory for 'MemPool'");
         m_freeIndices.init(static_cast<freeList_t::Index_t*>(memoryFreeList), m_numberOfChunks);
+
+        if (m_threadCacheCapacity != NO_THREAD_CACHE)
+        {
+            IOX_ENFORCE(m_threadCacheCapacity <= MAX_MEMPOOL_THREAD_CACHE_CAPACITY,
+                        "The thread cache capacity must not exceed 'MAX_MEMPOOL_THREAD_CACHE_CAPACITY'!");
+
+            auto* threadCacheMemory =
+                managementAllocator.allocate(sizeof(ThreadCache) * MAX_THREAD_CACHES_PER_MEMPOOL, CHUNK_MEMORY_ALIGNMENT)
+                    .expect("Allocating thread cache memory for 'MemPool'");
+            auto* threadCaches = static_cast<ThreadCache*>(threadCacheMemory);
+            for (uint32_t i = 0U; i < MAX_THREAD_CACHES_PER_MEMPOOL; ++i)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) memory was allocated above
+                new (&threadCaches[i]) ThreadCache();
+            }
+            m_threadCaches = threadCaches;
+
+            m_threadCacheIndices = static_cast<freeList_t::Index_t*>(
+                managementAllocator
+                    .allocate(sizeof(freeList_t::Index_t) * MAX_THREAD_CACHES_PER_MEMPOOL * m_threadCacheCapacity,
+                              CHUNK_MEMORY_ALIGNMENT)
+                    .expect("Allocating thread cache index memory for 'MemPool'"));
+        }
     }
     else
     {
@@ -71,6 +297,14 @@ MemPool::MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkS
     }
 }
 
+MemPool::~MemPool() noexcept
+{
+    if (m_threadCacheCapacity != NO_THREAD_CACHE)
+    {
+        LocalThreadCache::releaseAll([this](const MemPool& memPool) { return &memPool == this; });
+    }
+}
+
 bool MemPool::isMultipleOfAlignment(const uint64_t value) const noexcept
 {
     return (value % CHUNK_MEMORY_ALIGNMENT == 0U);
@@ -83,10 +317,160 @@ void MemPool::adjustMinFree() noexcept
                              m_minFree.load(std::memory_order_relaxed)));
 }
 
+uint64_t MemPool::requiredThreadCacheMemorySize(const uint32_t threadCacheCapacity) noexcept
+{
+    if (threadCacheCapacity == NO_THREAD_CACHE)
+    {
+        return 0U;
+    }
+
+    return align(static_cast<uint64_t>(sizeof(ThreadCache)) * MAX_THREAD_CACHES_PER_MEMPOOL, CHUNK_MEMORY_ALIGNMENT)
+           + align(static_cast<uint64_t>(sizeof(freeList_t::Index_t)) * MAX_THREAD_CACHES_PER_MEMPOOL
+                       * threadCacheCapacity,
+                   CHUNK_MEMORY_ALIGNMENT);
+}
+
+uint32_t MemPool::threadCacheBatchSize() const noexcept
+{
+    // exchange half of the cache with the shared free list to avoid ping-pong when getChunk and freeChunk alternate
+    return (m_threadCacheCapacity + 1U) / 2U;
+}
+
+MemPool::ThreadCache* MemPool::claimThreadCache(const uint32_t pid) noexcept
+{
+    for (uint32_t i = 0U; i < MAX_THREAD_CACHES_PER_MEMPOOL; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by MAX_THREAD_CACHES_PER_MEMPOOL
+        auto& threadCache = m_threadCaches.get()[i];
+        auto expectedOwner = ThreadCache::NO_OWNER;
+        if (threadCache.m_owner.compare_exchange_strong(
+                expectedOwner, pid, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            threadCache.m_numberOfIndices = 0U;
+            return &threadCache;
+        }
+    }
+
+    IOX_LOG(Debug,
+            "Mempool [m_chunkSize = " << m_chunkSize << " ] has no free thread cache left; using the shared free list");
+    return nullptr;
+}
+
+MemPool::freeList_t::Index_t* MemPool::threadCacheIndices(const ThreadCache& threadCache) noexcept
+{
+    const auto threadCacheIndex = static_cast<uint64_t>(&threadCache - m_threadCaches.get());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by MAX_THREAD_CACHES_PER_MEMPOOL
+    return m_threadCacheIndices.get() + threadCacheIndex * m_threadCacheCapacity;
+}
+
+void MemPool::releaseThreadCache(ThreadCache& threadCache,
+                                 const uint32_t owner,
+                                 const optional<uint32_t> generation) noexcept
+{
+    // the owner and RouDi might release the thread cache concurrently; only the one who wins the exchange pushes the
+    // indices back to the free list
+    auto expectedOwner = owner;
+    if (!threadCache.m_owner.compare_exchange_strong(
+            expectedOwner, ThreadCache::OWNER_BUSY, std::memory_order_acq_rel, std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    // a thread of the same process might have claimed the thread cache after it was released by someone else
+    if (generation.has_value() && threadCache.m_generation.load(std::memory_order_relaxed) != generation.value())
+    {
+        threadCache.m_owner.store(owner, std::memory_order_release);
+        return;
+    }
+
+    if (!m_freeIndices.pushBatch(threadCacheIndices(threadCache), threadCache.m_numberOfIndices))
+    {
+        IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+    threadCache.m_numberOfIndices = 0U;
+
+    threadCache.m_generation.fetch_add(1U, std::memory_order_acq_rel);
+    threadCache.m_owner.store(ThreadCache::NO_OWNER, std::memory_order_release);
+}
+
+void MemPool::releaseThreadCachesOfProcess(const uint32_t pid) noexcept
+{
+    if (m_threadCacheCapacity == NO_THREAD_CACHE || pid == ThreadCache::NO_OWNER)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < MAX_THREAD_CACHES_PER_MEMPOOL; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by MAX_THREAD_CACHES_PER_MEMPOOL
+        releaseThreadCache(m_threadCaches.get()[i], pid);
+    }
+}
+
+void MemPool::releaseThreadCachesOfCurrentProcess() noexcept
+{
+    LocalThreadCache::releaseAll([](const MemPool&) { return true; });
+}
+
+bool MemPool::acquireIndex(freeList_t::Index_t& index) noexcept
+{
+    auto* entry = (m_threadCacheCapacity != NO_THREAD_CACHE) ? LocalThreadCache::ofCurrentThread().entryFor(*this)
+                                                              : nullptr;
+    if (entry == nullptr)
+    {
+        return m_freeIndices.pop(index);
+    }
+
+    auto& threadCache = *entry->m_threadCache;
+    if (threadCache.m_numberOfIndices == 0U)
+    {
+        threadCache.m_numberOfIndices = m_freeIndices.popBatch(entry->m_indices, threadCacheBatchSize());
+        if (threadCache.m_numberOfIndices == 0U)
+        {
+            return false;
+        }
+    }
+
+    --threadCache.m_numberOfIndices;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by the thread cache capacity
+    index = entry->m_indices[threadCache.m_numberOfIndices];
+    return true;
+}
+
+void MemPool::releaseIndex(const freeList_t::Index_t index) noexcept
+{
+    auto* entry = (m_threadCacheCapacity != NO_THREAD_CACHE) ? LocalThreadCache::ofCurrentThread().entryFor(*this)
+                                                              : nullptr;
+    if (entry == nullptr)
+    {
+        if (!m_freeIndices.push(index))
+        {
+            IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+        }
+        return;
+    }
+
+    auto& threadCache = *entry->m_threadCache;
+    if (threadCache.m_numberOfIndices == m_threadCacheCapacity)
+    {
+        const auto batchSize = threadCacheBatchSize();
+        threadCache.m_numberOfIndices -= batchSize;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by the thread cache capacity
+        if (!m_freeIndices.pushBatch(entry->m_indices + threadCache.m_numberOfIndices, batchSize))
+        {
+            IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+        }
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by the thread cache capacity
+    entry->m_indices[threadCache.m_numberOfIndices] = index;
+    ++threadCache.m_numberOfIndices;
+}
+
 void* MemPool::getChunk() noexcept
 {
     uint32_t index{0U};
-    if (!m_freeIndices.pop(index))
+    if (!acquireIndex(index))
     {
         IOX_LOG(Warn,
                 "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
@@ -149,10 +533,8 @@ void MemPool::freeChunk(const void* chunk) noexcept
 
     const auto index = pointerToIndex(chunk, m_chunkSize, memPoolStartAddress);
 
-    if (!m_freeIndices.push(index))
-    {
-        IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
-    }
+    // NOTE: a double free of a chunk which ends up in a thread cache is detected when the cache is flushed
+    releaseIndex(index);
 
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
 }
@@ -177,6 +559,11 @@ uint32_t MemPool::getMinFree() const noexcept
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+uint32_t MemPool::getThreadCacheCapacity() const noexcept
+{
+    return m_threadCacheCapacity;
+}
+
 MemPoolInfo MemPool::getInfo() const noexcept
 {
     return {m_usedChunks.load(std::memory_order_relaxed),
@@ -24,6 +24,7 @@
 #include "iox/logging.hpp"
 
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -42,9 +43,12 @@ void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
                                BumpAllocator& chunkMemoryAllocator,
                                const greater_or_equal<uint64_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                               const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept
+                               const greater_or_equal<uint32_t, 1> numberOfChunks,
+                               const uint32_t threadCacheCapacity,
+                               const NumaPlacement numaPlacement) noexcept
 {
-    uint64_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint64_t>(chunkPayloadSize));
+    uint64_t adjustedChunkSize =
+        sizeWithChunkHeaderStruct(static_cast<uint64_t>(chunkPayloadSize)) + m_chunkManagementPrefixSize;
     if (m_denyAddMemPool)
     {
         IOX_LOG(Fatal, "After the generation of the chunk management pool you are not allowed to create new mempools.");
@@ -64,13 +68,22 @@ void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
         IOX_REPORT_FATAL(iox::PoshError::MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE);
     }
 
-    m_memPoolVector.emplace_back(adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator);
+    m_memPoolVector.emplace_back(adjustedChunkSize,
+                                 numberOfChunks,
+                                 managementAllocator,
+                                 chunkMemoryAllocator,
+                                 threadCacheCapacity,
+                                 numaPlacement);
     m_totalNumberOfChunks += numberOfChunks;
 }
 
 void MemoryManager::generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept
 {
     m_denyAddMemPool = true;
+    if (m_chunkManagementLayout == ChunkManagementLayout::EMBEDDED)
+    {
+        return;
+    }
     uint64_t chunkSize = sizeof(ChunkManagement);
     m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
 }
@@ -86,7 +99,18 @@ MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
     {
         return {0, 0, 0, 0};
     }
-    return m_memPoolVector[index].getInfo();
+    // the prefix for the embedded ChunkManagement is an implementation detail and not available for the chunks
+    auto info = m_memPoolVector[index].getInfo();
+    info.m_chunkSize -= m_chunkManagementPrefixSize;
+    return info;
+}
+
+void MemoryManager::releaseThreadCachesOfProcess(const uint32_t pid) noexcept
+{
+    for (auto& memPool : m_memPoolVector)
+    {
+        memPool.releaseThreadCachesOfProcess(pid);
+    }
 }
 
 uint64_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept
@@ -94,9 +118,16 @@ uint64_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t si
     return size + sizeof(ChunkHeader);
 }
 
+uint64_t MemoryManager::chunkManagementPrefixSize(const ChunkManagementLayout layout) noexcept
+{
+    // the ChunkHeader follows the prefix and must keep its alignment
+    return (layout == ChunkManagementLayout::EMBEDDED) ? align(sizeof(ChunkManagement), alignof(ChunkHeader)) : 0U;
+}
+
 uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept
 {
     uint64_t memorySize{0};
+    const uint64_t prefixSize = chunkManagementPrefixSize(mePooConfig.m_chunkManagementLayout);
     for (const auto& mempoolConfig : mePooConfig.m_mempoolConfig)
     {
         // for the required chunk memory size only the size of the ChunkHeader
@@ -104,7 +135,7 @@ uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig)
         // the user has the option to further partition the chunk-payload with
         // a user-header and therefore reduce the user-payload size
         memorySize += align(static_cast<uint64_t>(mempoolConfig.m_chunkCount)
-                                * MemoryManager::sizeWithChunkHeaderStruct(mempoolConfig.m_size),
+                                * (MemoryManager::sizeWithChunkHeaderStruct(mempoolConfig.m_size) + prefixSize),
                             MemPool::CHUNK_MEMORY_ALIGNMENT);
     }
     return memorySize;
@@ -119,10 +150,15 @@ uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooCon
         sumOfAllChunks += mempool.m_chunkCount;
         memorySize +=
             align(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_chunkCount), MemPool::CHUNK_MEMORY_ALIGNMENT);
+        memorySize += MemPool::requiredThreadCacheMemorySize(mempool.m_threadCacheCapacity);
     }
 
-    memorySize += align(sumOfAllChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
-    memorySize += align(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    if (mePooConfig.m_chunkManagementLayout == ChunkManagementLayout::SEPARATE_POOL)
+    {
+        memorySize += align(sumOfAllChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
+        memorySize +=
+            align(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    }
 
     return memorySize;
 }
@@ -136,32 +172,99 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
                                            BumpAllocator& managementAllocator,
                                            BumpAllocator& chunkMemoryAllocator) noexcept
 {
+    m_chunkManagementLayout = mePooConfig.m_chunkManagementLayout;
+    m_chunkManagementPrefixSize = chunkManagementPrefixSize(m_chunkManagementLayout);
+
     for (auto entry : mePooConfig.m_mempoolConfig)
     {
-        addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
+        addMemPool(managementAllocator,
+                   chunkMemoryAllocator,
+                   entry.m_size,
+                   entry.m_chunkCount,
+                   entry.m_threadCacheCapacity,
+                   entry.m_numaPlacement);
     }
 
+    m_fallbackPolicy = mePooConfig.m_fallbackPolicy;
+    generateSizeClassTable();
     generateChunkManagementPool(managementAllocator);
 }
 
+uint32_t MemoryManager::sizeClass(const uint64_t chunkSize) noexcept
+{
+    if (chunkSize <= 1U)
+    {
+        return 0U;
+    }
+
+    // binary search for the highest set bit of 'chunkSize - 1' to keep this independent of compiler intrinsics
+    uint64_t value = chunkSize - 1U;
+    uint32_t numberOfBits{1U};
+    for (uint32_t shift = std::numeric_limits<uint64_t>::digits / 2U; shift > 0U; shift /= 2U)
+    {
+        if ((value >> shift) != 0U)
+        {
+            value >>= shift;
+            numberOfBits += shift;
+        }
+    }
+    return numberOfBits;
+}
+
+void MemoryManager::generateSizeClassTable() noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex{0U};
+    for (uint32_t currentSizeClass = 0U; currentSizeClass < NUMBER_OF_SIZE_CLASSES; ++currentSizeClass)
+    {
+        // the mempools are ordered by increasing chunk size, therefore the first mempool which belongs to the size
+        // class or a larger one is the starting point for all chunk sizes of the size class
+        while (memPoolIndex < numberOfMemPools
+               && sizeClass(m_memPoolVector[memPoolIndex].getChunkSize()) < currentSizeClass)
+        {
+            ++memPoolIndex;
+        }
+        m_sizeClassToMemPoolIndex[currentSizeClass] = memPoolIndex;
+    }
+}
+
+uint32_t MemoryManager::findMemPoolIndex(const uint64_t requiredChunkSize) const noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex = m_sizeClassToMemPoolIndex[sizeClass(requiredChunkSize)];
+
+    // only the mempools of the same size class might be too small
+    while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < requiredChunkSize)
+    {
+        ++memPoolIndex;
+    }
+    return memPoolIndex;
+}
+
 expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
 {
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
-    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+    const auto requiredChunkSize = chunkSettings.requiredChunkSize() + m_chunkManagementPrefixSize;
 
     uint64_t aquiredChunkSize = 0U;
 
-    for (auto& memPool : m_memPoolVector)
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex = findMemPoolIndex(requiredChunkSize);
+    if (memPoolIndex < numberOfMemPools)
     {
-        uint64_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        memPoolPointer = &m_memPoolVector[memPoolIndex];
+        chunk = memPoolPointer->getChunk();
+
+        if (m_fallbackPolicy == MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL)
         {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
+            for (++memPoolIndex; chunk == nullptr && memPoolIndex < numberOfMemPools; ++memPoolIndex)
+            {
+                memPoolPointer = &m_memPoolVector[memPoolIndex];
+                chunk = memPoolPointer->getChunk();
+            }
         }
+        aquiredChunkSize = memPoolPointer->getChunkSize() - m_chunkManagementPrefixSize;
     }
 
     if (m_memPoolVector.size() == 0)
@@ -198,6 +301,14 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
         IOX_REPORT(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, iox::er::RUNTIME_ERROR);
         return err(Error::MEMPOOL_OUT_OF_CHUNKS);
     }
+    else if (m_chunkManagementLayout == ChunkManagementLayout::EMBEDDED)
+    {
+        // the ChunkManagement occupies the prefix of the chunk and the ChunkHeader follows it
+        auto* chunkHeaderMemory = static_cast<uint8_t*>(chunk) + m_chunkManagementPrefixSize;
+        auto chunkHeader = new (chunkHeaderMemory) ChunkHeader(aquiredChunkSize, chunkSettings);
+        auto chunkManagement = new (chunk) ChunkManagement(chunkHeader, memPoolPointer);
+        return ok(SharedChunk(chunkManagement));
+    }
     else
     {
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
@@ -209,6 +320,14 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
 
 void MemoryManager::freeChunk(ChunkManagement& chunkManagement) noexcept
 {
+    if (chunkManagement.isEmbedded())
+    {
+        // the ChunkManagement is located at the start of the chunk and is released together with it
+        chunkManagement.m_mempool->freeChunk(&chunkManagement);
+        // NOTE: chunkManagement is a dangling reference from here on out
+        return;
+    }
+
     const auto* chunkHeader = static_cast<void*>(chunkManagement.m_chunkHeader.get());
     const auto mempool = chunkManagement.m_mempool;
 
@@ -19,6 +19,8 @@
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/logging.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace mepoo
@@ -74,10 +76,18 @@ MePooConfig& MePooConfig::optimize() noexcept
             }
             newEntry.m_size = entry.m_size;
             newEntry.m_chunkCount = entry.m_chunkCount;
+            newEntry.m_threadCacheCapacity = entry.m_threadCacheCapacity;
+            newEntry.m_numaPlacement = entry.m_numaPlacement;
         }
         else
         {
             newEntry.m_chunkCount += entry.m_chunkCount;
+            newEntry.m_threadCacheCapacity = std::max(newEntry.m_threadCacheCapacity, entry.m_threadCacheCapacity);
+            // a merged mempool is placed like the first of its entries which requests an explicit placement
+            if (newEntry.m_numaPlacement.policy == NumaPlacement::Policy::DEFAULT)
+            {
+                newEntry.m_numaPlacement = entry.m_numaPlacement;
+            }
         }
     }
 
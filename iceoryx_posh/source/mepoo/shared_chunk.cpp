@@ -51,6 +51,14 @@ void SharedChunk::incrementReferenceCounter() noexcept
     }
 }
 
+void SharedChunk::reserveReferences(const uint64_t count) noexcept
+{
+    if (m_chunkManagement != nullptr && count > 0U)
+    {
+        m_chunkManagement->m_referenceCounter.fetch_add(count, std::memory_order_relaxed);
+    }
+}
+
 void SharedChunk::decrementReferenceCounter() noexcept
 {
     if ((m_chunkManagement != nullptr)
@@ -37,18 +37,31 @@ static_assert(std::is_trivially_copyable<ShmSafeUnmanagedChunk>::value,
               "The ShmSafeUnmanagedChunk must be trivially copyable to prevent Frankenstein objects when the copy ctor "
               "works on half dead objects!");
 
+static RelativePointerData toRelativePointerData(mepoo::ChunkManagement* const chunkManagement) noexcept
+{
+    RelativePointer<mepoo::ChunkManagement> ptr{chunkManagement};
+    auto id = ptr.getId();
+    auto offset = ptr.getOffset();
+    IOX_ENFORCE(id <= RelativePointerData::ID_RANGE, "RelativePointer id must fit into id type!");
+    IOX_ENFORCE(offset <= RelativePointerData::OFFSET_RANGE, "RelativePointer offset must fit into offset type!");
+    /// @todo iox-#1196 Unify types to uint64_t
+    return RelativePointerData(static_cast<RelativePointerData::identifier_t>(id), offset);
+}
+
 ShmSafeUnmanagedChunk::ShmSafeUnmanagedChunk(mepoo::SharedChunk chunk) noexcept
 {
     // this is only necessary if it's not an empty chunk
     if (chunk)
     {
-        RelativePointer<mepoo::ChunkManagement> ptr{chunk.release()};
-        auto id = ptr.getId();
-        auto offset = ptr.getOffset();
-        IOX_ENFORCE(id <= RelativePointerData::ID_RANGE, "RelativePointer id must fit into id type!");
-        IOX_ENFORCE(offset <= RelativePointerData::OFFSET_RANGE, "RelativePointer offset must fit into offset type!");
-        /// @todo iox-#1196 Unify types to uint64_t
-        m_chunkManagement = RelativePointerData(static_cast<RelativePointerData::identifier_t>(id), offset);
+        m_chunkManagement = toRelativePointerData(chunk.release());
+    }
+}
+
+ShmSafeUnmanagedChunk::ShmSafeUnmanagedChunk(const mepoo::SharedChunk& chunk, AdoptReservedReference_t) noexcept
+{
+    if (chunk)
+    {
+        m_chunkManagement = toRelativePointerData(chunk.m_chunkManagement);
     }
 }
 
@@ -17,16 +17,56 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/deadline_timer.hpp"
+
+#include <atomic>
+#include <thread>
 
 namespace iox
 {
 namespace popo
 {
+namespace
+{
+uint64_t indexOfLowestSetBit(const uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint64_t>(__builtin_ctzll(value));
+#else
+    uint64_t index{0U};
+    while ((value & (1ULL << index)) == 0U)
+    {
+        ++index;
+    }
+    return index;
+#endif
+}
+
+/// @brief hints the CPU that the thread is busy polling which saves power and frees resources for a sibling
+/// hyper-thread
+void relaxCpu() noexcept
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+} // namespace
+
 ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
     : m_condVarDataPtr(&condVarData)
 {
 }
 
+ConditionListener::~ConditionListener() noexcept
+{
+    if (m_notificationSocket)
+    {
+        getMembers()->m_hasNotificationSocket.store(false, std::memory_order_relaxed);
+    }
+}
+
 void ConditionListener::resetSemaphore() noexcept
 {
     // Count the semaphore down to zero
@@ -57,8 +97,25 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
-        if (this->getMembers()->m_semaphore->wait().has_error())
+    return waitImpl(getBusyPollDuration(), [this]() -> bool {
+        // with a running timer the semaphore is only waited on until the earliest deadline; the expired timer is
+        // collected in the next iteration of waitImpl
+        const auto timerDeadline = this->earliestTimerDeadline();
+        if (!timerDeadline.has_value())
+        {
+            if (this->getMembers()->m_semaphore->wait().has_error())
+            {
+                IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT);
+                return false;
+            }
+            return true;
+        }
+
+        const auto now = ConditionVariableData::currentTimestamp();
+        if (timerDeadline.value() > now
+            && this->getMembers()
+                   ->m_semaphore->timedWait(units::Duration::fromNanoseconds(timerDeadline.value() - now))
+                   .has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT);
             return false;
@@ -69,47 +126,298 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
+    // the busy polling is part of the time to wait
+    const auto pollDuration = algorithm::minVal(getBusyPollDuration(), timeToWait);
+    const auto endOfWait = ConditionVariableData::currentTimestamp() + timeToWait.toNanoseconds();
+    return waitImpl(pollDuration, [this, endOfWait]() -> bool {
+        auto wakeUpTime = endOfWait;
+        bool isTimerDeadline = false;
+        this->earliestTimerDeadline().and_then([&](const auto timerDeadline) {
+            if (timerDeadline < endOfWait)
+            {
+                wakeUpTime = timerDeadline;
+                isTimerDeadline = true;
+            }
+        });
+
+        const auto now = ConditionVariableData::currentTimestamp();
+        if (wakeUpTime > now
+            && this->getMembers()
+                   ->m_semaphore->timedWait(units::Duration::fromNanoseconds(wakeUpTime - now))
+                   .has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT);
+            return false;
         }
-        return false;
+        // waking up for a timer does not end the wait, only the end of the time to wait does
+        return isTimerDeadline;
     });
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()> waitCall) noexcept
+ConditionListener::NotificationVector_t ConditionListener::tryWait() noexcept
+{
+    NotificationVector_t activeNotifications;
+    if (m_toBeDestroyed.load(std::memory_order_relaxed))
+    {
+        return activeNotifications;
+    }
+
+    if (m_notificationSocket)
+    {
+        m_notificationSocket->drain();
+        // pairs with the exchange in ConditionNotifier::signalNotificationSocket; a notifier which still sees the
+        // socket as signaled has set its notification active before and it is collected below, all later notifiers
+        // send a new datagram
+        getMembers()->m_isNotificationSocketSignaled.store(false, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    expireTimers();
+    collectActiveNotifications(activeNotifications);
+    return activeNotifications;
+}
+
+expected<int32_t, NotificationSocketError> ConditionListener::getFileDescriptor() noexcept
+{
+    if (!m_notificationSocket)
+    {
+        auto socket = NotificationSocket::create();
+        if (socket.has_error())
+        {
+            return err(socket.error());
+        }
+        m_notificationSocket.emplace(std::move(socket.value()));
+
+        getMembers()->m_notificationSocketName = m_notificationSocket->getName();
+        getMembers()->m_isNotificationSocketSignaled.store(false, std::memory_order_relaxed);
+        getMembers()->m_hasNotificationSocket.store(true, std::memory_order_release);
+    }
+
+    return ok(m_notificationSocket->getFileDescriptor());
+}
+
+void ConditionListener::setBusyPollDuration(const units::Duration duration) noexcept
+{
+    m_busyPollDurationInNanoseconds.store(duration.toNanoseconds(), std::memory_order_relaxed);
+}
+
+units::Duration ConditionListener::getBusyPollDuration() const noexcept
+{
+    return units::Duration::fromNanoseconds(m_busyPollDurationInNanoseconds.load(std::memory_order_relaxed));
+}
+
+WaitStatistics ConditionListener::getStatistics() const noexcept
+{
+    WaitStatistics statistics;
+    statistics.spinHits = m_numberOfSpinHits.load(std::memory_order_relaxed);
+    statistics.blockingWaits = m_numberOfBlockingWaits.load(std::memory_order_relaxed);
+
+    const auto numberOfSamples = m_numberOfWakeUpLatencySamples.load(std::memory_order_relaxed);
+    if (numberOfSamples > 0U)
+    {
+        statistics.averageWakeUpLatency = units::Duration::fromNanoseconds(
+            m_accumulatedWakeUpLatencyInNanoseconds.load(std::memory_order_relaxed) / numberOfSamples);
+    }
+
+    return statistics;
+}
+
+ConditionListener::NotificationVector_t ConditionListener::waitImpl(const units::Duration pollDuration,
+                                                                    const function_ref<bool()> waitCall) noexcept
 {
-    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
+    getMembers()->m_firstWakeUpTimestamp.store(0U, std::memory_order_relaxed);
+    getMembers()->m_listenerState.store(ConditionVariableData::ListenerState::BLOCKING, std::memory_order_relaxed);
+    // pairs with the fence in ConditionNotifier::wakeUp; a notifier which has seen the idle state and therefore
+    // signaled the NotificationSocket instead of the semaphore has set its notification active before, which is
+    // collected below. It also pairs with the fence in ConditionNotifier::interruptBlockingWait; a timer which was
+    // started without interrupting the listener is seen when the deadlines are read
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
     bool doReturnAfterNotificationCollection = false;
+    bool isPollingRequired = pollDuration > units::Duration::zero();
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
+        expireTimers();
+        collectActiveNotifications(activeNotifications);
+        if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
-            {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
-            }
+            break;
         }
-        if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
+
+        if (isPollingRequired)
         {
-            return activeNotifications;
+            isPollingRequired = false;
+            const auto limitedPollDuration = limitToEarliestTimerDeadline(pollDuration);
+            if (limitedPollDuration > units::Duration::zero() && pollForNotifications(limitedPollDuration))
+            {
+                m_numberOfSpinHits.fetch_add(1U, std::memory_order_relaxed);
+                continue;
+            }
         }
 
+        m_numberOfBlockingWaits.fetch_add(1U, std::memory_order_relaxed);
         doReturnAfterNotificationCollection = !waitCall();
     }
 
+    getMembers()->m_listenerState.store(ConditionVariableData::ListenerState::IDLE, std::memory_order_relaxed);
+    if (!activeNotifications.empty())
+    {
+        recordWakeUpLatency();
+    }
+
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+void ConditionListener::collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    using Type_t = NotificationVector_t::value_type;
+
+    // the active notifications of a word are collected with a single exchange; the work is therefore proportional to
+    // the number of words and the number of active notifications instead of the number of notifiers. Iterating the
+    // words and bits in ascending order keeps the returned indices sorted
+    for (uint64_t word = 0U; word < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++word)
+    {
+        auto& activeNotificationsOfWord = getMembers()->m_activeNotifications[word];
+        if (activeNotificationsOfWord.load(std::memory_order_relaxed) == 0U)
+        {
+            continue;
+        }
+
+        uint64_t activeBits = activeNotificationsOfWord.exchange(0U, std::memory_order_acquire);
+        while (activeBits != 0U)
+        {
+            activeNotifications.emplace_back(static_cast<Type_t>(
+                word * ConditionVariableData::NOTIFICATIONS_PER_WORD + indexOfLowestSetBit(activeBits)));
+            activeBits &= activeBits - 1U;
+        }
+    }
+
+    if (!activeNotifications.empty())
+    {
+        getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    }
+}
+
+void ConditionListener::expireTimers() noexcept
+{
+    const auto now = ConditionVariableData::currentTimestamp();
+    for (auto& timer : getMembers()->m_timers)
+    {
+        if (!timer.m_isInUse.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        auto deadline = timer.m_deadline.load(std::memory_order_acquire);
+        if (deadline == 0U || deadline > now)
+        {
+            continue;
+        }
+
+        // a periodic timer stays on the grid of its first deadline so that late wake-ups do not accumulate drift;
+        // periods which were missed completely are merged into a single notification
+        const auto period = timer.m_period.load(std::memory_order_relaxed);
+        const auto notificationIndex = timer.m_notificationIndex.load(std::memory_order_relaxed);
+        const uint64_t nextDeadline = (period == 0U) ? 0U : deadline + ((now - deadline) / period + 1U) * period;
+
+        // the timer could have been stopped or restarted concurrently
+        if (timer.m_deadline.compare_exchange_strong(
+                deadline, nextDeadline, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            getMembers()->setNotificationActive(notificationIndex);
+            getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
+        }
+    }
+}
+
+optional<uint64_t> ConditionListener::earliestTimerDeadline() const noexcept
+{
+    optional<uint64_t> earliestDeadline;
+    for (const auto& timer : getMembers()->m_timers)
+    {
+        if (!timer.m_isInUse.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        const auto deadline = timer.m_deadline.load(std::memory_order_acquire);
+        if (deadline != 0U && (!earliestDeadline.has_value() || deadline < earliestDeadline.value()))
+        {
+            earliestDeadline = deadline;
+        }
+    }
+    return earliestDeadline;
+}
+
+units::Duration ConditionListener::limitToEarliestTimerDeadline(const units::Duration pollDuration) const noexcept
+{
+    const auto timerDeadline = earliestTimerDeadline();
+    if (!timerDeadline.has_value())
+    {
+        return pollDuration;
+    }
+
+    const auto now = ConditionVariableData::currentTimestamp();
+    if (timerDeadline.value() <= now)
+    {
+        return units::Duration::zero();
+    }
+    return algorithm::minVal(pollDuration, units::Duration::fromNanoseconds(timerDeadline.value() - now));
+}
+
+bool ConditionListener::pollForNotifications(const units::Duration pollDuration) noexcept
+{
+    auto& listenerState = getMembers()->m_listenerState;
+    listenerState.store(ConditionVariableData::ListenerState::SPINNING, std::memory_order_relaxed);
+
+    // first only the CPU is relaxed to keep the latency low, afterwards the CPU is yielded to not starve other threads
+    deadline_timer pollTimer{pollDuration};
+    bool hasActiveNotifications{false};
+    for (uint64_t numberOfPolls = 0U; !m_toBeDestroyed.load(std::memory_order_relaxed); ++numberOfPolls)
+    {
+        hasActiveNotifications = getMembers()->hasActiveNotifications();
+        if (hasActiveNotifications || pollTimer.hasExpired())
+        {
+            break;
+        }
+
+        if (numberOfPolls < POLLS_BEFORE_YIELD)
+        {
+            relaxCpu();
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    listenerState.store(ConditionVariableData::ListenerState::BLOCKING, std::memory_order_relaxed);
+    // pairs with the fence in ConditionNotifier::wakeUp; a notifier which has seen the spinning state and therefore
+    // skipped the semaphore post has set its notification active before, which is seen here
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    return hasActiveNotifications || getMembers()->hasActiveNotifications();
+}
+
+void ConditionListener::recordWakeUpLatency() noexcept
+{
+    const auto firstWakeUpTimestamp = getMembers()->m_firstWakeUpTimestamp.exchange(0U, std::memory_order_relaxed);
+    if (firstWakeUpTimestamp == 0U)
+    {
+        return;
+    }
+
+    const auto now = ConditionVariableData::currentTimestamp();
+    if (now < firstWakeUpTimestamp)
+    {
+        return;
+    }
+
+    m_accumulatedWakeUpLatencyInNanoseconds.fetch_add(now - firstWakeUpTimestamp, std::memory_order_relaxed);
+    m_numberOfWakeUpLatencySamples.fetch_add(1U, std::memory_order_relaxed);
 }
 
 const ConditionVariableData* ConditionListener::getMembers() volatile const noexcept
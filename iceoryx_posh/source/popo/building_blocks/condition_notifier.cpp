@@ -38,12 +38,76 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    setNotificationActive();
+    wakeUp();
+}
+
+void ConditionNotifier::setNotificationActive() noexcept
+{
+    getMembers()->setNotificationActive(m_notificationIndex);
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
+    getMembers()->m_numberOfNotifications.fetch_add(1U, std::memory_order_relaxed);
+}
+
+void ConditionNotifier::wakeUp() noexcept
+{
+    // pairs with the fence in ConditionListener when it stops spinning; either the notifier sees that the listener is
+    // no longer spinning or the listener sees the active notification
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto listenerState = getMembers()->m_listenerState.load(std::memory_order_relaxed);
+    if (listenerState != ConditionVariableData::ListenerState::IDLE)
+    {
+        uint64_t noTimestamp{0U};
+        getMembers()->m_firstWakeUpTimestamp.compare_exchange_strong(
+            noTimestamp, ConditionVariableData::currentTimestamp(), std::memory_order_relaxed);
+    }
+
+    if (listenerState == ConditionVariableData::ListenerState::SPINNING)
+    {
+        return;
+    }
+
+    // a pollable ConditionListener which is not waiting is woken up by its file descriptor; the semaphore is only
+    // required while it waits in wait() or timedWait()
+    if (listenerState == ConditionVariableData::ListenerState::IDLE
+        && getMembers()->m_hasNotificationSocket.load(std::memory_order_acquire))
+    {
+        signalNotificationSocket();
+        return;
+    }
+
+    getMembers()->m_numberOfWakeUps.fetch_add(1U, std::memory_order_relaxed);
+    getMembers()->m_semaphore->post().or_else(
+        [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY); });
+}
+
+void ConditionNotifier::interruptBlockingWait() noexcept
+{
+    // pairs with the fence in ConditionListener::waitImpl; either this sees the blocking listener or the listener
+    // sees the new deadline before it blocks. A spinning listener reads the deadlines after it stopped spinning
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_listenerState.load(std::memory_order_relaxed)
+        != ConditionVariableData::ListenerState::BLOCKING)
+    {
+        return;
+    }
+
+    getMembers()->m_numberOfWakeUps.fetch_add(1U, std::memory_order_relaxed);
     getMembers()->m_semaphore->post().or_else(
         [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY); });
 }
 
+void ConditionNotifier::signalNotificationSocket() noexcept
+{
+    // pairs with the reset in ConditionListener::tryWait; either this notifier sends a datagram or the listener
+    // collects the active notification after the reset
+    if (!getMembers()->m_isNotificationSocketSignaled.exchange(true, std::memory_order_seq_cst))
+    {
+        getMembers()->m_numberOfWakeUps.fetch_add(1U, std::memory_order_relaxed);
+        NotificationSocket::signal(getMembers()->m_notificationSocketName);
+    }
+}
+
 const ConditionVariableData* ConditionNotifier::getMembers() const noexcept
 {
     return m_condVarDataPtr;
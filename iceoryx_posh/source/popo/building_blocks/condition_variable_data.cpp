@@ -18,6 +18,8 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace popo
@@ -36,10 +38,42 @@ ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) n
         .create(m_semaphore)
         .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE); });
 
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        word.store(0U, std::memory_order_relaxed);
     }
 }
+
+void ConditionVariableData::setNotificationActive(const uint64_t index) noexcept
+{
+    m_activeNotifications[index / NOTIFICATIONS_PER_WORD].fetch_or(1ULL << (index % NOTIFICATIONS_PER_WORD),
+                                                                   std::memory_order_release);
+}
+
+bool ConditionVariableData::isNotificationActive(const uint64_t index) const noexcept
+{
+    return (m_activeNotifications[index / NOTIFICATIONS_PER_WORD].load(std::memory_order_relaxed)
+            & (1ULL << (index % NOTIFICATIONS_PER_WORD)))
+           != 0U;
+}
+
+bool ConditionVariableData::hasActiveNotifications() const noexcept
+{
+    for (const auto& word : m_activeNotifications)
+    {
+        if (word.load(std::memory_order_relaxed) != 0U)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t ConditionVariableData::currentTimestamp() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
 } // namespace popo
 } // namespace iox
@@ -16,8 +16,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_platform/signal.hpp"
+#include "iceoryx_platform/unistd.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
 
 namespace iox
 {
@@ -77,5 +80,34 @@ bool SingleThreadedPolicy::tryLock() const noexcept
     return true;
 }
 
+void LockFreePolicy::lock() const noexcept
+{
+}
+
+void LockFreePolicy::unlock() const noexcept
+{
+}
+
+bool LockFreePolicy::tryLock() const noexcept
+{
+    return true;
+}
+
+uint32_t LockFreePolicy::currentProcessId() noexcept
+{
+    return static_cast<uint32_t>(getpid());
+}
+
+bool LockFreePolicy::isProcessAlive(const uint32_t pid) noexcept
+{
+    // signal 0 only checks whether the process exists; EPERM means that it exists but belongs to another user
+    static constexpr int32_t ERROR_CODE = -1;
+    auto checkCommand = IOX_POSIX_CALL(kill)(static_cast<pid_t>(pid), 0)
+                            .failureReturnValue(ERROR_CODE)
+                            .ignoreErrnos(ESRCH, EPERM)
+                            .evaluate();
+    return !(checkCommand && checkCommand->errnum == ESRCH);
+}
+
 } // namespace popo
 } // namespace iox
@@ -0,0 +1,300 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
+#include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_platform/socket.hpp"
+#include "iceoryx_platform/stat.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/atomic.hpp"
+#include "iox/detail/convert.hpp"
+#include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
+#include "iox/scope_guard.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+constexpr int32_t ERROR_CODE{-1};
+
+sockaddr_un toSocketAddress(const NotificationSocket::Name_t& name) noexcept
+{
+    sockaddr_un socketAddress{};
+    socketAddress.sun_family = AF_LOCAL;
+    strncpy(&(socketAddress.sun_path[0]), name.c_str(), static_cast<size_t>(name.size()));
+    return socketAddress;
+}
+
+NotificationSocket::Name_t createUniqueName() noexcept
+{
+    // the process id makes the name unique on the host and the counter within the process
+    static concurrent::Atomic<uint64_t> socketCounter{0U};
+    const std::string name = std::string(platform::IOX_UDS_SOCKET_PATH_PREFIX) + "iox_cv_"
+                             + convert::toString(getpid()) + "_"
+                             + convert::toString(socketCounter.fetch_add(1U, std::memory_order_relaxed));
+    return NotificationSocket::Name_t(TruncateToCapacity, name.c_str(), name.size());
+}
+
+void closeSocket(const int32_t fileDescriptor) noexcept
+{
+    IOX_POSIX_CALL(iox_closesocket)
+    (fileDescriptor).failureReturnValue(ERROR_CODE).evaluate().or_else([](auto& r) {
+        IOX_LOG(Error, "Unable to close the notification socket: " << r.getHumanReadableErrnum());
+    });
+}
+
+void removeSocketFile(const NotificationSocket::Name_t& name) noexcept
+{
+    IOX_POSIX_CALL(iox_unlink)
+    (name.c_str()).failureReturnValue(ERROR_CODE).ignoreErrnos(ENOENT).evaluate().or_else([&](auto& r) {
+        IOX_LOG(Error, "Unable to remove the notification socket \"" << name << "\": " << r.getHumanReadableErrnum());
+    });
+}
+
+/// @brief the unbound socket all notifiers of the process use to send their wake-up datagrams; it is opened with the
+/// first wake-up instead of once per datagram since the notifiers signal while holding the lock of a chunk queue.
+/// Concurrent sendto calls on the same socket are thread-safe.
+class SenderSocket
+{
+  public:
+    static constexpr int32_t INVALID_FD{-1};
+
+    static SenderSocket& instance() noexcept
+    {
+        static SenderSocket sender;
+        return sender;
+    }
+
+    SenderSocket(const SenderSocket&) = delete;
+    SenderSocket(SenderSocket&&) = delete;
+    SenderSocket& operator=(const SenderSocket&) = delete;
+    SenderSocket& operator=(SenderSocket&&) = delete;
+
+    ~SenderSocket() noexcept
+    {
+        if (m_fileDescriptor != INVALID_FD)
+        {
+            closeSocket(m_fileDescriptor);
+        }
+    }
+
+    int32_t getFileDescriptor() const noexcept
+    {
+        return m_fileDescriptor;
+    }
+
+  private:
+    SenderSocket() noexcept
+    {
+        auto socketCall =
+            IOX_POSIX_CALL(iox_socket)(AF_LOCAL, SOCK_DGRAM, 0).failureReturnValue(ERROR_CODE).evaluate();
+        if (socketCall.has_error())
+        {
+            IOX_LOG(Error,
+                    "Unable to create the notification sender socket: "
+                        << socketCall.error().getHumanReadableErrnum());
+            return;
+        }
+
+        // a notifier must never block on the full socket buffer of a listener which does not drain its socket
+        auto setNonBlockingCall = IOX_POSIX_CALL(iox_fcntl3)(socketCall->value, F_SETFL, O_NONBLOCK)
+                                      .failureReturnValue(ERROR_CODE)
+                                      .evaluate();
+        if (setNonBlockingCall.has_error())
+        {
+            IOX_LOG(Error,
+                    "Unable to set the notification sender socket non-blocking: "
+                        << setNonBlockingCall.error().getHumanReadableErrnum());
+            closeSocket(socketCall->value);
+            return;
+        }
+
+        m_fileDescriptor = socketCall->value;
+    }
+
+  private:
+    int32_t m_fileDescriptor{INVALID_FD};
+};
+} // namespace
+
+constexpr int32_t NotificationSocket::INVALID_FD;
+
+expected<NotificationSocket, NotificationSocketError> NotificationSocket::create() noexcept
+{
+    const auto name = createUniqueName();
+    auto socketAddress = toSocketAddress(name);
+
+    auto socketCall = IOX_POSIX_CALL(iox_socket)(AF_LOCAL, SOCK_DGRAM, 0).failureReturnValue(ERROR_CODE).evaluate();
+    if (socketCall.has_error())
+    {
+        IOX_LOG(Error, "Unable to create the notification socket: " << socketCall.error().getHumanReadableErrnum());
+        return err(NotificationSocketError::SOCKET_CREATION_FAILED);
+    }
+    const int32_t fileDescriptor = socketCall->value;
+
+    // a remnant of a crashed process with the same process id would prevent the binding
+    removeSocketFile(name);
+
+    {
+        // like the unix domain socket of the IPC channel, users and group members are allowed to send to the socket
+        // NOLINTJUSTIFICATION type is defined by POSIX, no logical fault
+        // NOLINTNEXTLINE(hicpp-signed-bitwise)
+        const mode_t umaskSaved = umask(S_IXUSR | S_IXGRP | S_IRWXO);
+        ScopeGuard umaskGuard([&umaskSaved] { umask(umaskSaved); });
+
+        auto bindCall =
+            // NOLINTJUSTIFICATION enforced by POSIX API
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            IOX_POSIX_CALL(iox_bind)(fileDescriptor, reinterpret_cast<sockaddr*>(&socketAddress), sizeof(socketAddress))
+                .failureReturnValue(ERROR_CODE)
+                .evaluate();
+        if (bindCall.has_error())
+        {
+            IOX_LOG(Error,
+                    "Unable to bind the notification socket \"" << name
+                                                                << "\": " << bindCall.error().getHumanReadableErrnum());
+            closeSocket(fileDescriptor);
+            return err(NotificationSocketError::BINDING_FAILED);
+        }
+    }
+
+    // the socket is drained until it is empty and the notifiers must never block
+    auto setNonBlockingCall = IOX_POSIX_CALL(iox_fcntl3)(fileDescriptor, F_SETFL, O_NONBLOCK)
+                                  .failureReturnValue(ERROR_CODE)
+                                  .evaluate();
+    if (setNonBlockingCall.has_error())
+    {
+        IOX_LOG(Error,
+                "Unable to set the notification socket \""
+                    << name << "\" non-blocking: " << setNonBlockingCall.error().getHumanReadableErrnum());
+        closeSocket(fileDescriptor);
+        removeSocketFile(name);
+        return err(NotificationSocketError::UNABLE_TO_SET_NON_BLOCKING);
+    }
+
+    return ok(NotificationSocket{fileDescriptor, name});
+}
+
+NotificationSocket::NotificationSocket(const int32_t fileDescriptor, const Name_t& name) noexcept
+    : m_fileDescriptor(fileDescriptor)
+    , m_name(name)
+{
+}
+
+NotificationSocket::NotificationSocket(NotificationSocket&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+NotificationSocket& NotificationSocket::operator=(NotificationSocket&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        destroy();
+        m_fileDescriptor = rhs.m_fileDescriptor;
+        m_name = rhs.m_name;
+        rhs.m_fileDescriptor = INVALID_FD;
+    }
+    return *this;
+}
+
+NotificationSocket::~NotificationSocket() noexcept
+{
+    destroy();
+}
+
+void NotificationSocket::destroy() noexcept
+{
+    if (m_fileDescriptor == INVALID_FD)
+    {
+        return;
+    }
+
+    closeSocket(m_fileDescriptor);
+    m_fileDescriptor = INVALID_FD;
+    removeSocketFile(m_name);
+}
+
+int32_t NotificationSocket::getFileDescriptor() const noexcept
+{
+    return m_fileDescriptor;
+}
+
+const NotificationSocket::Name_t& NotificationSocket::getName() const noexcept
+{
+    return m_name;
+}
+
+void NotificationSocket::drain() const noexcept
+{
+    uint8_t datagram{0U};
+    bool isDrained{false};
+    while (!isDrained)
+    {
+        IOX_POSIX_CALL(iox_recvfrom)
+        (m_fileDescriptor, &datagram, sizeof(datagram), 0, nullptr, nullptr)
+            .failureReturnValue(ERROR_CODE)
+            .ignoreErrnos(EAGAIN, EWOULDBLOCK)
+            .evaluate()
+            .and_then([&](auto& r) { isDrained = (r.value == ERROR_CODE); })
+            .or_else([&](auto& r) {
+                IOX_LOG(Error,
+                        "Unable to drain the notification socket \"" << m_name
+                                                                     << "\": " << r.getHumanReadableErrnum());
+                isDrained = true;
+            });
+    }
+}
+
+void NotificationSocket::signal(const Name_t& name) noexcept
+{
+    const int32_t fileDescriptor = SenderSocket::instance().getFileDescriptor();
+    if (fileDescriptor == SenderSocket::INVALID_FD)
+    {
+        IOX_LOG(Error, "Unable to signal the notification socket \"" << name << "\" without a sender socket");
+        return;
+    }
+
+    const auto socketAddress = toSocketAddress(name);
+    const uint8_t datagram{0U};
+    // a full socket buffer is not an error since the socket is readable anyway; a missing socket belongs to a
+    // ConditionListener which was destroyed concurrently
+    IOX_POSIX_CALL(iox_sendto)
+    (fileDescriptor,
+     &datagram,
+     sizeof(datagram),
+     0,
+     // NOLINTJUSTIFICATION enforced by POSIX API
+     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+     reinterpret_cast<const sockaddr*>(&socketAddress),
+     sizeof(socketAddress))
+        .failureReturnValue(ERROR_CODE)
+        .ignoreErrnos(EAGAIN, EWOULDBLOCK, ENOENT, ECONNREFUSED)
+        .evaluate()
+        .or_else([&](auto& r) {
+            IOX_LOG(Error,
+                    "Unable to signal the notification socket \"" << name << "\": " << r.getHumanReadableErrnum());
+        });
+}
+
+} // namespace popo
+} // namespace iox
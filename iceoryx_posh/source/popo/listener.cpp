@@ -16,6 +16,7 @@
 
 #include "iceoryx_posh/popo/listener.hpp"
 #include "iox/assertions.hpp"
+#include "iox/logging.hpp"
 
 namespace iox
 {
@@ -26,10 +27,40 @@ Listener::Listener() noexcept
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariable) noexcept
-    : m_conditionVariableData(&conditionVariable)
+Listener::Listener(const ListenerOptions& options) noexcept
+    : Listener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), options)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariable, const ListenerOptions& options) noexcept
+    : m_threadSchedulingOptions(options.threadSchedulingOptions)
+    , m_conditionVariableData(&conditionVariable)
     , m_conditionListener(conditionVariable)
 {
+    auto numberOfWorkerThreads = options.numberOfWorkerThreads;
+    if (numberOfWorkerThreads > MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER)
+    {
+        IOX_LOG(Warn,
+                "The Listener supports at most " << MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER
+                                                 << " worker threads but " << numberOfWorkerThreads
+                                                 << " were requested. Limiting to the maximum.");
+        numberOfWorkerThreads = MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER;
+    }
+
+    if (numberOfWorkerThreads > 0U)
+    {
+        UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(false)
+            .create(m_workerSemaphore)
+            .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POPO__LISTENER_FAILED_TO_CREATE_WORKER_SEMAPHORE); });
+
+        for (uint32_t i = 0U; i < numberOfWorkerThreads; ++i)
+        {
+            m_workerThreads.emplace_back(&Listener::workerLoop, this);
+        }
+    }
+
     m_thread = std::thread(&Listener::threadLoop, this);
 }
 
@@ -39,6 +70,18 @@ Listener::~Listener() noexcept
     m_conditionListener.destroy();
 
     m_thread.join();
+
+    // every worker consumes one post and stops, queued events are not executed anymore
+    for (uint64_t i = 0U; i < m_workerThreads.size(); ++i)
+    {
+        m_workerSemaphore->post().or_else(
+            [](auto) { IOX_REPORT_FATAL(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED); });
+    }
+    for (auto& worker : m_workerThreads)
+    {
+        worker.join();
+    }
+
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
@@ -47,19 +90,130 @@ uint64_t Listener::size() const noexcept
     return m_indexManager.indicesInUse();
 }
 
+void Listener::setBusyPollDuration(const units::Duration duration) noexcept
+{
+    m_conditionListener.setBusyPollDuration(duration);
+}
+
+WaitStatistics Listener::getStatistics() const noexcept
+{
+    return m_conditionListener.getStatistics();
+}
+
 void Listener::threadLoop() noexcept
 {
+    IOX_DISCARD_RESULT(setThreadSchedulingOptions(m_threadSchedulingOptions));
+
     while (m_wasDtorCalled.load(std::memory_order_relaxed) == false)
     {
         auto activateNotificationIds = m_conditionListener.wait();
 
-        for (auto& id : activateNotificationIds)
+        if (!m_workerThreads.empty())
+        {
+            for (auto& id : activateNotificationIds)
+            {
+                dispatchToWorker(id);
+            }
+            continue;
+        }
+
+        for (uint64_t priority = 0U; priority < NUMBER_OF_PRIORITIES; ++priority)
+        {
+            for (auto& id : activateNotificationIds)
+            {
+                if (static_cast<uint64_t>(m_eventPriorities[id].load(std::memory_order_relaxed)) == priority)
+                {
+                    m_events[id]->executeCallback();
+                }
+            }
+        }
+    }
+}
+
+void Listener::dispatchToWorker(const uint64_t index) noexcept
+{
+    auto& eventState = m_eventStates[index];
+    auto state = eventState.load(std::memory_order_relaxed);
+    while (true)
+    {
+        if (state == EventState::IDLE)
+        {
+            if (eventState.compare_exchange_weak(state, EventState::QUEUED, std::memory_order_relaxed))
+            {
+                enqueue(index);
+                return;
+            }
+        }
+        else if (state == EventState::RUNNING)
+        {
+            // the event must not be processed concurrently, the worker which runs it queues it again when it is done
+            if (eventState.compare_exchange_weak(state, EventState::RUNNING_AND_NOTIFIED, std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+        else
         {
-            m_events[id]->executeCallback();
+            // a queued event is executed anyway and covers the new notification as well
+            return;
         }
     }
 }
 
+void Listener::enqueue(const uint64_t index) noexcept
+{
+    const auto priority = static_cast<uint64_t>(m_eventPriorities[index].load(std::memory_order_relaxed));
+    IOX_ENFORCE(m_queuedEvents[priority].tryPush(static_cast<uint32_t>(index)),
+                "An event is queued at most once and therefore the queue cannot overflow");
+    m_workerSemaphore->post().or_else(
+        [](auto) { IOX_REPORT_FATAL(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED); });
+}
+
+void Listener::workerLoop() noexcept
+{
+    IOX_DISCARD_RESULT(setThreadSchedulingOptions(m_threadSchedulingOptions));
+
+    while (true)
+    {
+        if (m_workerSemaphore->wait().has_error())
+        {
+            IOX_REPORT_FATAL(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED);
+            return;
+        }
+
+        if (m_wasDtorCalled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // every post belongs to a queued event, the event of the highest priority class is executed first
+        for (auto& queuedEvents : m_queuedEvents)
+        {
+            auto index = queuedEvents.pop();
+            if (index.has_value())
+            {
+                executeQueuedEvent(index.value());
+                break;
+            }
+        }
+    }
+}
+
+void Listener::executeQueuedEvent(const uint32_t index) noexcept
+{
+    auto& eventState = m_eventStates[index];
+    eventState.store(EventState::RUNNING, std::memory_order_relaxed);
+    m_events[index]->executeCallback();
+
+    auto state = EventState::RUNNING;
+    if (!eventState.compare_exchange_strong(state, EventState::IDLE, std::memory_order_relaxed))
+    {
+        // the event was notified while the callback was running
+        eventState.store(EventState::QUEUED, std::memory_order_relaxed);
+        enqueue(index);
+    }
+}
+
 void Listener::removeTrigger(const uint64_t index) noexcept
 {
     if (index >= MAX_NUMBER_OF_EVENTS)
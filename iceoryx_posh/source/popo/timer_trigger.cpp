@@ -0,0 +1,162 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/timer_trigger.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+// explicitly implemented for MSVC
+TimerTrigger::TimerTrigger() noexcept
+{
+}
+
+TimerTrigger::~TimerTrigger() noexcept
+{
+    // the timer must be released before the members are destroyed since the reset of the trigger handle calls back
+    // into this object
+    disableEvent();
+}
+
+expected<void, TimerTriggerError> TimerTrigger::start(const units::Duration interval,
+                                                      const TimerTriggerMode mode) noexcept
+{
+    if (interval == units::Duration::zero())
+    {
+        IOX_LOG(Error, "The interval of a TimerTrigger must be greater than zero.");
+        return err(TimerTriggerError::INVALID_INTERVAL);
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_intervalInNanoseconds = interval.toNanoseconds();
+    m_firstDeadline = ConditionVariableData::currentTimestamp() + m_intervalInNanoseconds;
+    m_mode = mode;
+    m_isStarted = true;
+    armTimer();
+
+    return ok();
+}
+
+void TimerTrigger::stop() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_isStarted = false;
+    if (m_timer != nullptr)
+    {
+        m_timer->m_deadline.store(0U, std::memory_order_relaxed);
+    }
+}
+
+bool TimerTrigger::isRunning() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (m_timer != nullptr && m_mode == TimerTriggerMode::ONE_SHOT)
+    {
+        return m_isStarted && m_timer->m_deadline.load(std::memory_order_relaxed) != 0U;
+    }
+    return m_isStarted;
+}
+
+bool TimerTrigger::hasTriggered() const noexcept
+{
+    return m_trigger.wasTriggered();
+}
+
+void TimerTrigger::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (uniqueTriggerId == m_trigger.getUniqueId())
+    {
+        releaseTimer();
+        m_trigger.invalidate();
+    }
+}
+
+void TimerTrigger::enableEvent(iox::popo::TriggerHandle&& triggerHandle) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    releaseTimer();
+    m_trigger = std::move(triggerHandle);
+    acquireTimer();
+    armTimer();
+}
+
+void TimerTrigger::disableEvent() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    releaseTimer();
+    m_trigger.reset();
+}
+
+void TimerTrigger::acquireTimer() noexcept
+{
+    auto* conditionVariableData = m_trigger.getConditionVariableData();
+    if (conditionVariableData == nullptr)
+    {
+        return;
+    }
+
+    for (auto& timer : conditionVariableData->m_timers)
+    {
+        bool isInUse{false};
+        if (timer.m_isInUse.compare_exchange_strong(isInUse, true, std::memory_order_acq_rel))
+        {
+            m_timer = &timer;
+            return;
+        }
+    }
+
+    IOX_LOG(Error,
+            "Unable to attach the TimerTrigger since all " << MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE
+                                                           << " timers of the WaitSet/Listener are in use.");
+    IOX_REPORT(PoshError::POPO__TIMER_TRIGGER_NO_FREE_TIMER, iox::er::RUNTIME_ERROR);
+}
+
+void TimerTrigger::armTimer() noexcept
+{
+    if (m_timer == nullptr || !m_isStarted)
+    {
+        return;
+    }
+
+    const uint64_t period = (m_mode == TimerTriggerMode::PERIODIC) ? m_intervalInNanoseconds : 0U;
+    m_timer->m_period.store(period, std::memory_order_relaxed);
+    m_timer->m_notificationIndex.store(m_trigger.getUniqueId(), std::memory_order_relaxed);
+    // pairs with the acquire load in ConditionListener::expireTimers
+    m_timer->m_deadline.store(m_firstDeadline, std::memory_order_release);
+
+    // a listener which is already blocked does not know the new deadline
+    ConditionNotifier(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId()).interruptBlockingWait();
+}
+
+void TimerTrigger::releaseTimer() noexcept
+{
+    if (m_timer == nullptr)
+    {
+        return;
+    }
+
+    m_timer->m_deadline.store(0U, std::memory_order_relaxed);
+    m_timer->m_isInUse.store(false, std::memory_order_release);
+    m_timer = nullptr;
+}
+
+} // namespace popo
+} // namespace iox
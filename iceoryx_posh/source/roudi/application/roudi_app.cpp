@@ -46,10 +46,20 @@ RouDiApp::RouDiApp(const IceoryxConfig& config) noexcept
         IOX_LOG(Trace,
                 "  Unique RouDi ID = " << static_cast<roudi::UniqueRouDiId::value_type>(roudiConfig.uniqueRouDiId));
         IOX_LOG(Trace, "  Monitoring Mode = " << roudiConfig.monitoringMode);
+        IOX_LOG(Trace, "  Memory Residency = " << roudiConfig.memoryResidency);
         IOX_LOG(Trace, "  Shares Address Space With Applications = " << roudiConfig.sharesAddressSpaceWithApplications);
         IOX_LOG(Trace, "  Process Termination Delay = " << roudiConfig.processTerminationDelay);
         IOX_LOG(Trace, "  Process Kill Delay = " << roudiConfig.processKillDelay);
         IOX_LOG(Trace, "  Compatibility Check Level = " << roudiConfig.compatibilityCheckLevel);
+        IOX_LOG(Trace, "  Runtime Message Worker Count = " << roudiConfig.runtimeMessageWorkerCount);
+        IOX_LOG(Trace,
+                "  Port Pool Capacity = " << roudiConfig.portPoolCapacity.publishers << " publishers, "
+                                          << roudiConfig.portPoolCapacity.subscribers << " subscribers, "
+                                          << roudiConfig.portPoolCapacity.servers << " servers, "
+                                          << roudiConfig.portPoolCapacity.clients << " clients, "
+                                          << roudiConfig.portPoolCapacity.interfaces << " interfaces, "
+                                          << roudiConfig.portPoolCapacity.conditionVariables
+                                          << " condition variables");
         IOX_LOG(Trace, "  Introspection Chunk Count = " << roudiConfig.introspectionChunkCount);
         IOX_LOG(Trace, "  Discovery Chunk Count = " << roudiConfig.discoveryChunkCount);
     }
@@ -29,8 +29,9 @@ namespace roudi
 DefaultRouDiMemory::DefaultRouDiMemory(const IceoryxConfig& config) noexcept
     : m_introspectionMemPoolBlock(introspectionMemPoolConfig(config.introspectionChunkCount))
     , m_discoveryMemPoolBlock(discoveryMemPoolConfig(config.discoveryChunkCount))
-    , m_segmentManagerBlock(config, config.domainId)
-    , m_managementShm(SHM_NAME, config.domainId, AccessMode::ReadWrite, OpenMode::PurgeAndCreate)
+    , m_segmentManagerBlock(config, config.domainId, config.memoryResidency)
+    , m_managementShm(
+          SHM_NAME, config.domainId, AccessMode::ReadWrite, OpenMode::PurgeAndCreate, config.memoryResidency)
 {
     m_managementShm.addMemoryBlock(&m_introspectionMemPoolBlock).or_else([](auto) {
         IOX_REPORT_FATAL(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_INTROSPECTION_MEMORY_BLOCK);
@@ -41,8 +41,9 @@ IceOryxRouDiMemoryManager::IceOryxRouDiMemoryManager(const IceoryxConfig& config
                   }
               })
               .value()))
-    , m_portPoolBlock(config.uniqueRouDiId)
+    , m_portPoolBlock(config.uniqueRouDiId, config.portPoolCapacity)
     , m_defaultMemory(config)
+    , m_memoryManager(config.memoryResidency)
 {
     m_defaultMemory.m_managementShm.addMemoryBlock(&m_portPoolBlock).or_else([](auto) {
         IOX_REPORT_FATAL(PoshError::ICEORYX_ROUDI_MEMORY_MANAGER__FAILED_TO_ADD_PORTPOOL_MEMORY_BLOCK);
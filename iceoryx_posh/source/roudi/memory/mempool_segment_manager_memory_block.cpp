@@ -26,9 +26,11 @@ namespace iox
 namespace roudi
 {
 MemPoolSegmentManagerMemoryBlock::MemPoolSegmentManagerMemoryBlock(const mepoo::SegmentConfig& segmentConfig,
-                                                                   const DomainId domainId) noexcept
+                                                                   const DomainId domainId,
+                                                                   const MemoryResidency memoryResidency) noexcept
     : m_segmentConfig(segmentConfig)
     , m_domainId(domainId)
+    , m_memoryResidency(memoryResidency)
 {
 }
 
@@ -55,7 +57,8 @@ void MemPoolSegmentManagerMemoryBlock::onMemoryAvailable(not_null<void*> memory)
     BumpAllocator allocator(memory, size());
     auto* segmentManager = allocator.allocate(sizeof(mepoo::SegmentManager<>), alignof(mepoo::SegmentManager<>))
                                .expect("There should be enough memory for the 'SegmentManager'");
-    m_segmentManager = new (segmentManager) mepoo::SegmentManager<>(m_segmentConfig, m_domainId, &allocator);
+    m_segmentManager =
+        new (segmentManager) mepoo::SegmentManager<>(m_segmentConfig, m_domainId, &allocator, m_memoryResidency);
 }
 
 void MemPoolSegmentManagerMemoryBlock::destroy() noexcept
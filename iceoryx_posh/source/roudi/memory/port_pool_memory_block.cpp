@@ -18,13 +18,38 @@
 #include "iceoryx_posh/internal/roudi/memory/port_pool_memory_block.hpp"
 
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+#include "iox/assertions.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/logging.hpp"
 
 namespace iox
 {
 namespace roudi
 {
-PortPoolMemoryBlock::PortPoolMemoryBlock(const roudi::UniqueRouDiId uniqueRouDiId) noexcept
+namespace
+{
+config::PortPoolCapacity clampedCapacity(const config::PortPoolCapacity& capacity) noexcept
+{
+    auto clamped = capacity;
+    clamped.clamp();
+    if (clamped.publishers != capacity.publishers || clamped.subscribers != capacity.subscribers
+        || clamped.servers != capacity.servers || clamped.clients != capacity.clients
+        || clamped.interfaces != capacity.interfaces || clamped.conditionVariables != capacity.conditionVariables)
+    {
+        IOX_LOG(Warn,
+                "The port pool capacity exceeds the compile time maxima or is too small for the internal publishers! "
+                "Using " << clamped.publishers << " publishers, " << clamped.subscribers << " subscribers, "
+                         << clamped.servers << " servers, " << clamped.clients << " clients, " << clamped.interfaces
+                         << " interfaces and " << clamped.conditionVariables << " condition variables.");
+    }
+    return clamped;
+}
+} // namespace
+
+PortPoolMemoryBlock::PortPoolMemoryBlock(const roudi::UniqueRouDiId uniqueRouDiId,
+                                         const config::PortPoolCapacity& capacity) noexcept
     : m_uniqueRouDiId(uniqueRouDiId)
+    , m_capacity(clampedCapacity(capacity))
 {
 }
 
@@ -35,7 +60,7 @@ PortPoolMemoryBlock::~PortPoolMemoryBlock() noexcept
 
 uint64_t PortPoolMemoryBlock::size() const noexcept
 {
-    return sizeof(PortPoolData);
+    return sizeof(PortPoolData) + PortPoolData::requiredStorageSize(m_capacity);
 }
 
 uint64_t PortPoolMemoryBlock::alignment() const noexcept
@@ -45,7 +70,10 @@ uint64_t PortPoolMemoryBlock::alignment() const noexcept
 
 void PortPoolMemoryBlock::onMemoryAvailable(not_null<void*> memory) noexcept
 {
-    m_portPoolData = new (memory) PortPoolData{m_uniqueRouDiId};
+    BumpAllocator allocator(memory, size());
+    auto portPoolData = allocator.allocate(sizeof(PortPoolData), alignof(PortPoolData));
+    IOX_ENFORCE(!portPoolData.has_error(), "The memory for the PortPool must be at least 'size()' bytes!");
+    m_portPoolData = new (portPoolData.value()) PortPoolData{m_uniqueRouDiId, m_capacity, allocator};
 }
 
 void PortPoolMemoryBlock::destroy() noexcept
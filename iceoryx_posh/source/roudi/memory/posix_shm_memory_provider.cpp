@@ -35,11 +35,13 @@ constexpr access_rights PosixShmMemoryProvider::SHM_MEMORY_PERMISSIONS;
 PosixShmMemoryProvider::PosixShmMemoryProvider(const ShmName_t& shmName,
                                                const DomainId domainId,
                                                const AccessMode accessMode,
-                                               const OpenMode openMode) noexcept
+                                               const OpenMode openMode,
+                                               const MemoryResidency memoryResidency) noexcept
     : m_shmName(shmName)
     , m_domainId(domainId)
     , m_accessMode(accessMode)
     , m_openMode(openMode)
+    , m_memoryResidency(memoryResidency)
 {
 }
 
@@ -65,6 +67,8 @@ expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(const
              .accessMode(m_accessMode)
              .openMode(m_openMode)
              .permissions(SHM_MEMORY_PERMISSIONS)
+             .prefault(m_memoryResidency != MemoryResidency::OFF)
+             .lockMemory(m_memoryResidency == MemoryResidency::PREFAULT_AND_LOCK)
              .create()
              .and_then([this](auto& sharedMemoryObject) { m_shmObject.emplace(std::move(sharedMemoryObject)); }))
     {
@@ -18,7 +18,11 @@
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 
 #include "iceoryx_posh/roudi/memory/memory_provider.hpp"
+#include "iox/assertions.hpp"
 #include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
+
+#include "iceoryx_platform/time.hpp"
 
 namespace iox
 {
@@ -47,6 +51,27 @@ iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const RouDiMemor
     return logstream;
 }
 
+namespace
+{
+units::Duration monotonicTime() noexcept
+{
+    struct timespec timepoint
+    {
+    };
+
+    IOX_ENFORCE(
+        !IOX_POSIX_CALL(iox_clock_gettime)(CLOCK_MONOTONIC, &timepoint).failureReturnValue(-1).evaluate().has_error(),
+        "An error which should never happen occured during 'iox_clock_gettime'!");
+
+    return units::Duration(timepoint);
+}
+} // namespace
+
+RouDiMemoryManager::RouDiMemoryManager(const MemoryResidency memoryResidency) noexcept
+    : m_memoryResidency(memoryResidency)
+{
+}
+
 RouDiMemoryManager::~RouDiMemoryManager() noexcept
 {
     destroyMemory().or_else([](auto) { IOX_LOG(Warn, "Failed to cleanup RouDiMemoryManager in destructor."); });
@@ -68,6 +93,9 @@ expected<void, RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMem
         return err(RouDiMemoryManagerError::NO_MEMORY_PROVIDER_PRESENT);
     }
 
+    // the payload segments are created when the memory is announced, therefore both steps are measured
+    const auto startTime = monotonicTime();
+
     for (auto memoryProvider : m_memoryProvider)
     {
         auto result = memoryProvider->create();
@@ -85,6 +113,18 @@ expected<void, RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMem
         memoryProvider->announceMemoryAvailable();
     }
 
+    const auto creationTime = monotonicTime() - startTime;
+    if (m_memoryResidency != MemoryResidency::OFF)
+    {
+        IOX_LOG(Info,
+                "Created shared memory with " << m_memoryResidency << " in " << creationTime.toMilliseconds()
+                                              << " ms");
+    }
+    else
+    {
+        IOX_LOG(Debug, "Created shared memory in " << creationTime.toMilliseconds() << " ms");
+    }
+
     return ok();
 }
 
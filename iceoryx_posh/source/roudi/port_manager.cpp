@@ -263,6 +263,7 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
                                                  << clientPortData->m_serviceDescription << "'");
 
     // delete client port from list after DISCONNECT was processed
+    m_clientIndex.remove(clientPortData);
     m_portPool->removeClientPort(clientPortData);
 }
 
@@ -361,6 +362,7 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
                                                  << serverPortData->m_serviceDescription << "'");
 
     // delete server port from list after STOP_OFFER was processed
+    m_serverIndex.remove(serverPortData);
     m_portPool->removeServerPort(serverPortData);
 }
 
@@ -527,8 +529,7 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
-    {
+    m_publisherIndex.forEachPortWith(subscriberSource.getCaProServiceDescription(), [&](auto& publisherPortData) {
         PublisherPortRouDiType publisherPort(&publisherPortData);
 
         auto messageInterface = message.m_serviceDescription.getSourceInterface();
@@ -539,7 +540,7 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
         if (publisherInterface != capro::Interfaces::INTERNAL && publisherInterface == messageInterface)
         {
             // iox-#1908
-            continue;
+            return;
         }
 
         if (isCompatiblePubSub(publisherPort, subscriberSource))
@@ -558,15 +559,14 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
             }
             publisherFound = true;
         }
-    }
+    });
     return publisherFound;
 }
 
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto& subscriberPortData : m_portPool->getSubscriberPortDataList())
-    {
+    m_subscriberIndex.forEachPortWith(publisherSource.getCaProServiceDescription(), [&](auto& subscriberPortData) {
         SubscriberPortType subscriberPort(&subscriberPortData);
 
         auto messageInterface = message.m_serviceDescription.getSourceInterface();
@@ -577,7 +577,7 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
         if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
         {
             // iox-#1908
-            continue;
+            return;
         }
 
         if (isCompatiblePubSub(publisherSource, subscriberPort))
@@ -608,7 +608,7 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
                 }
             }
         }
-    }
+    });
 }
 
 bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
@@ -631,8 +631,7 @@ bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
 void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
                                                popo::ServerPortRouDi& serverSource) noexcept
 {
-    for (auto& clientPortData : m_portPool->getClientPortDataList())
-    {
+    m_clientIndex.forEachPortWith(serverSource.getCaProServiceDescription(), [&](auto& clientPortData) {
         popo::ClientPortRouDi clientPort(clientPortData);
         if (isCompatibleClientServer(serverSource, clientPort))
         {
@@ -663,15 +662,14 @@ void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& messag
                 }
             }
         }
-    }
+    });
 }
 
 bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& message,
                                                popo::ClientPortRouDi& clientSource) noexcept
 {
     bool serverFound = false;
-    for (auto& serverPortData : m_portPool->getServerPortDataList())
-    {
+    m_serverIndex.forEachPortWith(clientSource.getCaProServiceDescription(), [&](auto& serverPortData) {
         popo::ServerPortRouDi serverPort(serverPortData);
         if (isCompatibleClientServer(serverPort, clientSource))
         {
@@ -692,7 +690,7 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
             }
             serverFound = true;
         }
-    }
+    });
     return serverFound;
 }
 
@@ -858,6 +856,7 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
                                                     << "' and with service description '"
                                                     << publisherPortData->m_serviceDescription << "'");
     // delete publisher port from list after STOP_OFFER was processed
+    m_publisherIndex.remove(publisherPortData);
     m_portPool->removePublisherPort(publisherPortData);
 }
 
@@ -886,6 +885,7 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
                                                      << "' and with service description '"
                                                      << subscriberPortData->m_serviceDescription << "'");
     // delete subscriber port from list after UNSUB was processed
+    m_subscriberIndex.remove(subscriberPortData);
     m_portPool->removeSubscriberPort(subscriberPortData);
 }
 
@@ -944,6 +944,7 @@ PortManager::acquirePublisherPortDataWithoutDiscovery(const capro::ServiceDescri
         auto publisherPortData = maybePublisherPortData.value();
         if (publisherPortData)
         {
+            m_publisherIndex.add(publisherPortData);
             m_portIntrospection.addPublisher(*publisherPortData);
         }
     }
@@ -997,6 +998,7 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
         auto subscriberPortData = maybeSubscriberPortData.value();
         if (subscriberPortData)
         {
+            m_subscriberIndex.add(subscriberPortData);
             m_portIntrospection.addSubscriber(*subscriberPortData);
 
             // we do discovery here for trying to connect with publishers if subscribe on create is desired
@@ -1019,6 +1021,7 @@ PortManager::acquireClientPortData(const capro::ServiceDescription& service,
     return m_portPool
         ->addClientPort(service, payloadDataSegmentMemoryManager, runtimeName, clientOptions, portConfigInfo.memoryInfo)
         .and_then([this](auto clientPortData) {
+            m_clientIndex.add(clientPortData);
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the client if offer on create is desired
@@ -1036,34 +1039,33 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
 {
     // it is not allowed to have two servers with the same ServiceDescription;
     // check if the server is already in the list
-    auto& serverPorts = m_portPool->getServerPortDataList();
-    auto port = serverPorts.begin();
-    while (port != serverPorts.end())
-    {
-        auto currentPort = port++;
-
-        if (service == currentPort->m_serviceDescription)
+    optional<RuntimeName_t> usedByProcess;
+    m_serverIndex.forEachPortWith(service, [&](auto& serverPortData) {
+        if (serverPortData.m_toBeDestroyed)
         {
-            if (currentPort->m_toBeDestroyed)
-            {
-                destroyServerPort(currentPort.to_ptr());
-                continue;
-            }
-            IOX_LOG(Warn,
-                    "Process '"
-                        << runtimeName
-                        << "' violates the communication policy by requesting a ServerPort which is already used by '"
-                        << currentPort->m_runtimeName << "' with service '"
-                        << service.operator Serialization().toString() << "'.");
-            IOX_REPORT(PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE, iox::er::RUNTIME_ERROR);
-            return err(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS);
+            destroyServerPort(&serverPortData);
+            return;
         }
+        usedByProcess = serverPortData.m_runtimeName;
+    });
+
+    if (usedByProcess.has_value())
+    {
+        IOX_LOG(Warn,
+                "Process '"
+                    << runtimeName
+                    << "' violates the communication policy by requesting a ServerPort which is already used by '"
+                    << usedByProcess.value() << "' with service '" << service.operator Serialization().toString()
+                    << "'.");
+        IOX_REPORT(PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE, iox::er::RUNTIME_ERROR);
+        return err(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS);
     }
 
     // we can create a new port
     return m_portPool
         ->addServerPort(service, payloadDataSegmentMemoryManager, runtimeName, serverOptions, portConfigInfo.memoryInfo)
         .and_then([this](auto serverPortData) {
+            m_serverIndex.add(serverPortData);
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the waiting client if offer on create is desired
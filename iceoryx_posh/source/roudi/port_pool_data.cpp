@@ -0,0 +1,47 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+uint64_t PortPoolData::requiredStorageSize(const config::PortPoolCapacity& capacity) noexcept
+{
+    return InterfaceContainer::requiredMemorySize(capacity.interfaces)
+           + CondVarContainer::requiredMemorySize(capacity.conditionVariables)
+           + PublisherContainer::requiredMemorySize(capacity.publishers)
+           + SubscriberContainer::requiredMemorySize(capacity.subscribers)
+           + ServerContainer::requiredMemorySize(capacity.servers)
+           + ClientContainer::requiredMemorySize(capacity.clients);
+}
+
+PortPoolData::PortPoolData(const roudi::UniqueRouDiId uniqueRouDiId,
+                           const config::PortPoolCapacity& capacity,
+                           BumpAllocator& storage) noexcept
+    : m_interfacePortMembers(capacity.interfaces, storage)
+    , m_conditionVariableMembers(capacity.conditionVariables, storage)
+    , m_publisherPortMembers(capacity.publishers, storage)
+    , m_subscriberPortMembers(capacity.subscribers, storage)
+    , m_serverPortMembers(capacity.servers, storage)
+    , m_clientPortMembers(capacity.clients, storage)
+    , m_uniqueRouDiId(uniqueRouDiId)
+{
+}
+} // namespace roudi
+} // namespace iox
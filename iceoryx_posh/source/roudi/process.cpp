@@ -40,6 +40,12 @@ Process::Process(const RuntimeName_t& name,
 {
 }
 
+Process::~Process() noexcept
+{
+    // the process is only removed while the ProcessManager is locked, no new PendingReply can lock the IPC channel
+    std::lock_guard<std::mutex> lock(m_ipcChannelMutex);
+}
+
 uint32_t Process::getPid() const noexcept
 {
     return m_pid;
@@ -51,6 +57,12 @@ const RuntimeName_t Process::getName() const noexcept
 }
 
 void Process::sendViaIpcChannel(const runtime::IpcMessage& data) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_ipcChannelMutex);
+    sendViaLockedIpcChannel(data);
+}
+
+void Process::sendViaLockedIpcChannel(const runtime::IpcMessage& data) noexcept
 {
     bool sendSuccess = m_ipcChannel.send(data);
     if (!sendSuccess)
@@ -80,5 +92,47 @@ bool Process::isMonitored() const noexcept
     return m_heartbeatPoolIndex != HeartbeatPool::Index::INVALID;
 }
 
+PendingReply::PendingReply(Process& process, const runtime::IpcMessage& message) noexcept
+    : m_process(&process)
+    , m_ipcChannelLock(process.m_ipcChannelMutex)
+    , m_message(message)
+{
+}
+
+PendingReply::PendingReply(PendingReply&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+PendingReply& PendingReply::operator=(PendingReply&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        send();
+        m_process = rhs.m_process;
+        m_ipcChannelLock = std::move(rhs.m_ipcChannelLock);
+        m_message = std::move(rhs.m_message);
+        rhs.m_process = nullptr;
+    }
+    return *this;
+}
+
+PendingReply::~PendingReply() noexcept
+{
+    send();
+}
+
+void PendingReply::send() noexcept
+{
+    if (m_process == nullptr)
+    {
+        return;
+    }
+
+    m_process->sendViaLockedIpcChannel(m_message);
+    m_process = nullptr;
+    m_ipcChannelLock.unlock();
+}
+
 } // namespace roudi
 } // namespace iox
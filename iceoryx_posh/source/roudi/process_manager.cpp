@@ -19,6 +19,7 @@
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_platform/signal.hpp"
 #include "iceoryx_platform/types.hpp"
+#include "iceoryx_platform/unistd.hpp"
 #include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
@@ -30,6 +31,7 @@
 #include "iox/vector.hpp"
 
 #include <chrono>
+#include <limits>
 #include <thread>
 
 using namespace iox::units::duration_literals;
@@ -100,21 +102,28 @@ ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
     }
 }
 
-void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept
+PendingReply ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    PendingReply reply;
     findProcess(name)
         .and_then([&](auto& process) {
-            m_portManager.unblockProcessShutdown(name);
+            {
+                std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+                m_portManager.unblockProcessShutdown(name);
+            }
             // Reply with PREPARE_APP_TERMINATION_ACK and let process shutdown
             runtime::IpcMessage sendBuffer;
             sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::PREPARE_APP_TERMINATION_ACK);
-            process->sendViaIpcChannel(sendBuffer);
+            reply = PendingReply(*process, sendBuffer);
         })
         .or_else([&]() { IOX_LOG(Warn, "Unknown application " << name << " requested shutdown preparation."); });
+    return reply;
 }
 
 void ProcessManager::requestShutdownOfAllProcesses() noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
     for (auto& process : m_processList)
     {
@@ -123,16 +132,19 @@ void ProcessManager::requestShutdownOfAllProcesses() noexcept
     }
 
     // this unblocks the RouDi shutdown if a publisher port is blocked by a full subscriber queue
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     m_portManager.unblockRouDiShutdown();
 }
 
 uint64_t ProcessManager::registeredProcessCount() const noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     return m_processList.size();
 }
 
 bool ProcessManager::probeRegisteredProcessesAliveWithSigTerm() noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         if (probeProcessAliveWithSigTerm(process))
@@ -145,6 +157,7 @@ bool ProcessManager::probeRegisteredProcessesAliveWithSigTerm() noexcept
 
 void ProcessManager::killAllProcesses() noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(Warn,
@@ -156,6 +169,7 @@ void ProcessManager::killAllProcesses() noexcept
 
 void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(Warn,
@@ -195,6 +209,23 @@ bool ProcessManager::probeProcessAliveWithSigTerm(const Process& process) noexce
     return !(checkCommand && checkCommand->errnum == ESRCH);
 }
 
+bool ProcessManager::isProcessTerminated(const Process& process) const noexcept
+{
+    if (process.getPid() == static_cast<uint32_t>(getpid()))
+    {
+        return false;
+    }
+
+    // signal 0 only checks whether the process exists
+    static constexpr int32_t ERROR_CODE = -1;
+    auto checkCommand = IOX_POSIX_CALL(kill)(static_cast<pid_t>(process.getPid()), 0)
+                            .failureReturnValue(ERROR_CODE)
+                            .ignoreErrnos(ESRCH)
+                            .evaluate();
+
+    return checkCommand && checkCommand->errnum == ESRCH;
+}
+
 void ProcessManager::evaluateKillError(const Process& process,
                                        const int32_t& errnum,
                                        const char* errorString,
@@ -219,15 +250,16 @@ void ProcessManager::evaluateKillError(const Process& process,
     }
 }
 
-bool ProcessManager::registerProcess(const RuntimeName_t& name,
-                                     const uint32_t pid,
-                                     const PosixUser user,
-                                     const bool isMonitored,
-                                     const int64_t transmissionTimestamp,
-                                     const uint64_t sessionId,
-                                     const version::VersionInfo& versionInfo) noexcept
+optional<PendingReply> ProcessManager::registerProcess(const RuntimeName_t& name,
+                                                       const uint32_t pid,
+                                                       const PosixUser user,
+                                                       const bool isMonitored,
+                                                       const int64_t transmissionTimestamp,
+                                                       const uint64_t sessionId,
+                                                       const version::VersionInfo& versionInfo) noexcept
 {
-    bool returnValue{false};
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    optional<PendingReply> returnValue;
 
     findProcess(name)
         .and_then([&](auto& process) {
@@ -269,13 +301,13 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
     return returnValue;
 }
 
-bool ProcessManager::addProcess(const RuntimeName_t& name,
-                                const uint32_t pid,
-                                const PosixUser& user,
-                                const bool isMonitored,
-                                const int64_t transmissionTimestamp,
-                                const uint64_t sessionId,
-                                const version::VersionInfo& versionInfo) noexcept
+optional<PendingReply> ProcessManager::addProcess(const RuntimeName_t& name,
+                                                  const uint32_t pid,
+                                                  const PosixUser& user,
+                                                  const bool isMonitored,
+                                                  const int64_t transmissionTimestamp,
+                                                  const uint64_t sessionId,
+                                                  const version::VersionInfo& versionInfo) noexcept
 {
     if (!version::VersionInfo::getCurrentVersion().checkCompatibility(versionInfo, m_compatibilityCheckLevel))
     {
@@ -286,13 +318,13 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
                 << "'! Please build your app and RouDi against the same iceoryx version (version & commitID). RouDi: "
                 << version::VersionInfo::getCurrentVersion().operator iox::Serialization().toString()
                 << " App: " << versionInfo.operator iox::Serialization().toString());
-        return false;
+        return nullopt;
     }
     // overflow check
     if (m_processList.size() >= MAX_PROCESS_NUMBER)
     {
         IOX_LOG(Error, "Could not register process '" << name << "' - too many processes");
-        return false;
+        return nullopt;
     }
 
     auto heartbeatPoolIndex = HeartbeatPool::Index::INVALID;
@@ -314,16 +346,15 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
                << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << segmentManagerOffset << transmissionTimestamp
                << m_mgmtSegmentId << heartbeatOffset;
 
-    m_processList.back().sendViaIpcChannel(sendBuffer);
-
     m_processIntrospection->addProcess(static_cast<int>(pid), name);
 
     IOX_LOG(Debug, "Registered new application " << name);
-    return true;
+    return make_optional<PendingReply>(m_processList.back(), sendBuffer);
 }
 
 bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     constexpr TerminationFeedback FEEDBACK{TerminationFeedback::SEND_ACK_TO_PROCESS};
     if (!searchForProcessAndRemoveIt(name, FEEDBACK))
     {
@@ -358,7 +389,23 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 {
     if (processIter != m_processList.end())
     {
-        m_portManager.deletePortsOfProcess(processIter->getName());
+        {
+            std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+            m_portManager.deletePortsOfProcess(processIter->getName());
+        }
+        // chunks which are still cached by the threads of the process would be lost otherwise; a process which is
+        // still alive (e.g. one which unregisters itself or shares the pid with RouDi) might still use its thread
+        // caches and releases them on its own
+        if (isProcessTerminated(*processIter))
+        {
+            m_segmentManager->releaseThreadCachesOfProcess(processIter->getPid());
+        }
+        else
+        {
+            IOX_LOG(Debug,
+                    "The thread caches of the application '" << processIter->getName()
+                                                             << "' are not released since the process is still alive");
+        }
         m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
 
         if (feedback == TerminationFeedback::SEND_ACK_TO_PROCESS)
@@ -380,12 +427,19 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
     return false;
 }
 
-void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name, capro::Interfaces commInterface) noexcept
+PendingReply ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
+                                                    capro::Interfaces commInterface) noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    PendingReply reply;
     findProcess(name)
         .and_then([&](auto& process) {
             // create a ReceiverPort
-            popo::InterfacePortData* port = m_portManager.acquireInterfacePortData(commInterface, name);
+            popo::InterfacePortData* port{nullptr};
+            {
+                std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+                port = m_portManager.acquireInterfacePortData(commInterface, name);
+            }
 
             // send ReceiverPort to app as a serialized relative pointer
             auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, port);
@@ -393,256 +447,358 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name, capro::In
             runtime::IpcMessage sendBuffer;
             sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_INTERFACE_ACK)
                        << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-            process->sendViaIpcChannel(sendBuffer);
+            reply = PendingReply(*process, sendBuffer);
 
             IOX_LOG(Debug, "Created new interface for application " << name);
         })
         .or_else([&]() { IOX_LOG(Warn, "Unknown application " << name << " requested an interface."); });
+    return reply;
 }
 
-void ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept
+PendingReply ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    PendingReply reply;
     findProcess(name).and_then([&](auto& process) {
         runtime::IpcMessage sendBuffer;
         sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::MESSAGE_NOT_SUPPORTED);
-        process->sendViaIpcChannel(sendBuffer);
+        reply = PendingReply(*process, sendBuffer);
 
         IOX_LOG(Error, "Application " << name << " sent a message, which is not supported by this RouDi");
     });
+    return reply;
 }
 
-void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
-                                             const capro::ServiceDescription& service,
-                                             const popo::SubscriberOptions& subscriberOptions,
-                                             const PortConfigInfo& portConfigInfo) noexcept
+PendingReply ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
+                                                     const capro::ServiceDescription& service,
+                                                     const popo::SubscriberOptions& subscriberOptions,
+                                                     const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    PendingReply reply;
     findProcess(name)
         .and_then([&](auto& process) {
-            // create a SubscriberPort
-            auto maybeSubscriber =
-                m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
-
-            if (maybeSubscriber.has_value())
-            {
-                // send SubscriberPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                IOX_LOG(Debug,
-                        "Created new SubscriberPort for application '" << name << "' with service description '"
-                                                                       << service << "'");
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(Error,
-                        "Could not create SubscriberPort for application '" << name << "' with service description '"
-                                                                            << service << "'");
-            }
+            runtime::IpcMessage sendBuffer;
+            createSubscriberPort(*process, service, subscriberOptions, portConfigInfo, sendBuffer);
+            reply = PendingReply(*process, sendBuffer);
         })
         .or_else([&]() {
             IOX_LOG(Warn,
                     "Unknown application '" << name << "' requested a SubscriberPort with service description '"
                                             << service << "'");
         });
+    return reply;
 }
 
-void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
-                                            const capro::ServiceDescription& service,
-                                            const popo::PublisherOptions& publisherOptions,
-                                            const PortConfigInfo& portConfigInfo) noexcept
+PendingReply ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
+                                                    const capro::ServiceDescription& service,
+                                                    const popo::PublisherOptions& publisherOptions,
+                                                    const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    PendingReply reply;
     findProcess(name)
-        .and_then([&](auto& process) { // create a PublisherPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            auto maybePublisher = m_portManager.acquirePublisherPortData(
-                service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+        .and_then([&](auto& process) {
+            runtime::IpcMessage sendBuffer;
+            createPublisherPort(*process, service, publisherOptions, portConfigInfo, sendBuffer);
+            reply = PendingReply(*process, sendBuffer);
+        })
+        .or_else([&]() {
+            IOX_LOG(Warn,
+                    "Unknown application '" << name << "' requested a PublisherPort with service description '"
+                                            << service << "'");
+        });
+    return reply;
+}
 
-            if (maybePublisher.has_value())
-            {
-                // send PublisherPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
+PendingReply ProcessManager::addClientForProcess(const RuntimeName_t& name,
+                                                 const capro::ServiceDescription& service,
+                                                 const popo::ClientOptions& clientOptions,
+                                                 const PortConfigInfo& portConfigInfo) noexcept
+{
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    PendingReply reply;
+    findProcess(name)
+        .and_then([&](auto& process) {
+            runtime::IpcMessage sendBuffer;
+            createClientPort(*process, service, clientOptions, portConfigInfo, sendBuffer);
+            reply = PendingReply(*process, sendBuffer);
+        })
+        .or_else([&]() {
+            IOX_LOG(Warn,
+                    "Unknown application '" << name << "' requested a ClientPort with service description '" << service
+                                            << "'");
+        });
+    return reply;
+}
 
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
+PendingReply ProcessManager::addServerForProcess(const RuntimeName_t& name,
+                                                 const capro::ServiceDescription& service,
+                                                 const popo::ServerOptions& serverOptions,
+                                                 const PortConfigInfo& portConfigInfo) noexcept
+{
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    PendingReply reply;
+    findProcess(name)
+        .and_then([&](auto& process) {
+            runtime::IpcMessage sendBuffer;
+            createServerPort(*process, service, serverOptions, portConfigInfo, sendBuffer);
+            reply = PendingReply(*process, sendBuffer);
+        })
+        .or_else([&]() {
+            IOX_LOG(Warn,
+                    "Unknown application '" << name << "' requested a ServerPort with service description '" << service
+                                            << "'");
+        });
+    return reply;
+}
 
-                IOX_LOG(Debug,
-                        "Created new PublisherPort for application '" << name << "' with service description '"
-                                                                      << service << "'");
-            }
-            else
+PendingReply ProcessManager::addPortsForProcess(const RuntimeName_t& name, const runtime::PortBatch& ports) noexcept
+{
+    // the longest answer for a port consists of the ACK with at most two digits and the two numbers of the relative
+    // pointer, each followed by the separator
+    constexpr uint64_t MAX_DIGITS{std::numeric_limits<uint64_t>::digits10 + 1U};
+    constexpr uint64_t MAX_RESPONSE_SIZE_PER_PORT{3U + 2U * (MAX_DIGITS + 1U)};
+    static_assert(static_cast<uint64_t>(runtime::IpcMessageType::END) < 100U, "The message type has too many digits");
+    static_assert((runtime::PortBatch::MAX_PORTS_PER_REQUEST + 1U) * MAX_RESPONSE_SIZE_PER_PORT < APP_MESSAGE_SIZE,
+                  "The answer to a CREATE_PORTS request must fit into one message");
+
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    PendingReply reply;
+    findProcess(name)
+        .and_then([&](auto& process) {
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PORTS_ACK);
+            for (uint64_t i = 0U; i < ports.size(); ++i)
             {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-
-                std::string error;
-                switch (maybePublisher.error())
-                {
-                case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+                const auto& port = ports[i];
+                switch (port.kind())
                 {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+                case runtime::PortKind::PUBLISHER:
+                    createPublisherPort(*process,
+                                        port.service,
+                                        *port.options.get<popo::PublisherOptions>(),
+                                        port.portConfigInfo,
+                                        sendBuffer);
                     break;
-                }
-                case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+                case runtime::PortKind::SUBSCRIBER:
+                    createSubscriberPort(*process,
+                                         port.service,
+                                         *port.options.get<popo::SubscriberOptions>(),
+                                         port.portConfigInfo,
+                                         sendBuffer);
                     break;
-                }
-                default:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+                case runtime::PortKind::CLIENT:
+                    createClientPort(*process,
+                                     port.service,
+                                     *port.options.get<popo::ClientOptions>(),
+                                     port.portConfigInfo,
+                                     sendBuffer);
+                    break;
+                case runtime::PortKind::SERVER:
+                    createServerPort(*process,
+                                     port.service,
+                                     *port.options.get<popo::ServerOptions>(),
+                                     port.portConfigInfo,
+                                     sendBuffer);
                     break;
                 }
-                }
-                sendBuffer << error;
-
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(Error,
-                        "Could not create PublisherPort for application '" << name << "' with service description '"
-                                                                           << service << "'");
             }
+            reply = PendingReply(*process, sendBuffer);
         })
-        .or_else([&]() {
-            IOX_LOG(Warn,
-                    "Unknown application '" << name << "' requested a PublisherPort with service description '"
-                                            << service << "'");
-        });
+        .or_else(
+            [&]() { IOX_LOG(Warn, "Unknown application '" << name << "' requested " << ports.size() << " ports"); });
+    return reply;
+}
+
+void ProcessManager::createSubscriberPort(Process& process,
+                                          const capro::ServiceDescription& service,
+                                          const popo::SubscriberOptions& subscriberOptions,
+                                          const PortConfigInfo& portConfigInfo,
+                                          runtime::IpcMessage& response) noexcept
+{
+    const auto& name = process.getName();
+    // create a SubscriberPort
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+    auto maybeSubscriber = m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
+
+    if (maybeSubscriber.has_value())
+    {
+        // send SubscriberPort to app as a serialized relative pointer
+        auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
+
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
+                 << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
+
+        IOX_LOG(Debug,
+                "Created new SubscriberPort for application '" << name << "' with service description '" << service
+                                                               << "'");
+    }
+    else
+    {
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
+        response << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+        IOX_LOG(Error,
+                "Could not create SubscriberPort for application '" << name << "' with service description '"
+                                                                    << service << "'");
+    }
 }
 
-void ProcessManager::addClientForProcess(const RuntimeName_t& name,
+void ProcessManager::createPublisherPort(Process& process,
                                          const capro::ServiceDescription& service,
-                                         const popo::ClientOptions& clientOptions,
-                                         const PortConfigInfo& portConfigInfo) noexcept
+                                         const popo::PublisherOptions& publisherOptions,
+                                         const PortConfigInfo& portConfigInfo,
+                                         runtime::IpcMessage& response) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) { // create a ClientPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+    const auto& name = process.getName();
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
 
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
+        response << runtime::IpcMessageErrorTypeToString(
+            runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+        return;
+    }
 
-            m_portManager
-                .acquireClientPortData(
-                    service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& clientPort) {
-                    auto relativePtrToClientPort =
-                        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, clientPort);
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+    auto maybePublisher = m_portManager.acquirePublisherPortData(
+        service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
 
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CLIENT_ACK)
-                               << convert::toString(relativePtrToClientPort) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+    if (maybePublisher.has_value())
+    {
+        // send PublisherPort to app as a serialized relative pointer
+        auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
 
-                    IOX_LOG(Debug,
-                            "Created new ClientPort for application '" << name << "' with service description '"
-                                                                       << service << "'");
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
+                 << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
 
-                    IOX_LOG(Error,
-                            "Could not create ClientPort for application '" << name << "' with service description '"
-                                                                            << service << "'");
-                });
+        IOX_LOG(Debug,
+                "Created new PublisherPort for application '" << name << "' with service description '" << service
+                                                              << "'");
+    }
+    else
+    {
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
+
+        std::string error;
+        switch (maybePublisher.error())
+        {
+        case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+        {
+            error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+            break;
+        }
+        case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+        {
+            error = runtime::IpcMessageErrorTypeToString(
+                runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+            break;
+        }
+        default:
+        {
+            error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+            break;
+        }
+        }
+        response << error;
+
+        IOX_LOG(Error,
+                "Could not create PublisherPort for application '" << name << "' with service description '"
+                                                                   << service << "'");
+    }
+}
+
+void ProcessManager::createClientPort(Process& process,
+                                      const capro::ServiceDescription& service,
+                                      const popo::ClientOptions& clientOptions,
+                                      const PortConfigInfo& portConfigInfo,
+                                      runtime::IpcMessage& response) noexcept
+{
+    const auto& name = process.getName();
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
+        response << runtime::IpcMessageErrorTypeToString(
+            runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
+        return;
+    }
+
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+    m_portManager
+        .acquireClientPortData(service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
+        .and_then([&](auto& clientPort) {
+            auto relativePtrToClientPort = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, clientPort);
+
+            response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CLIENT_ACK)
+                     << convert::toString(relativePtrToClientPort) << convert::toString(m_mgmtSegmentId);
+
+            IOX_LOG(Debug,
+                    "Created new ClientPort for application '" << name << "' with service description '" << service
+                                                               << "'");
         })
-        .or_else([&]() {
-            IOX_LOG(Warn,
-                    "Unknown application '" << name << "' requested a ClientPort with service description '" << service
-                                            << "'");
+        .or_else([&](auto&) {
+            response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
+            response << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
+
+            IOX_LOG(Error,
+                    "Could not create ClientPort for application '" << name << "' with service description '"
+                                                                    << service << "'");
         });
 }
 
-void ProcessManager::addServerForProcess(const RuntimeName_t& name,
-                                         const capro::ServiceDescription& service,
-                                         const popo::ServerOptions& serverOptions,
-                                         const PortConfigInfo& portConfigInfo) noexcept
+void ProcessManager::createServerPort(Process& process,
+                                      const capro::ServiceDescription& service,
+                                      const popo::ServerOptions& serverOptions,
+                                      const PortConfigInfo& portConfigInfo,
+                                      runtime::IpcMessage& response) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) { // create a ServerPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
+    const auto& name = process.getName();
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
 
-            m_portManager
-                .acquireServerPortData(
-                    service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& serverPort) {
-                    auto relativePtrToServerPort =
-                        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, serverPort);
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
+        response << runtime::IpcMessageErrorTypeToString(
+            runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
+        return;
+    }
 
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SERVER_ACK)
-                               << convert::toString(relativePtrToServerPort) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+    m_portManager
+        .acquireServerPortData(service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
+        .and_then([&](auto& serverPort) {
+            auto relativePtrToServerPort = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, serverPort);
 
-                    IOX_LOG(Debug,
-                            "Created new ServerPort for application '" << name << "' with service description '"
-                                                                       << service << "'");
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
+            response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SERVER_ACK)
+                     << convert::toString(relativePtrToServerPort) << convert::toString(m_mgmtSegmentId);
 
-                    IOX_LOG(Error,
-                            "Could not create ServerPort for application '" << name << "' with service description '"
-                                                                            << service << "'");
-                });
+            IOX_LOG(Debug,
+                    "Created new ServerPort for application '" << name << "' with service description '" << service
+                                                               << "'");
         })
-        .or_else([&]() {
-            IOX_LOG(Warn,
-                    "Unknown application '" << name << "' requested a ServerPort with service description '" << service
-                                            << "'");
+        .or_else([&](auto&) {
+            response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
+            response << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
+
+            IOX_LOG(Error,
+                    "Could not create ServerPort for application '" << name << "' with service description '"
+                                                                    << service << "'");
         });
 }
 
-void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
+PendingReply ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    PendingReply reply;
     findProcess(runtimeName)
         .and_then([&](auto& process) { // Try to create a condition variable
+            std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
             m_portManager.acquireConditionVariableData(runtimeName)
                 .and_then([&](auto condVar) {
                     auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, condVar);
@@ -651,7 +807,7 @@ void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtime
                     sendBuffer << runtime::IpcMessageTypeToString(
                         runtime::IpcMessageType::CREATE_CONDITION_VARIABLE_ACK)
                                << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+                    reply = PendingReply(*process, sendBuffer);
 
                     IOX_LOG(Debug, "Created new ConditionVariable for application " << runtimeName);
                 })
@@ -663,22 +819,27 @@ void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtime
                         sendBuffer << runtime::IpcMessageErrorTypeToString(
                             runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL);
                     }
-                    process->sendViaIpcChannel(sendBuffer);
+                    reply = PendingReply(*process, sendBuffer);
 
                     IOX_LOG(Debug, "Could not create new ConditionVariable for application " << runtimeName);
                 });
         })
         .or_else([&]() { IOX_LOG(Warn, "Unknown application " << runtimeName << " requested a ConditionVariable."); });
+    return reply;
 }
 
 void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     m_processIntrospection = processIntrospection;
 }
 
 void ProcessManager::run() noexcept
 {
-    monitorProcesses();
+    {
+        std::lock_guard<std::mutex> processListLock(m_processListMutex);
+        monitorProcesses();
+    }
     discoveryUpdate();
 }
 
@@ -688,6 +849,7 @@ ProcessManager::addIntrospectionPublisherPort(const capro::ServiceDescription& s
     popo::PublisherOptions options;
     options.historyCapacity = 1U;
     options.nodeName = INTROSPECTION_NODE_NAME;
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     return m_portManager.acquireInternalPublisherPortData(service, options, m_introspectionMemoryManager);
 }
 
@@ -747,6 +909,9 @@ void ProcessManager::monitorProcesses() noexcept
 
 void ProcessManager::discoveryUpdate() noexcept
 {
+    // the discovery only requires the PortManager, the requests of the processes and the liveness monitoring which do
+    // not create or remove ports are not blocked by it
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     m_portManager.doDiscovery();
 }
 
@@ -18,9 +18,11 @@
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/popo/timer_trigger.hpp"
 #include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/detail/convert.hpp"
 #include "iox/detail/system_configuration.hpp"
 #include "iox/logging.hpp"
@@ -28,10 +30,53 @@
 #include "iox/std_string_support.hpp"
 #include "iox/thread.hpp"
 
+#include <string_view>
+
 namespace iox
 {
 namespace roudi
 {
+namespace
+{
+/// @brief the messages after which the ports of a process are connected or disconnected by the discovery
+bool isPortChangingMessage(const runtime::IpcMessageType cmd) noexcept
+{
+    switch (cmd)
+    {
+    case runtime::IpcMessageType::CREATE_PUBLISHER:
+    case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+    case runtime::IpcMessageType::CREATE_CLIENT:
+    case runtime::IpcMessageType::CREATE_SERVER:
+    case runtime::IpcMessageType::CREATE_PORTS:
+    case runtime::IpcMessageType::CREATE_INTERFACE:
+    case runtime::IpcMessageType::TERMINATION:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool isValidRuntimeName(const RuntimeName_t& runtimeName) noexcept
+{
+    if (runtimeName.empty())
+    {
+        IOX_LOG(Error, "Got message with empty runtime name!");
+        return false;
+    }
+
+    for (const auto s : platform::IOX_PATH_SEPARATORS)
+    {
+        const char separator[2]{s};
+        if (runtimeName.find(separator).has_value())
+        {
+            IOX_LOG(Error, "Got message with a runtime name with invalid characters: \"" << runtimeName << "\"!");
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
 RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
              PortManager& portManager,
              const config::RouDiConfig& roudiConfig) noexcept
@@ -40,23 +85,19 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     , m_runHandleRuntimeMessageThread(true)
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
-    , m_prcMgr(concurrent::ForwardArgsToCTor,
-               *m_roudiMemoryInterface,
-               portManager,
-               m_roudiConfig.domainId,
-               m_roudiConfig.compatibilityCheckLevel)
+    , m_prcMgr(*m_roudiMemoryInterface, portManager, m_roudiConfig.domainId, m_roudiConfig.compatibilityCheckLevel)
     , m_mempoolIntrospection(
           *m_roudiMemoryInterface->introspectionMemoryManager().value(),
           *m_roudiMemoryInterface->segmentManager().value(),
-          PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)))
+          PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionMempoolService)))
 {
     if (detail::isCompiledOn32BitSystem())
     {
         IOX_LOG(Warn, "Runnning RouDi on 32-bit architectures is experimental! Use at your own risk!");
     }
     m_processIntrospection.registerPublisherPort(
-        PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
-    m_prcMgr->initIntrospection(&m_processIntrospection);
+        PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionProcessService)));
+    m_prcMgr.initIntrospection(&m_processIntrospection);
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
 
@@ -83,6 +124,26 @@ RouDi::~RouDi() noexcept
 
 void RouDi::startProcessRuntimeMessagesThread() noexcept
 {
+    auto workerCount = m_roudiConfig.runtimeMessageWorkerCount;
+    if (workerCount == 0U || workerCount > MAX_RUNTIME_MESSAGE_WORKERS)
+    {
+        workerCount = algorithm::minVal(algorithm::maxVal(workerCount, 1U), MAX_RUNTIME_MESSAGE_WORKERS);
+        IOX_LOG(Warn,
+                "The number of runtime message workers must be in the range of [1, "
+                    << MAX_RUNTIME_MESSAGE_WORKERS << "]! Using " << workerCount << " workers.");
+    }
+
+    // with a single worker the receiving thread processes the messages itself
+    if (workerCount > 1U)
+    {
+        for (uint32_t i = 0U; i < workerCount; ++i)
+        {
+            m_runtimeMessageWorkers.emplace_back();
+            auto& worker = m_runtimeMessageWorkers.back();
+            worker.thread = std::thread(&RouDi::processRuntimeMessagesOfWorker, this, std::ref(worker));
+        }
+    }
+
     m_handleRuntimeMessageThread =
         std::thread(&RouDi::processRuntimeMessages,
                     this,
@@ -116,7 +177,7 @@ void RouDi::shutdown() noexcept
         deadline_timer terminationDelayTimer(m_roudiConfig.processTerminationDelay);
         using namespace units::duration_literals;
         auto remainingDurationForInfoPrint = m_roudiConfig.processTerminationDelay - 1_s;
-        while (!terminationDelayTimer.hasExpired() && m_prcMgr->registeredProcessCount() > 0)
+        while (!terminationDelayTimer.hasExpired() && m_prcMgr.registeredProcessCount() > 0)
         {
             if (remainingDurationForInfoPrint > terminationDelayTimer.remainingTime())
             {
@@ -128,11 +189,11 @@ void RouDi::shutdown() noexcept
             std::this_thread::sleep_for(std::chrono::milliseconds(PROCESS_TERMINATED_CHECK_INTERVAL.toMilliseconds()));
         }
 
-        m_prcMgr->requestShutdownOfAllProcesses();
+        m_prcMgr.requestShutdownOfAllProcesses();
 
         deadline_timer finalKillTimer(m_roudiConfig.processKillDelay);
         auto remainingDurationForWarnPrint = m_roudiConfig.processKillDelay - 2_s;
-        while (m_prcMgr->probeRegisteredProcessesAliveWithSigTerm() && !finalKillTimer.hasExpired())
+        while (m_prcMgr.probeRegisteredProcessesAliveWithSigTerm() && !finalKillTimer.hasExpired())
         {
             if (remainingDurationForWarnPrint > finalKillTimer.remainingTime())
             {
@@ -146,15 +207,15 @@ void RouDi::shutdown() noexcept
         }
 
         // Is any processes still alive?
-        if (m_prcMgr->probeRegisteredProcessesAliveWithSigTerm() && finalKillTimer.hasExpired())
+        if (m_prcMgr.probeRegisteredProcessesAliveWithSigTerm() && finalKillTimer.hasExpired())
         {
             // Time to kill them
-            m_prcMgr->killAllProcesses();
+            m_prcMgr.killAllProcesses();
         }
 
-        if (m_prcMgr->probeRegisteredProcessesAliveWithSigTerm())
+        if (m_prcMgr.probeRegisteredProcessesAliveWithSigTerm())
         {
-            m_prcMgr->printWarningForRegisteredProcessesAndClearProcessList();
+            m_prcMgr.printWarningForRegisteredProcessesAndClearProcessList();
         }
     }
 
@@ -167,6 +228,36 @@ void RouDi::shutdown() noexcept
         m_handleRuntimeMessageThread.join();
         IOX_LOG(Debug, "...'IPC-msg-process' thread joined.");
     }
+
+    stopRuntimeMessageWorkers();
+}
+
+void RouDi::stopRuntimeMessageWorkers() noexcept
+{
+    if (m_runtimeMessageWorkers.empty())
+    {
+        return;
+    }
+
+    for (auto& worker : m_runtimeMessageWorkers)
+    {
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.stopRequested = true;
+        }
+        worker.messageAvailable.notify_one();
+    }
+
+    IOX_LOG(Debug, "Joining 'IPC-msg-worker' threads...");
+    for (auto& worker : m_runtimeMessageWorkers)
+    {
+        if (worker.thread.joinable())
+        {
+            worker.thread.join();
+        }
+    }
+    m_runtimeMessageWorkers.clear();
+    IOX_LOG(Debug, "...'IPC-msg-worker' threads joined.");
 }
 
 void RouDi::cyclicUpdateHook() noexcept
@@ -201,8 +292,9 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
 void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     setThreadName("Mon+Discover");
+    IOX_DISCARD_RESULT(setThreadSchedulingOptions(m_roudiConfig.threadSchedulingOptions));
 
-    class DiscoveryWaitSet : public popo::WaitSet<1>
+    class DiscoveryWaitSet : public popo::WaitSet<3>
     {
       public:
         DiscoveryWaitSet(popo::ConditionVariableData& condVarData) noexcept
@@ -213,14 +305,29 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 
     popo::ConditionVariableData conditionVariableData;
     DiscoveryWaitSet discoveryLoopWaitset{conditionVariableData};
-    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach a single event");
+    popo::TimerTrigger monitoringTimer;
+    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach the discovery loop trigger");
+    discoveryLoopWaitset.attachEvent(m_portChangeTrigger).expect("Failed to attach the port change trigger");
+    discoveryLoopWaitset.attachEvent(monitoringTimer).expect("Failed to attach the monitoring timer");
+    // the timer is periodic instead of a timeout of the wait so that frequent port changes do not defer the monitoring
+    monitoringTimer.start(DISCOVERY_INTERVAL, popo::TimerTriggerMode::PERIODIC)
+        .expect("Failed to start the monitoring timer");
     bool manuallyTriggered{false};
+    bool isMonitoringDue{true};
 
     while (m_runMonitoringAndDiscoveryThread)
     {
-        m_prcMgr->run();
+        if (isMonitoringDue || manuallyTriggered)
+        {
+            m_prcMgr.run();
 
-        cyclicUpdateHook();
+            cyclicUpdateHook();
+        }
+        else
+        {
+            // a port change only requires a discovery pass; the liveness of the processes is monitored periodically
+            m_prcMgr.discoveryUpdate();
+        }
 
         if (manuallyTriggered)
         {
@@ -232,12 +339,16 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
         }
 
         manuallyTriggered = false;
-        for (const auto& notification : discoveryLoopWaitset.timedWait(DISCOVERY_INTERVAL))
+        isMonitoringDue = false;
+        for (const auto& notification : discoveryLoopWaitset.wait())
         {
             if (notification->doesOriginateFrom(&m_discoveryLoopTrigger))
             {
                 manuallyTriggered = true;
-                break;
+            }
+            else if (notification->doesOriginateFrom(&monitoringTimer))
+            {
+                isMonitoringDue = true;
             }
         }
     }
@@ -248,6 +359,7 @@ void RouDi::processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterf
     auto roudiIpc = std::move(roudiIpcInterface);
 
     setThreadName("IPC-msg-process");
+    IOX_DISCARD_RESULT(setThreadSchedulingOptions(m_roudiConfig.threadSchedulingOptions));
 
     IOX_LOG(Info, "Resource prefix: " << IOX_DEFAULT_RESOURCE_PREFIX);
     IOX_LOG(Info, "Domain ID: " << static_cast<DomainId::value_type>(m_roudiConfig.domainId));
@@ -257,14 +369,75 @@ void RouDi::processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterf
     while (m_runHandleRuntimeMessageThread)
     {
         // read RouDi's IPC channel
-        runtime::IpcMessage message;
-        if (roudiIpc.timedReceive(m_runtimeMessagesThreadTimeout, message))
+        runtime::IpcFrame frame;
+        if (roudiIpc.timedReceive(m_runtimeMessagesThreadTimeout, frame))
         {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+            if (m_runtimeMessageWorkers.empty())
+            {
+                processRuntimeMessage(frame);
+            }
+            else
+            {
+                dispatchRuntimeMessage(std::move(frame));
+            }
+        }
+    }
+}
+
+void RouDi::processRuntimeMessage(const runtime::IpcFrame& frame) noexcept
+{
+    const auto cmd = frame.getMessageType();
+    const auto runtimeName = frame.getRuntimeName();
 
-            processMessage(message, cmd, runtimeName);
+    if (frame.isBinary())
+    {
+        processBinaryMessage(frame, cmd, runtimeName);
+    }
+    else
+    {
+        processMessage(frame.toTextMessage(), cmd, runtimeName);
+    }
+
+    if (isPortChangingMessage(cmd))
+    {
+        m_portChangeTrigger.trigger();
+    }
+}
+
+void RouDi::dispatchRuntimeMessage(runtime::IpcFrame&& frame) noexcept
+{
+    const auto runtimeName = frame.getRuntimeName();
+    const auto workerIndex = std::hash<std::string_view>{}(std::string_view(runtimeName.c_str(), runtimeName.size()))
+                             % static_cast<uint64_t>(m_runtimeMessageWorkers.size());
+    auto& worker = m_runtimeMessageWorkers[workerIndex];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.messages.push(std::move(frame));
+    }
+    worker.messageAvailable.notify_one();
+}
+
+void RouDi::processRuntimeMessagesOfWorker(RuntimeMessageWorker& worker) noexcept
+{
+    setThreadName("IPC-msg-worker");
+    IOX_DISCARD_RESULT(setThreadSchedulingOptions(m_roudiConfig.threadSchedulingOptions));
+
+    while (true)
+    {
+        runtime::IpcFrame frame;
+        {
+            std::unique_lock<std::mutex> lock(worker.mutex);
+            worker.messageAvailable.wait(lock, [&worker] { return !worker.messages.empty() || worker.stopRequested; });
+            // the pending messages are processed before the worker stops in order to not lose e.g. a TERMINATION
+            if (worker.messages.empty())
+            {
+                return;
+            }
+            frame = std::move(worker.messages.front());
+            worker.messages.pop();
         }
+
+        processRuntimeMessage(frame);
     }
 }
 
@@ -290,23 +463,11 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
                            const iox::runtime::IpcMessageType& cmd,
                            const RuntimeName_t& runtimeName) noexcept
 {
-    if (runtimeName.empty())
+    if (!isValidRuntimeName(runtimeName))
     {
-        IOX_LOG(Error, "Got message with empty runtime name!");
         return;
     }
 
-
-    for (const auto s : platform::IOX_PATH_SEPARATORS)
-    {
-        const char separator[2]{s};
-        if (runtimeName.find(separator).has_value())
-        {
-            IOX_LOG(Error, "Got message with a runtime name with invalid characters: \"" << runtimeName << "\"!");
-            return;
-        }
-    }
-
     switch (cmd)
     {
     case runtime::IpcMessageType::REG:
@@ -365,8 +526,10 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addPublisherForProcess(
-                runtimeName, service, publisherOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
+            m_prcMgr
+                .addPublisherForProcess(
+                    runtimeName, service, publisherOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization))
+                .send();
         }
         break;
     }
@@ -404,8 +567,10 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addSubscriberForProcess(
-                runtimeName, service, subscriberOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
+            m_prcMgr
+                .addSubscriberForProcess(
+                    runtimeName, service, subscriberOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization))
+                .send();
         }
         break;
     }
@@ -443,7 +608,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
+            m_prcMgr.addClientForProcess(runtimeName, service, clientOptions, portConfigInfo).send();
         }
         break;
     }
@@ -481,7 +646,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
+            m_prcMgr.addServerForProcess(runtimeName, service, serverOptions, portConfigInfo).send();
         }
         break;
     }
@@ -495,7 +660,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            m_prcMgr->addConditionVariableForProcess(runtimeName);
+            m_prcMgr.addConditionVariableForProcess(runtimeName).send();
         }
         break;
     }
@@ -512,7 +677,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             capro::Interfaces commInterface =
                 StringToCaProInterface(into<lossy<capro::IdString_t>>(message.getElementAtIndex(2)));
 
-            m_prcMgr->addInterfaceForProcess(runtimeName, commInterface);
+            m_prcMgr.addInterfaceForProcess(runtimeName, commInterface).send();
         }
         break;
     }
@@ -527,7 +692,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             // this is used to unblock a potentially block application by blocking publisher
-            m_prcMgr->handleProcessShutdownPreparationRequest(runtimeName);
+            m_prcMgr.handleProcessShutdownPreparationRequest(runtimeName).send();
         }
         break;
     }
@@ -541,7 +706,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            IOX_DISCARD_RESULT(m_prcMgr->unregisterProcess(runtimeName));
+            IOX_DISCARD_RESULT(m_prcMgr.unregisterProcess(runtimeName));
         }
         break;
     }
@@ -549,10 +714,112 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
         IOX_LOG(Error, "Unknown IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]");
 
-        m_prcMgr->sendMessageNotSupportedToRuntime(runtimeName);
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName).send();
+        break;
+    }
+    }
+}
+
+void RouDi::processBinaryMessage(const runtime::IpcFrame& frame,
+                                 const iox::runtime::IpcMessageType& cmd,
+                                 const RuntimeName_t& runtimeName) noexcept
+{
+    if (!isValidRuntimeName(runtimeName))
+    {
+        return;
+    }
+
+    if (frame.getVersion() != runtime::IpcFrame::BINARY_VERSION)
+    {
+        IOX_LOG(Error,
+                "Unsupported version " << static_cast<uint32_t>(frame.getVersion())
+                                       << " of the binary IPC message encoding from \"" << runtimeName
+                                       << "\" received!");
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName).send();
+        return;
+    }
+
+    runtime::IpcFrameReader reader(frame);
+    capro::ServiceDescription service;
+    runtime::PortConfigInfo portConfigInfo;
+    const auto isComplete = [&reader] { return reader.isValid() && reader.isAtEnd(); };
+
+    switch (cmd)
+    {
+    case runtime::IpcMessageType::CREATE_PUBLISHER:
+    {
+        popo::PublisherOptions publisherOptions;
+        reader >> service >> publisherOptions >> portConfigInfo;
+        if (isComplete())
+        {
+            m_prcMgr.addPublisherForProcess(runtimeName, service, publisherOptions, portConfigInfo).send();
+            return;
+        }
         break;
     }
+    case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+    {
+        popo::SubscriberOptions subscriberOptions;
+        reader >> service >> subscriberOptions >> portConfigInfo;
+        if (isComplete())
+        {
+            m_prcMgr.addSubscriberForProcess(runtimeName, service, subscriberOptions, portConfigInfo).send();
+            return;
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_CLIENT:
+    {
+        popo::ClientOptions clientOptions;
+        reader >> service >> clientOptions >> portConfigInfo;
+        if (isComplete())
+        {
+            m_prcMgr.addClientForProcess(runtimeName, service, clientOptions, portConfigInfo).send();
+            return;
+        }
+        break;
     }
+    case runtime::IpcMessageType::CREATE_SERVER:
+    {
+        popo::ServerOptions serverOptions;
+        reader >> service >> serverOptions >> portConfigInfo;
+        if (isComplete())
+        {
+            m_prcMgr.addServerForProcess(runtimeName, service, serverOptions, portConfigInfo).send();
+            return;
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_PORTS:
+    {
+        // the whole request is parsed before any port is created in order to not create a part of the ports of a
+        // malformed request
+        runtime::PortBatch ports;
+        while (reader.isValid() && !reader.isAtEnd() && ports.size() < runtime::PortBatch::MAX_PORTS_PER_REQUEST)
+        {
+            runtime::PortBatch::Entry port;
+            reader >> port;
+            IOX_DISCARD_RESULT(ports.add(port));
+        }
+        if (isComplete() && !ports.empty())
+        {
+            m_prcMgr.addPortsForProcess(runtimeName, ports).send();
+            return;
+        }
+        break;
+    }
+    default:
+    {
+        IOX_LOG(Error, "Unknown binary IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]");
+
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName).send();
+        return;
+    }
+    }
+
+    IOX_LOG(Error,
+            "Malformed binary IPC message [" << runtime::IpcMessageTypeToString(cmd) << "] from \"" << runtimeName
+                                             << "\" received!");
 }
 
 void RouDi::registerProcess(const RuntimeName_t& name,
@@ -564,14 +831,15 @@ void RouDi::registerProcess(const RuntimeName_t& name,
 {
     bool monitorProcess = (m_roudiConfig.monitoringMode == roudi::MonitoringMode::ON
                            && !m_roudiConfig.sharesAddressSpaceWithApplications);
-    IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+    m_prcMgr.registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo)
+        .and_then([](auto& reply) { reply.send(); });
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
-    return ++sessionId;
+    // the runtime messages might be processed concurrently by multiple workers
+    static concurrent::Atomic<uint64_t> sessionId{0U};
+    return sessionId.fetch_add(1U, std::memory_order_relaxed) + 1U;
 }
 
 void RouDi::IpcMessageErrorHandler() noexcept
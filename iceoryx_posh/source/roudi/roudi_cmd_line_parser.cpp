@@ -39,10 +39,12 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"termination-delay", required_argument, nullptr, 't'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"memory-residency", required_argument, nullptr, 'r'},
+                                       {"runtime-message-workers", required_argument, nullptr, 'w'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:r:w:";
     int index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -92,6 +94,17 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             std::cout << "                                  SIGKILL to application which did not respond" << std::endl;
             std::cout << "                                  to the initial SIGTERM signal." << std::endl;
             std::cout << "                                  default = '45'" << std::endl;
+            std::cout << "-r, --memory-residency <MODE>     Make the shared memory segments resident at" << std::endl;
+            std::cout << "                                  startup to avoid page faults on first access." << std::endl;
+            std::cout << "                                  <MODE> {off, prefault, lock}" << std::endl;
+            std::cout << "                                  default = 'off'" << std::endl;
+            std::cout << "                                  prefault: touch every page of the segments" << std::endl;
+            std::cout << "                                  lock: prefault and lock the pages in RAM" << std::endl;
+            std::cout << "-w, --runtime-message-workers <UINT>" << std::endl;
+            std::cout << "                                  Sets the number of threads which process the" << std::endl;
+            std::cout << "                                  requests of the applications concurrently." << std::endl;
+            std::cout << "                                  <UINT> 1..16" << std::endl;
+            std::cout << "                                  default = '1'" << std::endl;
 
             m_cmdLineArgs.run = false;
             break;
@@ -220,6 +233,42 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             m_cmdLineArgs.roudiConfig.processKillDelay = units::Duration::fromSeconds(maybeValue.value());
             break;
         }
+        case 'r':
+        {
+            if (strcmp(optarg, "off") == 0)
+            {
+                m_cmdLineArgs.roudiConfig.memoryResidency = roudi::MemoryResidency::OFF;
+            }
+            else if (strcmp(optarg, "prefault") == 0)
+            {
+                m_cmdLineArgs.roudiConfig.memoryResidency = roudi::MemoryResidency::PREFAULT;
+            }
+            else if (strcmp(optarg, "lock") == 0)
+            {
+                m_cmdLineArgs.roudiConfig.memoryResidency = roudi::MemoryResidency::PREFAULT_AND_LOCK;
+            }
+            else
+            {
+                IOX_LOG(Error, "Options for memory-residency are 'off', 'prefault' and 'lock'!");
+                return err(CmdLineParserResult::INVALID_PARAMETER);
+            }
+            break;
+        }
+        case 'w':
+        {
+            auto maybeValue = convert::from_string<uint32_t>(optarg);
+            if (!maybeValue.has_value() || maybeValue.value() == 0U
+                || maybeValue.value() > roudi::MAX_RUNTIME_MESSAGE_WORKERS)
+            {
+                IOX_LOG(Error,
+                        "The number of runtime message workers must be in the range of [1, "
+                            << roudi::MAX_RUNTIME_MESSAGE_WORKERS << "]");
+                return err(CmdLineParserResult::INVALID_PARAMETER);
+            }
+
+            m_cmdLineArgs.roudiConfig.runtimeMessageWorkerCount = maybeValue.value();
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
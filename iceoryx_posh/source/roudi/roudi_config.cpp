@@ -16,10 +16,23 @@
 
 #include "iceoryx_posh/roudi/roudi_config.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace config
 {
+PortPoolCapacity& PortPoolCapacity::clamp() noexcept
+{
+    publishers = std::min(std::max(publishers, NUMBER_OF_INTERNAL_PUBLISHERS), MAX_PUBLISHERS);
+    subscribers = std::min(subscribers, MAX_SUBSCRIBERS);
+    servers = std::min(servers, MAX_SERVERS);
+    clients = std::min(clients, MAX_CLIENTS);
+    interfaces = std::min(interfaces, MAX_INTERFACE_NUMBER);
+    conditionVariables = std::min(conditionVariables, MAX_NUMBER_OF_CONDITION_VARIABLES);
+    return *this;
+}
+
 RouDiConfig& RouDiConfig::setDefaults() noexcept
 {
     *this = RouDiConfig();
@@ -19,6 +19,7 @@
 #include "iceoryx_posh/roudi/roudi_config_toml_file_provider.hpp"
 #include "iceoryx_platform/getopt.hpp"
 #include "iceoryx_platform/platform_settings.hpp"
+#include "iox/detail/posix_scheduler.hpp"
 #include "iox/file_reader.hpp"
 #include "iox/into.hpp"
 #include "iox/logging.hpp"
@@ -36,6 +37,125 @@ namespace iox
 {
 namespace config
 {
+namespace
+{
+/// @brief the 'numa-node' key is either the number of a NUMA node or "interleave"; a missing key results in the
+/// default placement of the operating system
+iox::expected<NumaPlacement, iox::roudi::RouDiConfigFileParseError>
+parseNumaPlacement(const cpptoml::table& table) noexcept
+{
+    if (!table.contains("numa-node"))
+    {
+        return iox::ok(NumaPlacement());
+    }
+
+    auto node = table.get_as<int64_t>("numa-node");
+    if (node && *node >= 0 && *node <= std::numeric_limits<uint32_t>::max())
+    {
+        return iox::ok(NumaPlacement::bindToNode(static_cast<uint32_t>(*node)));
+    }
+
+    auto policy = table.get_as<std::string>("numa-node");
+    if (policy && *policy == "interleave")
+    {
+        return iox::ok(NumaPlacement::interleave());
+    }
+
+    return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODE);
+}
+
+/// @brief the optional 'threads' table contains the CPUs the RouDi threads are pinned to and the priority with which
+/// they run under the FIFO scheduler; missing keys keep the settings RouDi inherits from its parent process
+iox::expected<ThreadSchedulingOptions, iox::roudi::RouDiConfigFileParseError>
+parseThreadSchedulingOptions(const cpptoml::table& root) noexcept
+{
+    ThreadSchedulingOptions options;
+    auto threads = root.get_table("threads");
+    if (!threads)
+    {
+        return iox::ok(options);
+    }
+
+    if (threads->contains("cpu-affinity"))
+    {
+        constexpr int64_t NUMBER_OF_ADDRESSABLE_CPUS{64};
+        auto cpus = threads->get_array_of<int64_t>("cpu-affinity");
+        if (!cpus || cpus->empty())
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_CPU_AFFINITY);
+        }
+        for (const auto cpu : *cpus)
+        {
+            if (cpu < 0 || cpu >= NUMBER_OF_ADDRESSABLE_CPUS)
+            {
+                return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_CPU_AFFINITY);
+            }
+            options.cpuAffinityMask |= uint64_t{1U} << static_cast<uint64_t>(cpu);
+        }
+    }
+
+    if (threads->contains("fifo-priority"))
+    {
+        auto priority = threads->get_as<int64_t>("fifo-priority");
+        if (!priority || *priority < iox::detail::getSchedulerPriorityMinimum(iox::detail::Scheduler::FIFO)
+            || *priority > iox::detail::getSchedulerPriorityMaximum(iox::detail::Scheduler::FIFO))
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_FIFO_PRIORITY);
+        }
+        options.fifoPriority = static_cast<int32_t>(*priority);
+    }
+
+    return iox::ok(options);
+}
+
+/// @brief the optional 'port-pool' table contains the number of ports of each kind RouDi reserves memory for; missing
+/// keys keep the compile time maxima
+iox::expected<PortPoolCapacity, iox::roudi::RouDiConfigFileParseError>
+parsePortPoolCapacity(const cpptoml::table& root) noexcept
+{
+    PortPoolCapacity capacity;
+    auto portPool = root.get_table("port-pool");
+    if (!portPool)
+    {
+        return iox::ok(capacity);
+    }
+
+    struct Entry
+    {
+        const char* key;
+        uint32_t& value;
+        uint32_t minimum;
+        uint32_t maximum;
+    };
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    Entry entries[] = {{"publishers", capacity.publishers, NUMBER_OF_INTERNAL_PUBLISHERS, MAX_PUBLISHERS},
+                       {"subscribers", capacity.subscribers, 0U, MAX_SUBSCRIBERS},
+                       {"servers", capacity.servers, 0U, MAX_SERVERS},
+                       {"clients", capacity.clients, 0U, MAX_CLIENTS},
+                       {"interfaces", capacity.interfaces, 0U, MAX_INTERFACE_NUMBER},
+                       {"condition-variables", capacity.conditionVariables, 0U, MAX_NUMBER_OF_CONDITION_VARIABLES}};
+
+    for (auto& entry : entries)
+    {
+        if (!portPool->contains(entry.key))
+        {
+            continue;
+        }
+        auto value = portPool->get_as<int64_t>(entry.key);
+        if (!value || *value < entry.minimum || *value > entry.maximum)
+        {
+            IOX_LOG(Error,
+                    "The port pool capacity '" << entry.key << "' must be in the range [" << entry.minimum << ", "
+                                               << entry.maximum << "]");
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_PORT_POOL_CAPACITY);
+        }
+        entry.value = static_cast<uint32_t>(*value);
+    }
+
+    return iox::ok(capacity);
+}
+} // namespace
+
 TomlRouDiConfigFileProvider::TomlRouDiConfigFileProvider(config::CmdLineArgs_t& cmdLineArgs) noexcept
 {
     /// don't print additional output if not running
@@ -95,7 +215,12 @@ iox::expected<iox::IceoryxConfig, iox::roudi::RouDiConfigFileParseError> TomlRou
     }
 
     return TomlRouDiConfigFileProvider::parse(fileStream).and_then([this](auto& config) {
+        // the thread settings and the port pool capacity can only be provided by the config file
+        const auto threadSchedulingOptions = config.threadSchedulingOptions;
+        const auto portPoolCapacity = config.portPoolCapacity;
         static_cast<RouDiConfig&>(config) = m_roudiConfig;
+        config.threadSchedulingOptions = threadSchedulingOptions;
+        config.portPoolCapacity = portPoolCapacity;
     });
 }
 
@@ -141,13 +266,41 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
         return iox::err(iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_SEGMENTS_EXCEEDED);
     }
 
+    auto threadSchedulingOptions = parseThreadSchedulingOptions(*parsedFile);
+    if (threadSchedulingOptions.has_error())
+    {
+        return iox::err(threadSchedulingOptions.error());
+    }
+
+    auto portPoolCapacity = parsePortPoolCapacity(*parsedFile);
+    if (portPoolCapacity.has_error())
+    {
+        return iox::err(portPoolCapacity.error());
+    }
+
     auto groupOfCurrentProcess = PosixGroup::getGroupOfCurrentProcess().getName();
     iox::IceoryxConfig parsedConfig;
+    parsedConfig.threadSchedulingOptions = threadSchedulingOptions.value();
+    parsedConfig.portPoolCapacity = portPoolCapacity.value();
     for (auto segment : *segments)
     {
         auto writer = segment->get_as<std::string>("writer").value_or(into<std::string>(groupOfCurrentProcess));
         auto reader = segment->get_as<std::string>("reader").value_or(into<std::string>(groupOfCurrentProcess));
+        auto useHugePages = segment->get_as<bool>("huge-pages").value_or(false);
+        auto segmentNumaPlacement = parseNumaPlacement(*segment);
+        if (segmentNumaPlacement.has_error())
+        {
+            return iox::err(segmentNumaPlacement.error());
+        }
         iox::mepoo::MePooConfig mempoolConfig;
+        if (segment->get_as<bool>("fallback-to-larger-mempool").value_or(false))
+        {
+            mempoolConfig.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL;
+        }
+        if (segment->get_as<bool>("embedded-chunk-management").value_or(false))
+        {
+            mempoolConfig.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::EMBEDDED;
+        }
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -171,12 +324,25 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
             {
                 return iox::err(iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT);
             }
-            mempoolConfig.addMemPool({*chunkSize, *chunkCount});
+            auto threadCacheCapacity = mempool->get_as<uint32_t>("thread-cache").value_or(0U);
+            if (threadCacheCapacity > iox::MAX_MEMPOOL_THREAD_CACHE_CAPACITY)
+            {
+                return iox::err(iox::roudi::RouDiConfigFileParseError::MEMPOOL_THREAD_CACHE_CAPACITY_EXCEEDED);
+            }
+            auto mempoolNumaPlacement = parseNumaPlacement(*mempool);
+            if (mempoolNumaPlacement.has_error())
+            {
+                return iox::err(mempoolNumaPlacement.error());
+            }
+            mempoolConfig.addMemPool({*chunkSize, *chunkCount, threadCacheCapacity, *mempoolNumaPlacement});
         }
         parsedConfig.m_sharedMemorySegments.push_back(
             {PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
              PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size()),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             useHugePages,
+             *segmentNumaPlacement});
     }
 
     return iox::ok(parsedConfig);
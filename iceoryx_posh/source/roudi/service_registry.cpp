@@ -16,6 +16,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/algorithm.hpp"
+
+#include <algorithm>
 
 namespace iox
 {
@@ -26,6 +29,14 @@ ServiceRegistry::ServiceDescriptionEntry::ServiceDescriptionEntry(const capro::S
 {
 }
 
+ServiceRegistry::ServiceRegistry() noexcept
+{
+    for (auto& bucketHeadsOfKey : m_bucketHeads)
+    {
+        std::fill(std::begin(bucketHeadsOfKey), std::end(bucketHeadsOfKey), NO_INDEX);
+    }
+}
+
 expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescription& serviceDescription,
                                                             ReferenceCounter_t ServiceDescriptionEntry::*count)
 {
@@ -41,43 +52,28 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
         return ok();
     }
 
-    // entry does not exist, find a free slot if it exists
-
-    // fast path to a free slot (which was occupied by previously removed entry),
-    // prefer to fill entries close to the front
+    // entry does not exist, reuse a free slot which was occupied by a previously removed entry if it exists
     if (m_freeIndex != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
-        m_freeIndex = NO_INDEX;
-        return ok();
+        index = m_freeIndex;
+        m_freeIndex = m_links[static_cast<uint32_t>(Key::FULL)][index].next;
     }
-
-    // search from start
-    for (auto& entry : m_serviceDescriptions)
+    // append new entry at the end (the size only grows up to capacity)
+    else if (m_serviceDescriptions.emplace_back())
     {
-        if (!entry)
-        {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            m_dataChanged = true;
-            return ok();
-        }
+        index = static_cast<uint32_t>(m_serviceDescriptions.size() - 1U);
     }
-
-    // append new entry at the end (the size only grows up to capacity)
-    if (m_serviceDescriptions.emplace_back())
+    else
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
-        return ok();
+        return err(Error::SERVICE_REGISTRY_FULL);
     }
 
-    return err(Error::SERVICE_REGISTRY_FULL);
+    auto& entry = m_serviceDescriptions[index];
+    entry.emplace(serviceDescription);
+    (*entry).*count = 1U;
+    insertIntoHashTables(index);
+    m_dataChanged = true;
+    return ok();
 }
 
 expected<void, ServiceRegistry::Error>
@@ -103,10 +99,7 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
         {
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                removeEntry(index);
             }
         }
     }
@@ -123,10 +116,7 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
         {
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                removeEntry(index);
             }
         }
     }
@@ -137,11 +127,7 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
-        m_dataChanged = true;
+        removeEntry(index);
     }
 }
 
@@ -150,30 +136,69 @@ void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    if (!service && !instance && !event)
     {
-        if (entry)
-        {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+        forEach(callable);
+        return;
+    }
 
-            if (match)
-            {
-                callable(*entry);
-            }
+    // the chain of the most specific key contains all matches; it is only longer than the number of matches when
+    // different strings share a bucket
+    Key key{Key::EVENT};
+    uint64_t hash{0U};
+    if (service && instance && event)
+    {
+        key = Key::FULL;
+        hash = hashOfIds(*service, *instance, *event);
+    }
+    else if (service)
+    {
+        key = Key::SERVICE;
+        hash = hashOfId(*service);
+    }
+    else if (instance)
+    {
+        key = Key::INSTANCE;
+        hash = hashOfId(*instance);
+    }
+    else
+    {
+        hash = hashOfId(*event);
+    }
+
+    const auto keyIndex = static_cast<uint32_t>(key);
+    vector<uint32_t, CAPACITY> matches;
+    for (auto index = m_bucketHeads[keyIndex][toBucket(hash)]; index != NO_INDEX;
+         index = m_links[keyIndex][index].next)
+    {
+        const auto& entry = m_serviceDescriptions[index];
+        bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+
+        if (match)
+        {
+            matches.emplace_back(index);
         }
     }
+
+    // the chains are ordered by insertion, the callable is applied in the order of the entries
+    std::sort(matches.begin(), matches.end());
+    for (const auto index : matches)
+    {
+        callable(*m_serviceDescriptions[index]);
+    }
 }
 
 uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    const auto keyIndex = static_cast<uint32_t>(Key::FULL);
+    for (auto index = m_bucketHeads[keyIndex][toBucket(hashOf(Key::FULL, serviceDescription))]; index != NO_INDEX;
+         index = m_links[keyIndex][index].next)
     {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
+        if (m_serviceDescriptions[index]->serviceDescription == serviceDescription)
         {
-            return i;
+            return index;
         }
     }
     return NO_INDEX;
@@ -197,5 +222,76 @@ bool ServiceRegistry::hasDataChangedSinceLastCall() noexcept
     return dataChanged;
 }
 
+uint64_t ServiceRegistry::hashOf(const Key key, const capro::ServiceDescription& serviceDescription) noexcept
+{
+    switch (key)
+    {
+    case Key::FULL:
+        return hashOfServiceDescription(serviceDescription);
+    case Key::SERVICE:
+        return hashOfId(serviceDescription.getServiceIDString());
+    case Key::INSTANCE:
+        return hashOfId(serviceDescription.getInstanceIDString());
+    case Key::EVENT:
+        return hashOfId(serviceDescription.getEventIDString());
+    }
+    return 0U;
+}
+
+uint32_t ServiceRegistry::toBucket(const uint64_t hash) noexcept
+{
+    static_assert(isPowerOfTwo(NUMBER_OF_BUCKETS), "the number of buckets must be a power of two");
+    return static_cast<uint32_t>(hash & (NUMBER_OF_BUCKETS - 1U));
+}
+
+void ServiceRegistry::insertIntoHashTables(const uint32_t index) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    for (uint32_t keyIndex = 0U; keyIndex < NUMBER_OF_KEYS; ++keyIndex)
+    {
+        auto& head = m_bucketHeads[keyIndex][toBucket(hashOf(static_cast<Key>(keyIndex), serviceDescription))];
+        m_links[keyIndex][index] = Link{NO_INDEX, head};
+        if (head != NO_INDEX)
+        {
+            m_links[keyIndex][head].previous = index;
+        }
+        head = index;
+    }
+}
+
+void ServiceRegistry::removeFromHashTables(const uint32_t index) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    for (uint32_t keyIndex = 0U; keyIndex < NUMBER_OF_KEYS; ++keyIndex)
+    {
+        const auto link = m_links[keyIndex][index];
+        if (link.previous != NO_INDEX)
+        {
+            m_links[keyIndex][link.previous].next = link.next;
+        }
+        else
+        {
+            m_bucketHeads[keyIndex][toBucket(hashOf(static_cast<Key>(keyIndex), serviceDescription))] = link.next;
+        }
+
+        if (link.next != NO_INDEX)
+        {
+            m_links[keyIndex][link.next].previous = link.previous;
+        }
+        m_links[keyIndex][index] = Link{};
+    }
+}
+
+void ServiceRegistry::removeEntry(const uint32_t index) noexcept
+{
+    removeFromHashTables(index);
+    m_serviceDescriptions[index].reset();
+
+    // reuse the slot in the next insertion
+    m_links[static_cast<uint32_t>(Key::FULL)][index].next = m_freeIndex;
+    m_freeIndex = index;
+    m_dataChanged = true;
+}
+
 } // namespace roudi
 } // namespace iox
@@ -0,0 +1,404 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_frame.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace runtime
+{
+namespace
+{
+// NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) char array is required for string::find
+constexpr const char TEXT_SEPARATOR[]{","};
+
+constexpr uint64_t NUMBER_OF_CONSUMER_TOO_SLOW_POLICIES{
+    static_cast<uint64_t>(popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA) + 1U};
+constexpr uint64_t NUMBER_OF_QUEUE_FULL_POLICIES{static_cast<uint64_t>(popo::QueueFullPolicy::DISCARD_OLDEST_DATA) + 1U};
+constexpr uint64_t NUMBER_OF_PORT_KINDS{static_cast<uint64_t>(PortKind::SERVER) + 1U};
+
+using MessageTypeUnderlying_t = std::underlying_type_t<IpcMessageType>;
+} // namespace
+
+IpcFrame::IpcFrame(const IpcMessageType type, const RuntimeName_t& runtimeName) noexcept
+{
+    *this << BINARY_MARKER << BINARY_VERSION << static_cast<MessageTypeUnderlying_t>(type) << runtimeName;
+}
+
+IpcFrame& IpcFrame::operator<<(const capro::ServiceDescription& value) noexcept
+{
+    const auto classHash = value.getClassHash();
+    *this << value.getServiceIDString() << value.getInstanceIDString() << value.getEventIDString();
+    for (uint64_t i = 0U; i < capro::CLASS_HASH_ELEMENT_COUNT; ++i)
+    {
+        *this << classHash[i];
+    }
+    return *this << static_cast<std::underlying_type_t<capro::Scope>>(value.getScope())
+                 << static_cast<std::underlying_type_t<capro::Interfaces>>(value.getSourceInterface());
+}
+
+IpcFrame& IpcFrame::operator<<(const popo::PublisherOptions& value) noexcept
+{
+    *this << value.historyCapacity;
+    appendNodeName(value.nodeName);
+    return *this << value.offerOnCreate
+                 << static_cast<std::underlying_type_t<popo::ConsumerTooSlowPolicy>>(value.subscriberTooSlowPolicy);
+}
+
+IpcFrame& IpcFrame::operator<<(const popo::SubscriberOptions& value) noexcept
+{
+    *this << value.queueCapacity << value.historyRequest;
+    appendNodeName(value.nodeName);
+    return *this << value.subscribeOnCreate
+                 << static_cast<std::underlying_type_t<popo::QueueFullPolicy>>(value.queueFullPolicy)
+                 << value.requiresPublisherHistorySupport;
+}
+
+IpcFrame& IpcFrame::operator<<(const popo::ClientOptions& value) noexcept
+{
+    *this << value.responseQueueCapacity;
+    appendNodeName(value.nodeName);
+    return *this << value.connectOnCreate
+                 << static_cast<std::underlying_type_t<popo::QueueFullPolicy>>(value.responseQueueFullPolicy)
+                 << static_cast<std::underlying_type_t<popo::ConsumerTooSlowPolicy>>(value.serverTooSlowPolicy);
+}
+
+IpcFrame& IpcFrame::operator<<(const popo::ServerOptions& value) noexcept
+{
+    *this << value.requestQueueCapacity;
+    appendNodeName(value.nodeName);
+    return *this << value.offerOnCreate
+                 << static_cast<std::underlying_type_t<popo::QueueFullPolicy>>(value.requestQueueFullPolicy)
+                 << static_cast<std::underlying_type_t<popo::ConsumerTooSlowPolicy>>(value.clientTooSlowPolicy);
+}
+
+IpcFrame& IpcFrame::operator<<(const PortConfigInfo& value) noexcept
+{
+    return *this << value.portType << value.memoryInfo.deviceId << value.memoryInfo.memoryType;
+}
+
+IpcFrame& IpcFrame::operator<<(const PortBatch::Entry& value) noexcept
+{
+    *this << static_cast<std::underlying_type_t<PortKind>>(value.kind()) << value.service;
+    switch (value.kind())
+    {
+    case PortKind::PUBLISHER:
+        *this << *value.options.get<popo::PublisherOptions>();
+        break;
+    case PortKind::SUBSCRIBER:
+        *this << *value.options.get<popo::SubscriberOptions>();
+        break;
+    case PortKind::CLIENT:
+        *this << *value.options.get<popo::ClientOptions>();
+        break;
+    case PortKind::SERVER:
+        *this << *value.options.get<popo::ServerOptions>();
+        break;
+    }
+    return *this << value.portConfigInfo;
+}
+
+void IpcFrame::appendNodeName(const NodeName_t& nodeName) noexcept
+{
+    // node names are also sent in text messages, e.g. with CREATE_INTERFACE; to have the same naming rules for all
+    // requests, they must not contain the separator in the binary encoding either
+    if (nodeName.find(TEXT_SEPARATOR).has_value())
+    {
+        IOX_LOG(Error, "The node name '" << nodeName << "' must not contain the separator '" << TEXT_SEPARATOR << "'");
+        m_isValid = false;
+        return;
+    }
+    *this << nodeName;
+}
+
+void IpcFrame::append(const void* const data, const uint64_t size) noexcept
+{
+    if (!m_isValid || size > CAPACITY - m_buffer.size())
+    {
+        m_isValid = false;
+        return;
+    }
+
+    m_buffer.unsafe_raw_access([&](char* str, const BufferInfo info) -> uint64_t {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the capacity was checked above
+        std::memcpy(&str[info.used_size], data, size);
+        const uint64_t newSize = info.used_size + size;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the string has room for the terminator
+        str[newSize] = '\0';
+        return newSize;
+    });
+}
+
+bool IpcFrame::isValid() const noexcept
+{
+    if (isBinary())
+    {
+        return m_isValid;
+    }
+
+    // same rule as for the IpcMessage, a non-empty text message must end with the separator
+    return m_isValid && (m_buffer.empty() || m_buffer[m_buffer.size() - 1U] == TEXT_SEPARATOR[0]);
+}
+
+bool IpcFrame::isBinary() const noexcept
+{
+    return !m_buffer.empty() && static_cast<uint8_t>(m_buffer[0U]) == BINARY_MARKER;
+}
+
+uint64_t IpcFrame::readHeader(uint8_t& version, IpcMessageType& type, RuntimeName_t& runtimeName) const noexcept
+{
+    // the reader does not check the version in its c'tor when the reading position is set explicitly
+    IpcFrameReader reader(*this, 0U);
+    uint8_t marker{0U};
+    MessageTypeUnderlying_t messageType{0};
+    reader >> marker >> version >> messageType >> runtimeName;
+
+    if (!reader.isValid() || marker != BINARY_MARKER)
+    {
+        return 0U;
+    }
+
+    type = (messageType <= static_cast<MessageTypeUnderlying_t>(IpcMessageType::BEGIN)
+            || messageType >= static_cast<MessageTypeUnderlying_t>(IpcMessageType::END))
+               ? IpcMessageType::NOTYPE
+               : static_cast<IpcMessageType>(messageType);
+    return reader.m_position;
+}
+
+uint8_t IpcFrame::getVersion() const noexcept
+{
+    uint8_t version{0U};
+    IpcMessageType type{IpcMessageType::NOTYPE};
+    RuntimeName_t runtimeName;
+    IOX_DISCARD_RESULT(readHeader(version, type, runtimeName));
+    return version;
+}
+
+IpcMessageType IpcFrame::getMessageType() const noexcept
+{
+    if (isBinary())
+    {
+        uint8_t version{0U};
+        IpcMessageType type{IpcMessageType::NOTYPE};
+        RuntimeName_t runtimeName;
+        IOX_DISCARD_RESULT(readHeader(version, type, runtimeName));
+        return type;
+    }
+
+    const auto separator = m_buffer.find(TEXT_SEPARATOR);
+    if (!separator.has_value())
+    {
+        return IpcMessageType::NOTYPE;
+    }
+    return stringToIpcMessageType(m_buffer.substr(0U, separator.value())->c_str());
+}
+
+RuntimeName_t IpcFrame::getRuntimeName() const noexcept
+{
+    RuntimeName_t runtimeName;
+    if (isBinary())
+    {
+        uint8_t version{0U};
+        IpcMessageType type{IpcMessageType::NOTYPE};
+        IOX_DISCARD_RESULT(readHeader(version, type, runtimeName));
+        return runtimeName;
+    }
+
+    // the runtime name is the second element of a text message
+    const auto begin = m_buffer.find(TEXT_SEPARATOR);
+    if (!begin.has_value())
+    {
+        return runtimeName;
+    }
+    const auto end = m_buffer.find(TEXT_SEPARATOR, begin.value() + 1U);
+    if (!end.has_value())
+    {
+        return runtimeName;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the position was found in the string
+    return RuntimeName_t(TruncateToCapacity, &m_buffer.c_str()[begin.value() + 1U], end.value() - begin.value() - 1U);
+}
+
+IpcMessage IpcFrame::toTextMessage() const noexcept
+{
+    return IpcMessage(std::string(m_buffer.c_str(), m_buffer.size()));
+}
+
+uint64_t IpcFrame::size() const noexcept
+{
+    return m_buffer.size();
+}
+
+IpcFrameReader::IpcFrameReader(const IpcFrame& frame) noexcept
+    : m_frame(&frame)
+{
+    uint8_t version{0U};
+    IpcMessageType type{IpcMessageType::NOTYPE};
+    RuntimeName_t runtimeName;
+    m_position = frame.readHeader(version, type, runtimeName);
+    m_isValid = m_position != 0U && version == IpcFrame::BINARY_VERSION;
+}
+
+IpcFrameReader::IpcFrameReader(const IpcFrame& frame, const uint64_t position) noexcept
+    : m_frame(&frame)
+    , m_position(position)
+{
+}
+
+IpcFrameReader& IpcFrameReader::operator>>(bool& value) noexcept
+{
+    uint8_t rawValue{0U};
+    *this >> rawValue;
+    if (rawValue > 1U)
+    {
+        m_isValid = false;
+    }
+    value = rawValue == 1U;
+    return *this;
+}
+
+IpcFrameReader& IpcFrameReader::operator>>(capro::ServiceDescription& value) noexcept
+{
+    capro::IdString_t service;
+    capro::IdString_t instance;
+    capro::IdString_t event;
+    capro::ServiceDescription::ClassHash classHash;
+    capro::Scope scope{capro::Scope::WORLDWIDE};
+    capro::Interfaces sourceInterface{capro::Interfaces::INTERNAL};
+
+    *this >> service >> instance >> event;
+    for (uint64_t i = 0U; i < capro::CLASS_HASH_ELEMENT_COUNT; ++i)
+    {
+        *this >> classHash[i];
+    }
+    extractEnum(scope, static_cast<uint64_t>(capro::Scope::INVALID));
+    extractEnum(sourceInterface, static_cast<uint64_t>(capro::Interfaces::INTERFACE_END));
+
+    if (m_isValid)
+    {
+        value = capro::ServiceDescription(service, instance, event, classHash, sourceInterface);
+        if (scope == capro::Scope::LOCAL)
+        {
+            value.setLocal();
+        }
+    }
+    return *this;
+}
+
+IpcFrameReader& IpcFrameReader::operator>>(popo::PublisherOptions& value) noexcept
+{
+    *this >> value.historyCapacity >> value.nodeName >> value.offerOnCreate;
+    extractEnum(value.subscriberTooSlowPolicy, NUMBER_OF_CONSUMER_TOO_SLOW_POLICIES);
+    return *this;
+}
+
+IpcFrameReader& IpcFrameReader::operator>>(popo::SubscriberOptions& value) noexcept
+{
+    *this >> value.queueCapacity >> value.historyRequest >> value.nodeName >> value.subscribeOnCreate;
+    extractEnum(value.queueFullPolicy, NUMBER_OF_QUEUE_FULL_POLICIES);
+    return *this >> value.requiresPublisherHistorySupport;
+}
+
+IpcFrameReader& IpcFrameReader::operator>>(popo::ClientOptions& value) noexcept
+{
+    *this >> value.responseQueueCapacity >> value.nodeName >> value.connectOnCreate;
+    extractEnum(value.responseQueueFullPolicy, NUMBER_OF_QUEUE_FULL_POLICIES);
+    extractEnum(value.serverTooSlowPolicy, NUMBER_OF_CONSUMER_TOO_SLOW_POLICIES);
+    return *this;
+}
+
+IpcFrameReader& IpcFrameReader::operator>>(popo::ServerOptions& value) noexcept
+{
+    *this >> value.requestQueueCapacity >> value.nodeName >> value.offerOnCreate;
+    extractEnum(value.requestQueueFullPolicy, NUMBER_OF_QUEUE_FULL_POLICIES);
+    extractEnum(value.clientTooSlowPolicy, NUMBER_OF_CONSUMER_TOO_SLOW_POLICIES);
+    return *this;
+}
+
+IpcFrameReader& IpcFrameReader::operator>>(PortConfigInfo& value) noexcept
+{
+    return *this >> value.portType >> value.memoryInfo.deviceId >> value.memoryInfo.memoryType;
+}
+
+IpcFrameReader& IpcFrameReader::operator>>(PortBatch::Entry& value) noexcept
+{
+    PortKind kind{PortKind::PUBLISHER};
+    extractEnum(kind, NUMBER_OF_PORT_KINDS);
+    *this >> value.service;
+    if (!m_isValid)
+    {
+        return *this;
+    }
+
+    switch (kind)
+    {
+    case PortKind::PUBLISHER:
+        value.options.emplace<popo::PublisherOptions>();
+        *this >> *value.options.get<popo::PublisherOptions>();
+        break;
+    case PortKind::SUBSCRIBER:
+        value.options.emplace<popo::SubscriberOptions>();
+        *this >> *value.options.get<popo::SubscriberOptions>();
+        break;
+    case PortKind::CLIENT:
+        value.options.emplace<popo::ClientOptions>();
+        *this >> *value.options.get<popo::ClientOptions>();
+        break;
+    case PortKind::SERVER:
+        value.options.emplace<popo::ServerOptions>();
+        *this >> *value.options.get<popo::ServerOptions>();
+        break;
+    }
+    return *this >> value.portConfigInfo;
+}
+
+bool IpcFrameReader::isValid() const noexcept
+{
+    return m_isValid;
+}
+
+bool IpcFrameReader::isAtEnd() const noexcept
+{
+    return m_position == m_frame->size();
+}
+
+const char* IpcFrameReader::consume(const uint64_t size) noexcept
+{
+    if (!m_isValid || size > m_frame->size() - m_position)
+    {
+        m_isValid = false;
+        return nullptr;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the size was checked above
+    const char* const data = &m_frame->m_buffer.c_str()[m_position];
+    m_position += size;
+    return data;
+}
+
+void IpcFrameReader::extract(void* const data, const uint64_t size) noexcept
+{
+    const char* const source = consume(size);
+    if (source != nullptr)
+    {
+        std::memcpy(data, source, size);
+    }
+}
+
+} // namespace runtime
+} // namespace iox
@@ -17,6 +17,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_frame.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iox/detail/convert.hpp"
 #include "iox/logging.hpp"
@@ -108,12 +109,11 @@ IpcInterface<IpcChannelType>::IpcInterface(const RuntimeName_t& runtimeName,
     m_runtimeName = runtimeName;
     m_maxMessages = maxMessages;
     m_maxMessageSize = messageSize;
-    if (m_maxMessageSize > platform::IoxIpcChannelType::MAX_MESSAGE_SIZE)
+    if (m_maxMessageSize > IpcChannelType::MAX_MESSAGE_SIZE)
     {
         IOX_LOG(Warn,
-                "Message size too large, reducing from " << messageSize << " to "
-                                                         << platform::IoxIpcChannelType::MAX_MESSAGE_SIZE);
-        m_maxMessageSize = platform::IoxIpcChannelType::MAX_MESSAGE_SIZE;
+                "Message size too large, reducing from " << messageSize << " to " << IpcChannelType::MAX_MESSAGE_SIZE);
+        m_maxMessageSize = IpcChannelType::MAX_MESSAGE_SIZE;
     }
 }
 
@@ -154,6 +154,39 @@ bool IpcInterface<IpcChannelType>::timedReceive(const units::Duration timeout, I
            && answer.isValid();
 }
 
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::timedReceive(const units::Duration timeout, IpcFrame& frame) const noexcept
+{
+    if (!m_ipcChannel.has_value())
+    {
+        IOX_LOG(Warn,
+                "Trying to receive data on an non-initialized IPC interface! Interface name: " << m_interfaceName);
+        return false;
+    }
+
+    // not all channels can receive into a string with a smaller capacity than their maximum message size
+    typename IpcChannelType::Message_t message;
+    if (m_ipcChannel->timedReceive(message, timeout).has_error())
+    {
+        return false;
+    }
+
+    if (message.size() > IpcFrame::CAPACITY)
+    {
+        IOX_LOG(Error, "The received message of " << message.size() << " bytes does not fit into an IPC frame");
+        return false;
+    }
+
+    frame.m_buffer = IpcFrame::Buffer_t(TruncateToCapacity, message.c_str(), message.size());
+    frame.m_isValid = true;
+    if (!frame.isValid())
+    {
+        IOX_LOG(Error, "The received message " << frame.m_buffer << " is not valid");
+        return false;
+    }
+    return true;
+}
+
 template <typename IpcChannelType>
 bool IpcInterface<IpcChannelType>::setMessageFromString(const char* buffer, IpcMessage& answer) noexcept
 {
@@ -186,13 +219,38 @@ bool IpcInterface<IpcChannelType>::send(const IpcMessage& msg) const noexcept
     auto logLengthError = [&msg](PosixIpcChannelError& error) {
         if (error == PosixIpcChannelError::MESSAGE_TOO_LONG)
         {
-            const uint64_t messageSize = msg.getMessage().size() + platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE;
+            const uint64_t messageSize = msg.getMessage().size() + IpcChannelType::NULL_TERMINATOR_SIZE;
             IOX_LOG(Error, "msg size of " << messageSize << " bigger than configured max message size");
         }
     };
     return !m_ipcChannel->send(msg.getMessage()).or_else(logLengthError).has_error();
 }
 
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::send(const IpcFrame& frame) const noexcept
+{
+    if (!m_ipcChannel.has_value())
+    {
+        IOX_LOG(Warn, "Trying to send data on an non-initialized IPC interface! Interface name: " << m_interfaceName);
+        return false;
+    }
+
+    if (!frame.isValid())
+    {
+        IOX_LOG(Error, "Trying to send an IPC frame which is not valid");
+        return false;
+    }
+
+    auto logLengthError = [&frame](PosixIpcChannelError& error) {
+        if (error == PosixIpcChannelError::MESSAGE_TOO_LONG)
+        {
+            const uint64_t messageSize = frame.size() + IpcChannelType::NULL_TERMINATOR_SIZE;
+            IOX_LOG(Error, "msg size of " << messageSize << " bigger than configured max message size");
+        }
+    };
+    return !m_ipcChannel->send(frame.m_buffer).or_else(logLengthError).has_error();
+}
+
 template <typename IpcChannelType>
 bool IpcInterface<IpcChannelType>::timedSend(const IpcMessage& msg, units::Duration timeout) const noexcept
 {
@@ -213,7 +271,7 @@ bool IpcInterface<IpcChannelType>::timedSend(const IpcMessage& msg, units::Durat
     auto logLengthError = [&msg](PosixIpcChannelError& error) {
         if (error == PosixIpcChannelError::MESSAGE_TOO_LONG)
         {
-            const uint64_t messageSize = msg.getMessage().size() + platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE;
+            const uint64_t messageSize = msg.getMessage().size() + IpcChannelType::NULL_TERMINATOR_SIZE;
             IOX_LOG(Error, "msg size of " << messageSize << " bigger than configured max message size");
         }
     };
@@ -299,7 +357,7 @@ bool IpcInterface<IpcChannelType>::hasClosableIpcChannel() const noexcept
 template <typename IpcChannelType>
 void IpcInterface<IpcChannelType>::cleanupOutdatedIpcChannel(const InterfaceName_t& name) noexcept
 {
-    if (platform::IoxIpcChannelType::unlinkIfExists(name).value_or(false))
+    if (IpcChannelType::unlinkIfExists(name).value_or(false))
     {
         IOX_LOG(Warn, "IPC channel still there, doing an unlink of '" << name << "'");
     }
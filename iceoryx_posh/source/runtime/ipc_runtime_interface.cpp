@@ -185,6 +185,23 @@ bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage&
     return true;
 }
 
+bool IpcRuntimeInterface::sendRequestToRouDi(const IpcFrame& frame, IpcMessage& answer) noexcept
+{
+    if (!m_RoudiIpcInterface.send(frame))
+    {
+        IOX_LOG(Error, "Could not send request via RouDi IPC channel interface.\n");
+        return false;
+    }
+
+    if (!m_AppIpcInterface.receive(answer))
+    {
+        IOX_LOG(Error, "Could not receive request via App IPC channel interface.\n");
+        return false;
+    }
+
+    return true;
+}
+
 uint64_t IpcRuntimeInterface::getShmTopicSize() noexcept
 {
     return m_mgmtShmCharacteristics.shmTopicSize;
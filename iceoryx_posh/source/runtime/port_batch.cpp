@@ -0,0 +1,128 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_batch.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+PortKind PortBatch::Entry::kind() const noexcept
+{
+    return static_cast<PortKind>(options.index());
+}
+
+optional<PortBatch::Index_t> PortBatch::addPublisher(const capro::ServiceDescription& service,
+                                                     const popo::PublisherOptions& publisherOptions,
+                                                     const PortConfigInfo& portConfigInfo) noexcept
+{
+    return add({service, Options_t(in_place_type<popo::PublisherOptions>(), publisherOptions), portConfigInfo});
+}
+
+optional<PortBatch::Index_t> PortBatch::addSubscriber(const capro::ServiceDescription& service,
+                                                      const popo::SubscriberOptions& subscriberOptions,
+                                                      const PortConfigInfo& portConfigInfo) noexcept
+{
+    return add({service, Options_t(in_place_type<popo::SubscriberOptions>(), subscriberOptions), portConfigInfo});
+}
+
+optional<PortBatch::Index_t> PortBatch::addClient(const capro::ServiceDescription& service,
+                                                  const popo::ClientOptions& clientOptions,
+                                                  const PortConfigInfo& portConfigInfo) noexcept
+{
+    return add({service, Options_t(in_place_type<popo::ClientOptions>(), clientOptions), portConfigInfo});
+}
+
+optional<PortBatch::Index_t> PortBatch::addServer(const capro::ServiceDescription& service,
+                                                  const popo::ServerOptions& serverOptions,
+                                                  const PortConfigInfo& portConfigInfo) noexcept
+{
+    return add({service, Options_t(in_place_type<popo::ServerOptions>(), serverOptions), portConfigInfo});
+}
+
+optional<PortBatch::Index_t> PortBatch::add(const Entry& entry) noexcept
+{
+    if (!m_entries.push_back(entry))
+    {
+        return nullopt;
+    }
+    return m_entries.size() - 1U;
+}
+
+template <typename PortData>
+PortData* PortBatch::take(const Index_t index, const PortKind kind) noexcept
+{
+    if (index >= m_entries.size() || m_entries[index].kind() != kind)
+    {
+        return nullptr;
+    }
+    auto* portData = static_cast<PortData*>(m_entries[index].portData);
+    m_entries[index].portData = nullptr;
+    return portData;
+}
+
+PublisherPortUserType::MemberType_t* PortBatch::takePublisher(const Index_t index) noexcept
+{
+    return take<PublisherPortUserType::MemberType_t>(index, PortKind::PUBLISHER);
+}
+
+SubscriberPortUserType::MemberType_t* PortBatch::takeSubscriber(const Index_t index) noexcept
+{
+    return take<SubscriberPortUserType::MemberType_t>(index, PortKind::SUBSCRIBER);
+}
+
+popo::ClientPortData* PortBatch::takeClient(const Index_t index) noexcept
+{
+    return take<popo::ClientPortData>(index, PortKind::CLIENT);
+}
+
+popo::ServerPortData* PortBatch::takeServer(const Index_t index) noexcept
+{
+    return take<popo::ServerPortData>(index, PortKind::SERVER);
+}
+
+IpcMessageErrorType PortBatch::getError(const Index_t index) const noexcept
+{
+    return (index < m_entries.size()) ? m_entries[index].error : IpcMessageErrorType::NOTYPE;
+}
+
+PortBatch::Entry& PortBatch::operator[](const Index_t index) noexcept
+{
+    return m_entries[index];
+}
+
+const PortBatch::Entry& PortBatch::operator[](const Index_t index) const noexcept
+{
+    return m_entries[index];
+}
+
+uint64_t PortBatch::size() const noexcept
+{
+    return m_entries.size();
+}
+
+bool PortBatch::empty() const noexcept
+{
+    return m_entries.empty();
+}
+
+void PortBatch::clear() noexcept
+{
+    m_entries.clear();
+}
+
+} // namespace runtime
+} // namespace iox
@@ -156,5 +156,45 @@ void PoshRuntime::shutdown() noexcept
     m_shutdownRequested.store(true, std::memory_order_relaxed);
 }
 
+bool PoshRuntime::getMiddlewarePorts(PortBatch& ports) noexcept
+{
+    bool areAllPortsCreated{true};
+    for (PortBatch::Index_t i = 0U; i < ports.size(); ++i)
+    {
+        auto& port = ports[i];
+        if (port.portData != nullptr)
+        {
+            continue;
+        }
+
+        switch (port.kind())
+        {
+        case PortKind::PUBLISHER:
+            port.portData =
+                getMiddlewarePublisher(port.service, *port.options.get<popo::PublisherOptions>(), port.portConfigInfo);
+            break;
+        case PortKind::SUBSCRIBER:
+            port.portData = getMiddlewareSubscriber(
+                port.service, *port.options.get<popo::SubscriberOptions>(), port.portConfigInfo);
+            break;
+        case PortKind::CLIENT:
+            port.portData =
+                getMiddlewareClient(port.service, *port.options.get<popo::ClientOptions>(), port.portConfigInfo);
+            break;
+        case PortKind::SERVER:
+            port.portData =
+                getMiddlewareServer(port.service, *port.options.get<popo::ServerOptions>(), port.portConfigInfo);
+            break;
+        }
+        areAllPortsCreated = areAllPortsCreated && port.portData != nullptr;
+    }
+    return areAllPortsCreated;
+}
+
+uint64_t PoshRuntime::unmapPayloadSegments() noexcept
+{
+    return 0U;
+}
+
 } // namespace runtime
 } // namespace iox
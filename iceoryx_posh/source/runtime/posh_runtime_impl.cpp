@@ -21,6 +21,7 @@
 #include "iox/variant.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
@@ -120,6 +121,10 @@ PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name,
 
 PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
 {
+    // Return the chunks in the thread caches before RouDi releases the remaining ones on termination; afterwards the
+    // shared memory is unmapped and must not be touched by terminating threads anymore
+    mepoo::MemPool::releaseThreadCachesOfCurrentProcess();
+
     // Inform RouDi that we're shutting down
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::TERMINATION) << m_appName;
@@ -151,6 +156,23 @@ PublisherPortUserType::MemberType_t*
 PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
                                         const popo::PublisherOptions& publisherOptions,
                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    IpcFrame sendBuffer(IpcMessageType::CREATE_PUBLISHER, m_appName);
+    sendBuffer << service << adjustPublisherOptions(publisherOptions) << portConfigInfo;
+
+    auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
+    if (maybePublisher.has_error())
+    {
+        reportPublisherCreationError(service, maybePublisher.error());
+        return nullptr;
+    }
+    trackPort(PortKind::PUBLISHER, maybePublisher.value());
+    mapWritablePayloadSegments();
+    return maybePublisher.value();
+}
+
+popo::PublisherOptions
+PoshRuntimeImpl::adjustPublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept
 {
     constexpr uint64_t MAX_HISTORY_CAPACITY =
         PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
@@ -169,62 +191,56 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
     {
         options.nodeName = m_appName;
     }
+    return options;
+}
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<Serialization>(service).toString() << publisherOptions.serialize().toString()
-               << static_cast<Serialization>(portConfigInfo).toString();
-
-    auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
-    if (maybePublisher.has_error())
+void PoshRuntimeImpl::reportPublisherCreationError(const capro::ServiceDescription& service,
+                                                   const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
     {
-        switch (maybePublisher.error())
-        {
-        case IpcMessageErrorType::NO_UNIQUE_CREATED:
-            IOX_LOG(Warn, "Service '" << service << "' already in use by another process.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-            IOX_LOG(Warn, "Usage of internal service '" << service << "' is forbidden.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::PUBLISHER_LIST_FULL:
-            IOX_LOG(Warn,
-                    "Service '" << service << "' could not be created since we are out of memory for publishers.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE:
-            IOX_LOG(Warn, "Service '" << service << "' could not be created. Request publisher got invalid response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE:
-            IOX_LOG(Warn,
-                    "Service '" << service
-                                << "' could not be created. Request publisher got wrong IPC channel response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE,
-                       iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT:
-            IOX_LOG(
-                Warn,
-                "Service '"
-                    << service
-                    << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                       "user. Try using another user or adapt RouDi's config.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
-            break;
-        default:
-            IOX_LOG(Warn, "Unknown error occurred while creating service '" << service << "'.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
-            break;
-        }
-        return nullptr;
+    case IpcMessageErrorType::NO_UNIQUE_CREATED:
+        IOX_LOG(Warn, "Service '" << service << "' already in use by another process.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+        IOX_LOG(Warn, "Usage of internal service '" << service << "' is forbidden.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::PUBLISHER_LIST_FULL:
+        IOX_LOG(Warn,
+                "Service '" << service << "' could not be created since we are out of memory for publishers.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE:
+        IOX_LOG(Warn, "Service '" << service << "' could not be created. Request publisher got invalid response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE:
+        IOX_LOG(Warn,
+                "Service '" << service
+                            << "' could not be created. Request publisher got wrong IPC channel response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE,
+                   iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT:
+        IOX_LOG(
+            Warn,
+            "Service '"
+                << service
+                << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                   "user. Try using another user or adapt RouDi's config.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
+        break;
+    default:
+        IOX_LOG(Warn, "Unknown error occurred while creating service '" << service << "'.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
+        break;
     }
-    return maybePublisher.value();
 }
 
 expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept
+PoshRuntimeImpl::requestPublisherFromRoudi(const IpcFrame& sendBuffer) noexcept
 {
     IpcMessage receiveBuffer;
     if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
@@ -270,6 +286,24 @@ SubscriberPortUserType::MemberType_t*
 PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& service,
                                          const popo::SubscriberOptions& subscriberOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
+{
+    IpcFrame sendBuffer(IpcMessageType::CREATE_SUBSCRIBER, m_appName);
+    sendBuffer << service << adjustSubscriberOptions(service, subscriberOptions) << portConfigInfo;
+
+    auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
+
+    if (maybeSubscriber.has_error())
+    {
+        reportSubscriberCreationError(service, maybeSubscriber.error());
+        return nullptr;
+    }
+    trackPort(PortKind::SUBSCRIBER, maybeSubscriber.value());
+    return maybeSubscriber.value();
+}
+
+popo::SubscriberOptions
+PoshRuntimeImpl::adjustSubscriberOptions(const capro::ServiceDescription& service,
+                                         const popo::SubscriberOptions& subscriberOptions) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
 
@@ -302,46 +336,39 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
     {
         options.nodeName = m_appName;
     }
+    return options;
+}
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
-               << static_cast<Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<Serialization>(portConfigInfo).toString();
-
-    auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
-
-    if (maybeSubscriber.has_error())
+void PoshRuntimeImpl::reportSubscriberCreationError(const capro::ServiceDescription& service,
+                                                    const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
     {
-        switch (maybeSubscriber.error())
-        {
-        case IpcMessageErrorType::SUBSCRIBER_LIST_FULL:
-            IOX_LOG(Warn,
-                    "Service '" << service << "' could not be created since we are out of memory for subscribers.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE:
-            IOX_LOG(Warn, "Service '" << service << "' could not be created. Request subscriber got invalid response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE:
-            IOX_LOG(Warn,
-                    "Service '" << service
-                                << "' could not be created. Request subscriber got wrong IPC channel response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE,
-                       iox::er::RUNTIME_ERROR);
-            break;
-        default:
-            IOX_LOG(Warn, "Unknown error occurred while creating service '" << service << "'.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
-            break;
-        }
-        return nullptr;
+    case IpcMessageErrorType::SUBSCRIBER_LIST_FULL:
+        IOX_LOG(Warn,
+                "Service '" << service << "' could not be created since we are out of memory for subscribers.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE:
+        IOX_LOG(Warn, "Service '" << service << "' could not be created. Request subscriber got invalid response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE:
+        IOX_LOG(Warn,
+                "Service '" << service
+                            << "' could not be created. Request subscriber got wrong IPC channel response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE,
+                   iox::er::RUNTIME_ERROR);
+        break;
+    default:
+        IOX_LOG(Warn, "Unknown error occurred while creating service '" << service << "'.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
+        break;
     }
-    return maybeSubscriber.value();
 }
 
 expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept
+PoshRuntimeImpl::requestSubscriberFromRoudi(const IpcFrame& sendBuffer) noexcept
 {
     IpcMessage receiveBuffer;
     if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
@@ -387,6 +414,22 @@ PoshRuntimeImpl::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexce
 popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const capro::ServiceDescription& service,
                                                                          const popo::ClientOptions& clientOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
+{
+    IpcFrame sendBuffer(IpcMessageType::CREATE_CLIENT, m_appName);
+    sendBuffer << service << adjustClientOptions(clientOptions) << portConfigInfo;
+
+    auto maybeClient = requestClientFromRoudi(sendBuffer);
+    if (maybeClient.has_error())
+    {
+        reportClientCreationError(service, maybeClient.error());
+        return nullptr;
+    }
+    trackPort(PortKind::CLIENT, maybeClient.value());
+    mapWritablePayloadSegments();
+    return maybeClient.value();
+}
+
+popo::ClientOptions PoshRuntimeImpl::adjustClientOptions(const popo::ClientOptions& clientOptions) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ClientChunkQueueConfig::MAX_QUEUE_CAPACITY;
     auto options = clientOptions;
@@ -405,56 +448,50 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
                     << " the capacity is set to 1");
         options.responseQueueCapacity = 1U;
     }
+    return options;
+}
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
-               << static_cast<Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<Serialization>(portConfigInfo).toString();
-
-    auto maybeClient = requestClientFromRoudi(sendBuffer);
-    if (maybeClient.has_error())
+void PoshRuntimeImpl::reportClientCreationError(const capro::ServiceDescription& service,
+                                                const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
     {
-        switch (maybeClient.error())
-        {
-        case IpcMessageErrorType::CLIENT_LIST_FULL:
-            IOX_LOG(Warn,
-                    "Could not create client with service description '" << service
-                                                                         << "' as we are out of memory for clients.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_CLIENTS, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE:
-            IOX_LOG(Warn,
-                    "Could not create client with service description '" << service << "'; received invalid response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE:
-            IOX_LOG(Warn,
-                    "Could not create client with service description '" << service
-                                                                         << "'; received wrong IPC channel response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE,
-                       iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT:
-            IOX_LOG(
-                Warn,
-                "Service '"
-                    << service
-                    << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                       "user. Try using another user or adapt RouDi's config.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
-            break;
-        default:
-            IOX_LOG(Warn, "Unknown error occurred while creating client with service description '" << service << "'");
-            IOX_REPORT(PoshError::POSH__RUNTIME_CLIENT_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
-            break;
-        }
-        return nullptr;
+    case IpcMessageErrorType::CLIENT_LIST_FULL:
+        IOX_LOG(Warn,
+                "Could not create client with service description '" << service
+                                                                     << "' as we are out of memory for clients.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_CLIENTS, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE:
+        IOX_LOG(Warn,
+                "Could not create client with service description '" << service << "'; received invalid response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE:
+        IOX_LOG(Warn,
+                "Could not create client with service description '" << service
+                                                                     << "'; received wrong IPC channel response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE,
+                   iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT:
+        IOX_LOG(
+            Warn,
+            "Service '"
+                << service
+                << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                   "user. Try using another user or adapt RouDi's config.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
+        break;
+    default:
+        IOX_LOG(Warn, "Unknown error occurred while creating client with service description '" << service << "'");
+        IOX_REPORT(PoshError::POSH__RUNTIME_CLIENT_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
+        break;
     }
-    return maybeClient.value();
 }
 
 expected<popo::ClientPortUser::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept
+PoshRuntimeImpl::requestClientFromRoudi(const IpcFrame& sendBuffer) noexcept
 {
     IpcMessage receiveBuffer;
     if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
@@ -500,6 +537,22 @@ PoshRuntimeImpl::requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept
 popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const capro::ServiceDescription& service,
                                                                          const popo::ServerOptions& serverOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
+{
+    IpcFrame sendBuffer(IpcMessageType::CREATE_SERVER, m_appName);
+    sendBuffer << service << adjustServerOptions(serverOptions) << portConfigInfo;
+
+    auto maybeServer = requestServerFromRoudi(sendBuffer);
+    if (maybeServer.has_error())
+    {
+        reportServerCreationError(service, maybeServer.error());
+        return nullptr;
+    }
+    trackPort(PortKind::SERVER, maybeServer.value());
+    mapWritablePayloadSegments();
+    return maybeServer.value();
+}
+
+popo::ServerOptions PoshRuntimeImpl::adjustServerOptions(const popo::ServerOptions& serverOptions) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ServerChunkQueueConfig::MAX_QUEUE_CAPACITY;
     auto options = serverOptions;
@@ -518,56 +571,50 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
                     << " the capacity is set to 1");
         options.requestQueueCapacity = 1U;
     }
+    return options;
+}
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
-               << static_cast<Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<Serialization>(portConfigInfo).toString();
-
-    auto maybeServer = requestServerFromRoudi(sendBuffer);
-    if (maybeServer.has_error())
+void PoshRuntimeImpl::reportServerCreationError(const capro::ServiceDescription& service,
+                                                const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
     {
-        switch (maybeServer.error())
-        {
-        case IpcMessageErrorType::SERVER_LIST_FULL:
-            IOX_LOG(Warn,
-                    "Could not create server with service description '" << service
-                                                                         << "' as we are out of memory for servers.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_SERVERS, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE:
-            IOX_LOG(Warn,
-                    "Could not create server with service description '" << service << "'; received invalid response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE:
-            IOX_LOG(Warn,
-                    "Could not create server with service description '" << service
-                                                                         << "'; received wrong IPC channel response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE,
-                       iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT:
-            IOX_LOG(
-                Warn,
-                "Service '"
-                    << service
-                    << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                       "user. Try using another user or adapt RouDi's config.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
-            break;
-        default:
-            IOX_LOG(Warn, "Unknown error occurred while creating server with service description '" << service << "'");
-            IOX_REPORT(PoshError::POSH__RUNTIME_SERVER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
-            break;
-        }
-        return nullptr;
+    case IpcMessageErrorType::SERVER_LIST_FULL:
+        IOX_LOG(Warn,
+                "Could not create server with service description '" << service
+                                                                     << "' as we are out of memory for servers.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_SERVERS, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE:
+        IOX_LOG(Warn,
+                "Could not create server with service description '" << service << "'; received invalid response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE:
+        IOX_LOG(Warn,
+                "Could not create server with service description '" << service
+                                                                     << "'; received wrong IPC channel response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE,
+                   iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT:
+        IOX_LOG(
+            Warn,
+            "Service '"
+                << service
+                << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                   "user. Try using another user or adapt RouDi's config.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
+        break;
+    default:
+        IOX_LOG(Warn, "Unknown error occurred while creating server with service description '" << service << "'");
+        IOX_REPORT(PoshError::POSH__RUNTIME_SERVER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
+        break;
     }
-    return maybeServer.value();
 }
 
 expected<popo::ServerPortUser::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept
+PoshRuntimeImpl::requestServerFromRoudi(const IpcFrame& sendBuffer) noexcept
 {
     IpcMessage receiveBuffer;
     if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
@@ -609,6 +656,293 @@ PoshRuntimeImpl::requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept
     return err(IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
+bool PoshRuntimeImpl::getMiddlewarePorts(PortBatch& ports) noexcept
+{
+    bool areAllPortsCreated{true};
+    PortBatch::Index_t index{0U};
+    while (index < ports.size())
+    {
+        // as many ports as fit into one message are requested together; a port which does not fit anymore is
+        // requested with the next message
+        IpcFrame sendBuffer(IpcMessageType::CREATE_PORTS, m_appName);
+        RequestedPorts_t requestedPorts;
+        for (; index < ports.size() && requestedPorts.size() < PortBatch::MAX_PORTS_PER_REQUEST; ++index)
+        {
+            auto& port = ports[index];
+            if (port.portData != nullptr)
+            {
+                // already created by a previous call
+                continue;
+            }
+
+            auto request = sendBuffer;
+            request << adjustPortOptions(port);
+            if (!request.isValid())
+            {
+                if (!requestedPorts.empty())
+                {
+                    break;
+                }
+                // the port does not even fit into an empty message or has invalid options, e.g. the node name
+                port.error = portCreationError(port.kind(), PortCreationFailure::INVALID_RESPONSE);
+                reportPortCreationError(port);
+                areAllPortsCreated = false;
+                continue;
+            }
+            sendBuffer = request;
+            IOX_DISCARD_RESULT(requestedPorts.push_back(index));
+        }
+
+        if (!requestedPorts.empty() && !requestPortsFromRoudi(sendBuffer, ports, requestedPorts))
+        {
+            areAllPortsCreated = false;
+        }
+    }
+
+    for (PortBatch::Index_t i = 0U; i < ports.size(); ++i)
+    {
+        if (ports[i].portData != nullptr && ports[i].kind() != PortKind::SUBSCRIBER)
+        {
+            mapWritablePayloadSegments();
+            break;
+        }
+    }
+    return areAllPortsCreated;
+}
+
+void PoshRuntimeImpl::mapWritablePayloadSegments() noexcept
+{
+    if (m_ShmInterface.has_value())
+    {
+        m_ShmInterface->mapWritablePayloadSegments();
+    }
+}
+
+void PoshRuntimeImpl::trackPort(const PortKind kind, void* const portData) noexcept
+{
+    auto trackedPorts = m_trackedPorts.getScopeGuard();
+    auto port = trackedPorts->begin();
+    while (port != trackedPorts->end())
+    {
+        // a port which was destroyed in the meantime is forgotten since its memory might already be reused; the
+        // erase moves the following ports one position to the front
+        if (port->portData == portData || !isPortOfThisRuntime(*port))
+        {
+            IOX_DISCARD_RESULT(trackedPorts->erase(port));
+        }
+        else
+        {
+            ++port;
+        }
+    }
+
+    if (!trackedPorts->emplace_back(TrackedPort{kind, portData}))
+    {
+        IOX_LOG(Error,
+                "Could not track the created port; the payload segments might be unmapped while it holds chunks");
+    }
+}
+
+bool PoshRuntimeImpl::isPortOfThisRuntime(const TrackedPort& port) const noexcept
+{
+    const popo::BasePortData* basePortData{nullptr};
+    switch (port.kind)
+    {
+    case PortKind::PUBLISHER:
+        basePortData = static_cast<PublisherPortUserType::MemberType_t*>(port.portData);
+        break;
+    case PortKind::SUBSCRIBER:
+        basePortData = static_cast<SubscriberPortUserType::MemberType_t*>(port.portData);
+        break;
+    case PortKind::CLIENT:
+        basePortData = static_cast<popo::ClientPortUser::MemberType_t*>(port.portData);
+        break;
+    case PortKind::SERVER:
+        basePortData = static_cast<popo::ServerPortUser::MemberType_t*>(port.portData);
+        break;
+    }
+    return basePortData != nullptr && basePortData->m_runtimeName == m_appName
+           && !basePortData->m_toBeDestroyed.load(std::memory_order_relaxed);
+}
+
+bool PoshRuntimeImpl::holdsChunks(const TrackedPort& port) noexcept
+{
+    switch (port.kind)
+    {
+    case PortKind::PUBLISHER:
+    {
+        auto* portData = static_cast<PublisherPortUserType::MemberType_t*>(port.portData);
+        return !portData->m_chunkSenderData.m_chunksInUse.isEmpty();
+    }
+    case PortKind::SUBSCRIBER:
+    {
+        auto* portData = static_cast<SubscriberPortUserType::MemberType_t*>(port.portData);
+        return !portData->m_chunkReceiverData.m_chunksInUse.isEmpty();
+    }
+    case PortKind::CLIENT:
+    {
+        auto* portData = static_cast<popo::ClientPortUser::MemberType_t*>(port.portData);
+        return !portData->m_chunkSenderData.m_chunksInUse.isEmpty()
+               || !portData->m_chunkReceiverData.m_chunksInUse.isEmpty();
+    }
+    case PortKind::SERVER:
+    {
+        auto* portData = static_cast<popo::ServerPortUser::MemberType_t*>(port.portData);
+        return !portData->m_chunkSenderData.m_chunksInUse.isEmpty()
+               || !portData->m_chunkReceiverData.m_chunksInUse.isEmpty();
+    }
+    }
+    return false;
+}
+
+PortBatch::Entry PoshRuntimeImpl::adjustPortOptions(const PortBatch::Entry& port) const noexcept
+{
+    auto adjustedPort = port;
+    switch (port.kind())
+    {
+    case PortKind::PUBLISHER:
+        adjustedPort.options.emplace<popo::PublisherOptions>(
+            adjustPublisherOptions(*port.options.get<popo::PublisherOptions>()));
+        break;
+    case PortKind::SUBSCRIBER:
+        adjustedPort.options.emplace<popo::SubscriberOptions>(
+            adjustSubscriberOptions(port.service, *port.options.get<popo::SubscriberOptions>()));
+        break;
+    case PortKind::CLIENT:
+        adjustedPort.options.emplace<popo::ClientOptions>(
+            adjustClientOptions(*port.options.get<popo::ClientOptions>()));
+        break;
+    case PortKind::SERVER:
+        adjustedPort.options.emplace<popo::ServerOptions>(
+            adjustServerOptions(*port.options.get<popo::ServerOptions>()));
+        break;
+    }
+    return adjustedPort;
+}
+
+bool PoshRuntimeImpl::requestPortsFromRoudi(const IpcFrame& sendBuffer,
+                                            PortBatch& ports,
+                                            const RequestedPorts_t& requestedPorts) noexcept
+{
+    const auto failAll = [&](const uint64_t first, const PortCreationFailure failure) {
+        for (uint64_t i = first; i < requestedPorts.size(); ++i)
+        {
+            auto& port = ports[requestedPorts[i]];
+            port.error = portCreationError(port.kind(), failure);
+            reportPortCreationError(port);
+        }
+        return false;
+    };
+
+    IpcMessage receiveBuffer;
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
+    {
+        IOX_LOG(Error, "Request ports got invalid response!");
+        return failAll(0U, PortCreationFailure::INVALID_RESPONSE);
+    }
+
+    if (stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str()) != IpcMessageType::CREATE_PORTS_ACK)
+    {
+        IOX_LOG(Error, "Request ports got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'");
+        return failAll(0U, PortCreationFailure::WRONG_IPC_MESSAGE_RESPONSE);
+    }
+
+    // the response contains for each port the same elements as the response to a request for a single port
+    bool areAllPortsCreated{true};
+    uint32_t element{1U};
+    const auto numberOfElements = receiveBuffer.getNumberOfElements();
+    for (uint64_t i = 0U; i < requestedPorts.size(); ++i)
+    {
+        auto& port = ports[requestedPorts[i]];
+        const auto type = stringToIpcMessageType(receiveBuffer.getElementAtIndex(element).c_str());
+        if (type == portCreationAck(port.kind()) && element + 2U < numberOfElements)
+        {
+            auto result = convert_id_and_offset(receiveBuffer, element + 1U);
+            element += 3U;
+            if (result.has_error())
+            {
+                port.error = result.error();
+                reportPortCreationError(port);
+                areAllPortsCreated = false;
+                continue;
+            }
+            auto [segment_id, offset] = result.value();
+            port.portData = UntypedRelativePointer::getPtr(segment_id_t{segment_id}, offset);
+            port.error = IpcMessageErrorType::NOTYPE;
+            trackPort(port.kind(), port.portData);
+        }
+        else if (type == IpcMessageType::ERROR_RESPONSE && element + 1U < numberOfElements)
+        {
+            port.error = stringToIpcMessageErrorType(receiveBuffer.getElementAtIndex(element + 1U).c_str());
+            element += 2U;
+            reportPortCreationError(port);
+            areAllPortsCreated = false;
+        }
+        else
+        {
+            IOX_LOG(Error, "Request ports got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'");
+            return failAll(i, PortCreationFailure::WRONG_IPC_MESSAGE_RESPONSE);
+        }
+    }
+    return areAllPortsCreated;
+}
+
+IpcMessageType PoshRuntimeImpl::portCreationAck(const PortKind kind) noexcept
+{
+    switch (kind)
+    {
+    case PortKind::PUBLISHER:
+        return IpcMessageType::CREATE_PUBLISHER_ACK;
+    case PortKind::SUBSCRIBER:
+        return IpcMessageType::CREATE_SUBSCRIBER_ACK;
+    case PortKind::CLIENT:
+        return IpcMessageType::CREATE_CLIENT_ACK;
+    case PortKind::SERVER:
+        return IpcMessageType::CREATE_SERVER_ACK;
+    }
+    return IpcMessageType::NOTYPE;
+}
+
+IpcMessageErrorType PoshRuntimeImpl::portCreationError(const PortKind kind, const PortCreationFailure failure) noexcept
+{
+    const bool isInvalidResponse = failure == PortCreationFailure::INVALID_RESPONSE;
+    switch (kind)
+    {
+    case PortKind::PUBLISHER:
+        return isInvalidResponse ? IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE
+                                 : IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE;
+    case PortKind::SUBSCRIBER:
+        return isInvalidResponse ? IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE
+                                 : IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE;
+    case PortKind::CLIENT:
+        return isInvalidResponse ? IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE
+                                 : IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE;
+    case PortKind::SERVER:
+        return isInvalidResponse ? IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE
+                                 : IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE;
+    }
+    return IpcMessageErrorType::NOTYPE;
+}
+
+void PoshRuntimeImpl::reportPortCreationError(const PortBatch::Entry& port) const noexcept
+{
+    switch (port.kind())
+    {
+    case PortKind::PUBLISHER:
+        reportPublisherCreationError(port.service, port.error);
+        break;
+    case PortKind::SUBSCRIBER:
+        reportSubscriberCreationError(port.service, port.error);
+        break;
+    case PortKind::CLIENT:
+        reportClientCreationError(port.service, port.error);
+        break;
+    case PortKind::SERVER:
+        reportServerCreationError(port.service, port.error);
+        break;
+    }
+}
+
 popo::InterfacePortData* PoshRuntimeImpl::getMiddlewareInterface(const capro::Interfaces commInterface,
                                                                  const NodeName_t& nodeName) noexcept
 {
@@ -728,11 +1062,35 @@ popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() n
     return maybeConditionVariable.value();
 }
 
+uint64_t PoshRuntimeImpl::unmapPayloadSegments() noexcept
+{
+    if (!m_ShmInterface.has_value())
+    {
+        return 0U;
+    }
+
+    auto trackedPorts = m_trackedPorts.getScopeGuard();
+    for (const auto& port : *trackedPorts)
+    {
+        if (isPortOfThisRuntime(port) && holdsChunks(port))
+        {
+            IOX_LOG(Warn, "The payload segments are not unmapped since a port of '" << m_appName << "' holds chunks");
+            return 0U;
+        }
+    }
+    return m_ShmInterface->unmapPayloadSegments();
+}
+
 bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
 {
     return m_ipcChannelInterface->sendRequestToRouDi(msg, answer);
 }
 
+bool PoshRuntimeImpl::sendRequestToRouDi(const IpcFrame& frame, IpcMessage& answer) noexcept
+{
+    return m_ipcChannelInterface->sendRequestToRouDi(frame, answer);
+}
+
 // this is the callback for the m_keepAliveTimer
 void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
 {
@@ -775,10 +1133,10 @@ void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
 }
 
 expected<std::tuple<segment_id_underlying_t, UntypedRelativePointer::offset_t>, IpcMessageErrorType>
-PoshRuntimeImpl::convert_id_and_offset(IpcMessage& msg)
+PoshRuntimeImpl::convert_id_and_offset(IpcMessage& msg, const uint32_t offsetIndex)
 {
-    auto id = convert::from_string<segment_id_underlying_t>(msg.getElementAtIndex(2U).c_str());
-    auto offset = convert::from_string<UntypedRelativePointer::offset_t>(msg.getElementAtIndex(1U).c_str());
+    auto id = convert::from_string<segment_id_underlying_t>(msg.getElementAtIndex(offsetIndex + 1U).c_str());
+    auto offset = convert::from_string<UntypedRelativePointer::offset_t>(msg.getElementAtIndex(offsetIndex).c_str());
 
     if (!id.has_value())
     {
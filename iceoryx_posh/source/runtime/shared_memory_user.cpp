@@ -19,44 +19,103 @@
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/detail/convert.hpp"
 #include "iox/logging.hpp"
 #include "iox/posix_user.hpp"
 #include "iox/scope_guard.hpp"
 
+#include <mutex>
+
 namespace iox
 {
 namespace runtime
 {
+namespace
+{
+using SegmentMapping_t = mepoo::SegmentManager<>::SegmentMapping;
+
+struct OnDemandSegment
+{
+    explicit OnDemandSegment(const SegmentMapping_t& mapping) noexcept
+        : mapping(mapping)
+    {
+    }
+
+    SegmentMapping_t mapping;
+    optional<PosixSharedMemoryObject> shm;
+};
+
+/// @brief the payload segments which are mapped on demand; the registry of the relative pointers is process wide and
+/// calls a plain function to register a segment, therefore this state is process wide as well
+struct OnDemandSegments
+{
+    std::mutex mutex;
+    DomainId domainId{DEFAULT_DOMAIN_ID};
+    roudi::MemoryResidency memoryResidency{roudi::MemoryResidency::OFF};
+    vector<OnDemandSegment, MAX_SHM_SEGMENTS> segments;
+};
+
+OnDemandSegments& onDemandSegments() noexcept
+{
+    static OnDemandSegments segments;
+    return segments;
+}
+} // namespace
+
 constexpr uint32_t SharedMemoryUser::NUMBER_OF_ALL_SHM_SEGMENTS;
 
 expected<SharedMemoryUser, SharedMemoryUserError>
 SharedMemoryUser::create(const DomainId domainId,
                          const uint64_t segmentId,
                          const uint64_t managementShmSize,
-                         const UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept
+                         const UntypedRelativePointer::offset_t segmentManagerAddressOffset,
+                         const roudi::MemoryResidency memoryResidency,
+                         const PayloadSegmentMapping payloadSegmentMapping) noexcept
 {
     ShmVector_t shmSegments;
     ScopeGuard shmCleaner{[] {}, [&shmSegments] { SharedMemoryUser::destroy(shmSegments); }};
 
     // open management segment
-    auto shmOpen = openShmSegment(shmSegments,
-                                  domainId,
-                                  segmentId,
-                                  ResourceType::ICEORYX_DEFINED,
-                                  {roudi::SHM_NAME},
-                                  managementShmSize,
-                                  AccessMode::ReadWrite);
-    if (shmOpen.has_error())
+    auto managementShm = openShmSegment(domainId,
+                                        segmentId,
+                                        ResourceType::ICEORYX_DEFINED,
+                                        {roudi::SHM_NAME},
+                                        managementShmSize,
+                                        AccessMode::ReadWrite,
+                                        false,
+                                        memoryResidency);
+    if (managementShm.has_error())
     {
-        return err(shmOpen.error());
+        return err(managementShm.error());
     }
+    shmSegments.emplace_back(std::move(managementShm.value()));
 
     // open payload segments
     auto* ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, segmentManagerAddressOffset);
     auto* segmentManager = static_cast<mepoo::SegmentManager<>*>(ptr);
 
     auto segmentMapping = segmentManager->getSegmentMappings(PosixUser::getUserOfCurrentProcess());
+
+    if (payloadSegmentMapping == PayloadSegmentMapping::ON_DEMAND)
+    {
+        auto& onDemand = onDemandSegments();
+        std::lock_guard<std::mutex> lock(onDemand.mutex);
+        onDemand.domainId = domainId;
+        onDemand.memoryResidency = memoryResidency;
+        onDemand.segments.clear();
+        for (const auto& segment : segmentMapping)
+        {
+            onDemand.segments.emplace_back(segment);
+        }
+        UntypedRelativePointer::setOnDemandRegistration(&SharedMemoryUser::mapPayloadSegmentOnDemand);
+
+        IOX_LOG(Debug, "Application maps " << onDemand.segments.size() << " payload data segments on demand");
+
+        ScopeGuard::release(std::move(shmCleaner));
+        return ok(SharedMemoryUser{std::move(shmSegments), true});
+    }
+
     for (const auto& segment : segmentMapping)
     {
         if (static_cast<uint32_t>(shmSegments.size()) >= MAX_SHM_SEGMENTS)
@@ -64,30 +123,65 @@ SharedMemoryUser::create(const DomainId domainId,
             return err(SharedMemoryUserError::TOO_MANY_SHM_SEGMENTS);
         }
 
-        auto shmOpen = openShmSegment(shmSegments,
-                                      domainId,
-                                      segment.m_segmentId,
-                                      ResourceType::USER_DEFINED,
-                                      segment.m_sharedMemoryName,
-                                      segment.m_size,
-                                      segment.m_isWritable ? AccessMode::ReadWrite : AccessMode::ReadOnly);
-        if (shmOpen.has_error())
+        auto payloadShm = openShmSegment(domainId,
+                                         segment.m_segmentId,
+                                         ResourceType::USER_DEFINED,
+                                         segment.m_sharedMemoryName,
+                                         segment.m_size,
+                                         segment.m_isWritable ? AccessMode::ReadWrite : AccessMode::ReadOnly,
+                                         segment.m_useHugePages,
+                                         algorithm::maxVal(memoryResidency, segment.m_memoryResidency));
+        if (payloadShm.has_error())
         {
-            return err(shmOpen.error());
+            return err(payloadShm.error());
         }
+        shmSegments.emplace_back(std::move(payloadShm.value()));
     }
 
     ScopeGuard::release(std::move(shmCleaner));
-    return ok(SharedMemoryUser{std::move(shmSegments)});
+    return ok(SharedMemoryUser{std::move(shmSegments), false});
 }
 
-SharedMemoryUser::SharedMemoryUser(ShmVector_t&& payloadShm) noexcept
+SharedMemoryUser::SharedMemoryUser(ShmVector_t&& payloadShm, const bool mapsPayloadSegmentsOnDemand) noexcept
     : m_shmSegments(std::move(payloadShm))
+    , m_mapsPayloadSegmentsOnDemand(mapsPayloadSegmentsOnDemand)
+{
+}
+
+SharedMemoryUser::SharedMemoryUser(SharedMemoryUser&& rhs) noexcept
 {
+    *this = std::move(rhs);
+}
+
+SharedMemoryUser& SharedMemoryUser::operator=(SharedMemoryUser&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        destroy();
+        m_shmSegments = std::move(rhs.m_shmSegments);
+        m_mapsPayloadSegmentsOnDemand = rhs.m_mapsPayloadSegmentsOnDemand;
+        rhs.m_mapsPayloadSegmentsOnDemand = false;
+    }
+    return *this;
 }
 
 SharedMemoryUser::~SharedMemoryUser() noexcept
 {
+    destroy();
+}
+
+void SharedMemoryUser::destroy() noexcept
+{
+    if (m_mapsPayloadSegmentsOnDemand)
+    {
+        // disable the registration first, otherwise a concurrent access would map the segment again
+        UntypedRelativePointer::setOnDemandRegistration(nullptr);
+        unmapPayloadSegments();
+        auto& onDemand = onDemandSegments();
+        std::lock_guard<std::mutex> lock(onDemand.mutex);
+        onDemand.segments.clear();
+        m_mapsPayloadSegmentsOnDemand = false;
+    }
     SharedMemoryUser::destroy(m_shmSegments);
 }
 
@@ -102,19 +196,116 @@ void SharedMemoryUser::destroy(ShmVector_t& shmSegments) noexcept
     }
 }
 
-expected<void, SharedMemoryUserError> SharedMemoryUser::openShmSegment(ShmVector_t& shmSegments,
-                                                                       const DomainId domainId,
-                                                                       const uint64_t segmentId,
-                                                                       const ResourceType resourceType,
-                                                                       const ShmName_t& shmName,
-                                                                       const uint64_t shmSize,
-                                                                       const AccessMode accessMode) noexcept
+void SharedMemoryUser::mapWritablePayloadSegments() noexcept
+{
+    if (!m_mapsPayloadSegmentsOnDemand)
+    {
+        return;
+    }
+
+    vector<uint64_t, MAX_SHM_SEGMENTS> writableSegmentIds;
+    {
+        auto& onDemand = onDemandSegments();
+        std::lock_guard<std::mutex> lock(onDemand.mutex);
+        for (const auto& segment : onDemand.segments)
+        {
+            if (segment.mapping.m_isWritable && !segment.shm.has_value())
+            {
+                writableSegmentIds.emplace_back(segment.mapping.m_segmentId);
+            }
+        }
+    }
+
+    // resolving the base pointer maps the segment
+    for (const auto segmentId : writableSegmentIds)
+    {
+        IOX_DISCARD_RESULT(UntypedRelativePointer::getBasePtr(segment_id_t{segmentId}));
+    }
+}
+
+uint64_t SharedMemoryUser::unmapPayloadSegments() noexcept
+{
+    if (!m_mapsPayloadSegmentsOnDemand)
+    {
+        return 0U;
+    }
+
+    auto& onDemand = onDemandSegments();
+    std::lock_guard<std::mutex> lock(onDemand.mutex);
+    uint64_t numberOfUnmappedSegments{0U};
+    for (auto& segment : onDemand.segments)
+    {
+        if (segment.shm.has_value())
+        {
+            UntypedRelativePointer::unregisterPtr(segment_id_t{segment.mapping.m_segmentId});
+            segment.shm.reset();
+            ++numberOfUnmappedSegments;
+        }
+    }
+
+    IOX_LOG(Debug, "Application unmapped " << numberOfUnmappedSegments << " payload data segments");
+    return numberOfUnmappedSegments;
+}
+
+void* SharedMemoryUser::mapPayloadSegmentOnDemand(const segment_id_underlying_t segmentId) noexcept
+{
+    auto& onDemand = onDemandSegments();
+    std::lock_guard<std::mutex> lock(onDemand.mutex);
+    for (auto& segment : onDemand.segments)
+    {
+        if (segment.mapping.m_segmentId != segmentId)
+        {
+            continue;
+        }
+
+        // another thread could have mapped the segment while this one was waiting for the lock
+        if (segment.shm.has_value())
+        {
+            return segment.shm->getBaseAddress();
+        }
+
+        const auto& mapping = segment.mapping;
+        auto shm = openShmSegment(onDemand.domainId,
+                                  mapping.m_segmentId,
+                                  ResourceType::USER_DEFINED,
+                                  mapping.m_sharedMemoryName,
+                                  mapping.m_size,
+                                  mapping.m_isWritable ? AccessMode::ReadWrite : AccessMode::ReadOnly,
+                                  mapping.m_useHugePages,
+                                  algorithm::maxVal(onDemand.memoryResidency, mapping.m_memoryResidency));
+        if (shm.has_error())
+        {
+            IOX_LOG(Fatal, "Could not map the payload data segment with id " << segmentId << " on demand");
+            IOX_REPORT_FATAL(PoshError::POSH__SHM_APP_SEGMENT_MAPP_ERR);
+            return nullptr;
+        }
+
+        segment.shm.emplace(std::move(shm.value()));
+        return segment.shm->getBaseAddress();
+    }
+
+    // not a payload segment of this application
+    return nullptr;
+}
+
+expected<PosixSharedMemoryObject, SharedMemoryUserError>
+SharedMemoryUser::openShmSegment(const DomainId domainId,
+                                 const uint64_t segmentId,
+                                 const ResourceType resourceType,
+                                 const ShmName_t& shmName,
+                                 const uint64_t shmSize,
+                                 const AccessMode accessMode,
+                                 const bool useHugePages,
+                                 const roudi::MemoryResidency memoryResidency) noexcept
 {
     auto shmResult = PosixSharedMemoryObjectBuilder()
                          .name(concatenate(iceoryxResourcePrefix(domainId, resourceType), shmName))
                          .memorySizeInBytes(shmSize)
                          .accessMode(accessMode)
                          .openMode(OpenMode::OpenExisting)
+                         .hugePages(useHugePages)
+                         .prefault(memoryResidency != roudi::MemoryResidency::OFF)
+                         .lockMemory(memoryResidency == roudi::MemoryResidency::PREFAULT_AND_LOCK)
                          .create();
 
     if (shmResult.has_error())
@@ -137,9 +328,7 @@ expected<void, SharedMemoryUserError> SharedMemoryUser::openShmSegment(ShmVector
                                   << " segment " << iox::log::hex(shm.getBaseAddress()) << " with size "
                                   << shm.get_size().expect("Failed to acquire SHM size.") << " to id " << segmentId);
 
-    shmSegments.emplace_back(std::move(shm));
-
-    return ok();
+    return ok(std::move(shm));
 }
 } // namespace runtime
 } // namespace iox
@@ -566,6 +566,33 @@ TEST(Node_test, PublisherAndSubscriberAreConnected)
     });
 }
 
+TEST(Node_test, PublisherAndSubscriberFromPortBatchAreConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b26d9ef-9e0a-4881-aedc-d2737b9ab35b");
+
+    RouDiEnv roudi;
+
+    auto node = RouDiEnvNodeBuilder("hypnotoad").create().expect("Creating a node should not fail!");
+
+    auto batch = node.port_batch();
+    auto publisher_index = node.publisher({"all", "glory", "hypnotoad"}).add_to(batch).expect("Adding publisher");
+    auto subscriber_index = node.subscriber({"all", "glory", "hypnotoad"}).add_to(batch).expect("Adding subscriber");
+    ASSERT_FALSE(batch.create().has_error());
+
+    auto publisher = batch.take_publisher<Publisher<uint64_t>>(publisher_index).expect("Getting publisher");
+    auto subscriber = batch.take_subscriber<Subscriber<uint64_t>>(subscriber_index).expect("Getting subscriber");
+
+    auto taken_twice = batch.take_publisher<Publisher<uint64_t>>(publisher_index);
+    ASSERT_TRUE(taken_twice.has_error());
+    EXPECT_THAT(taken_twice.error(), Eq(PortBatchError::PORT_NOT_AVAILABLE));
+
+    constexpr uint64_t DATA{42};
+    publisher->publishCopyOf(DATA).or_else([](const auto) { GTEST_FAIL() << "Expected to send data"; });
+    subscriber->take().and_then([&](const auto& sample) { EXPECT_THAT(*sample, Eq(DATA)); }).or_else([](const auto) {
+        GTEST_FAIL() << "Expected to receive data";
+    });
+}
+
 TEST(Node_test, NodeAndEndpointsAreContinuouslyRecreated)
 {
     ::testing::Test::RecordProperty("TEST_ID", "24d93901-0bd5-4458-bb53-7d40e4fb2964");
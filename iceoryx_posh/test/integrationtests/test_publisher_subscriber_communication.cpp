@@ -34,6 +34,8 @@
 
 #include "test.hpp"
 
+#include <chrono>
+
 namespace
 {
 using namespace ::testing;
@@ -754,6 +756,37 @@ TEST_F(PublisherSubscriberCommunication_test, PublisherUniqueIdMatchesReceivedSa
     }
 }
 
+TEST_F(PublisherSubscriberCommunication_test, ConnectLatencyFromSubscriberCreationToFirstSampleIsBelowDiscoveryInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e0047c7b-5e41-4c5e-9447-4526bca759ab");
+
+    constexpr uint64_t HISTORY{1U};
+    constexpr int TRANSMISSION_DATA{42};
+    auto publisher = createPublisher<int>(HISTORY);
+    ASSERT_FALSE(publisher->loan()
+                     .and_then([&](auto& sample) {
+                         *sample = TRANSMISSION_DATA;
+                         sample.publish();
+                     })
+                     .has_error());
+
+    const auto start = std::chrono::steady_clock::now();
+    auto subscriber = createSubscriber<int>(HISTORY);
+    bool hasReceivedSample{false};
+    while (!hasReceivedSample)
+    {
+        subscriber->take().and_then([&](auto& sample) {
+            EXPECT_THAT(*sample, Eq(TRANSMISSION_DATA));
+            hasReceivedSample = true;
+        });
+    }
+    const auto connectLatency = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+    ::testing::Test::RecordProperty("CONNECT_LATENCY_US", static_cast<int>(connectLatency));
+    EXPECT_THAT(connectLatency, Lt(roudi::DISCOVERY_INTERVAL.toMicroseconds() / 2U));
+}
+
 #ifdef TEST_WITH_HUGE_PAYLOAD
 
 TEST_F(PublisherSubscriberCommunicationWithBigPayload_test, SendingComplexDataType_BigPayloadStruct)
@@ -0,0 +1,128 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/publisher.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+#include "iox/atomic.hpp"
+#include "iox/deadline_timer.hpp"
+#include "iox/detail/convert.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::roudi_env;
+using namespace iox::units::duration_literals;
+
+IceoryxConfig configWithRuntimeMessageWorkers(const uint32_t workerCount)
+{
+    auto config = MinimalIceoryxConfigBuilder().create();
+    config.runtimeMessageWorkerCount = workerCount;
+    return config;
+}
+
+/// @brief registers a runtime, creates a publisher and a subscriber for the same topic and checks that a sample is
+/// delivered once RouDi connected the ports
+bool registerAndCommunicate(const uint64_t index)
+{
+    const auto name = convert::toString(index);
+    runtime::PoshRuntime::initRuntime(into<lossy<RuntimeName_t>>("storm_" + name));
+
+    const capro::ServiceDescription topic{"Storm", "Runtime", into<lossy<capro::IdString_t>>(name)};
+    popo::Publisher<uint64_t> publisher(topic);
+    popo::Subscriber<uint64_t> subscriber(topic);
+
+    deadline_timer timeout{5_s};
+    while (subscriber.getSubscriptionState() != SubscribeState::SUBSCRIBED)
+    {
+        if (timeout.hasExpired())
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    if (publisher.publishCopyOf(index).has_error())
+    {
+        return false;
+    }
+
+    auto sample = subscriber.take();
+    return !sample.has_error() && **sample == index;
+}
+
+class RouDiRuntimeMessageWorkers_test : public RouDi_GTest
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_WORKERS{4U};
+
+    RouDiRuntimeMessageWorkers_test()
+        : RouDi_GTest(configWithRuntimeMessageWorkers(NUMBER_OF_WORKERS))
+    {
+    }
+};
+
+TEST_F(RouDiRuntimeMessageWorkers_test, RuntimesRegisteringConcurrentlyAreAllServed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b486dabb-b820-4b41-9326-7038fd3aafe2");
+    constexpr uint64_t NUMBER_OF_RUNTIMES{3U * NUMBER_OF_WORKERS};
+
+    concurrent::Atomic<uint64_t> numberOfServedRuntimes{0U};
+    std::vector<std::thread> runtimes;
+    for (uint64_t i = 0U; i < NUMBER_OF_RUNTIMES; ++i)
+    {
+        runtimes.emplace_back([&numberOfServedRuntimes, i] {
+            if (registerAndCommunicate(i))
+            {
+                ++numberOfServedRuntimes;
+            }
+        });
+    }
+
+    for (auto& runtime : runtimes)
+    {
+        runtime.join();
+    }
+
+    EXPECT_THAT(numberOfServedRuntimes.load(), Eq(NUMBER_OF_RUNTIMES));
+}
+
+TEST(RouDiRuntimeMessageWorkersConfig_test, ZeroRuntimeMessageWorkersAreIncreasedToOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd29c809-23b3-4213-a2ff-c98668e6f206");
+    RouDiEnv roudiEnv(configWithRuntimeMessageWorkers(0U));
+
+    EXPECT_TRUE(registerAndCommunicate(0U));
+}
+
+TEST(RouDiRuntimeMessageWorkersConfig_test, TooManyRuntimeMessageWorkersAreReducedToTheMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d01eb55-2114-4d7d-8269-3c389850b12d");
+    RouDiEnv roudiEnv(configWithRuntimeMessageWorkers(roudi::MAX_RUNTIME_MESSAGE_WORKERS + 1U));
+
+    EXPECT_TRUE(registerAndCommunicate(0U));
+}
+
+} // namespace
@@ -30,6 +30,7 @@
 #include "iox/atomic.hpp"
 #include "test.hpp"
 
+#include <chrono>
 #include <random>
 #include <set>
 #include <type_traits>
@@ -245,6 +246,27 @@ TYPED_TEST(ServiceDiscovery_test, ServiceOfferedMultipleTimesCanBeFound)
     EXPECT_THAT(serviceContainer[0], Eq(SERVICE_DESCRIPTION));
 }
 
+TYPED_TEST(ServiceDiscovery_test, CreatedServiceIsFoundWithoutWaitingForThePeriodicDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7596ef2b-5925-43cb-a04a-d0ad1105d458");
+    const iox::capro::ServiceDescription SERVICE_DESCRIPTION("service", "instance", "event");
+
+    const auto start = std::chrono::steady_clock::now();
+    typename TestFixture::CommunicationKind::Producer producer(SERVICE_DESCRIPTION);
+
+    // the creation of the port triggers a discovery run which publishes the service registry
+    this->findService(SERVICE_DESCRIPTION);
+    while (serviceContainer.empty())
+    {
+        this->m_waitset.wait();
+        this->findService(SERVICE_DESCRIPTION);
+    }
+    const auto discoveryLatency = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+    EXPECT_THAT(discoveryLatency, Lt(iox::roudi::DISCOVERY_INTERVAL.toMicroseconds() / 2U));
+}
+
 //
 // Notification Tests
 // Check whether attaching, notification and detaching of waitset and listener works
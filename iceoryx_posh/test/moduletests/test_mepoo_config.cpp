@@ -118,6 +118,25 @@ TEST_F(MePooConfig_Test, OptimizeMethodCombinesTwoMempoolWithSameSizeAndDoublesT
     EXPECT_THAT(sut.m_mempoolConfig[0].m_chunkCount, Eq(CHUNK_COUNT * 2U));
 }
 
+TEST_F(MePooConfig_Test, OptimizeMethodKeepsTheExplicitNumaPlacementWhenCombiningMempoolsWithSameSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "05e84d4e-fd74-489c-a751-19da6e9f8a80");
+    MePooConfig sut;
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint64_t SIZE_1{64U};
+    constexpr uint64_t SIZE_2{128U};
+    constexpr uint32_t NUMA_NODE{1U};
+    sut.addMemPool({SIZE_1, CHUNK_COUNT});
+    sut.addMemPool({SIZE_1, CHUNK_COUNT, 0U, iox::NumaPlacement::bindToNode(NUMA_NODE)});
+    sut.addMemPool({SIZE_2, CHUNK_COUNT, 0U, iox::NumaPlacement::interleave()});
+
+    sut.optimize();
+
+    ASSERT_THAT(sut.m_mempoolConfig.size(), Eq(2U));
+    EXPECT_THAT(sut.m_mempoolConfig[0].m_numaPlacement, Eq(iox::NumaPlacement::bindToNode(NUMA_NODE)));
+    EXPECT_THAT(sut.m_mempoolConfig[1].m_numaPlacement, Eq(iox::NumaPlacement::interleave()));
+}
+
 TEST_F(MePooConfig_Test, OptimizeMethodRemovesTheMempoolWithSizeZeroInTheMemPoolConfigContainer)
 {
     ::testing::Test::RecordProperty("TEST_ID", "56209c3e-8b69-45cd-8ea5-ef347152ff7c");
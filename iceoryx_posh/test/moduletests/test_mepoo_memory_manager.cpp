@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/testing/mocks/logger_mock.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
@@ -26,6 +27,8 @@
 #include "iceoryx_hoofs/testing/fatal_failure.hpp"
 #include "test.hpp"
 
+#include <cstring>
+
 namespace
 {
 using namespace ::testing;
@@ -377,6 +380,89 @@ TEST_F(MemoryManager_test, emptyMemPoolDoesNotResultInAcquiringChunksFromOtherMe
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
 }
 
+TEST_F(MemoryManager_test, emptyMemPoolResultsInAcquiringChunksFromNextLargerMemPoolWithFallbackPolicy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e7ee0fb-217a-4a46-8647-12834c83b3b5");
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+    sut->getChunk(chunkSettings_64)
+        .and_then([&](auto& chunk) {
+            EXPECT_THAT(chunk.getChunkHeader()->chunkSize(), Eq(sut->getMemPoolInfo(2).m_chunkSize));
+            EXPECT_THAT(chunk.getChunkHeader()->userPayloadSize(), Eq(CHUNK_SIZE_64));
+        })
+        .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, fallbackPolicyDoesNotAcquireChunksFromSmallerMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "28377ac7-b210-44cb-8b30-b8e52ecb0091");
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_64)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, getChunkSelectsTheSmallestFittingMemPoolWhenMultipleMemPoolsShareASizeClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d192d12-4bb9-4a65-b7af-2037ceae61eb");
+    constexpr uint32_t CHUNK_COUNT{2};
+    constexpr uint64_t PAYLOAD_SIZE_STEP{32U};
+    constexpr uint64_t MAX_PAYLOAD_SIZE{512U};
+
+    for (uint64_t payloadSize = PAYLOAD_SIZE_STEP; payloadSize <= MAX_PAYLOAD_SIZE; payloadSize += PAYLOAD_SIZE_STEP)
+    {
+        mempoolconf.addMemPool({payloadSize, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint64_t userPayloadSize = 0U; userPayloadSize <= MAX_PAYLOAD_SIZE; userPayloadSize += 7U)
+    {
+        auto chunkSettings =
+            iox::mepoo::ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+
+        uint64_t expectedChunkSize{0U};
+        for (uint32_t i = 0U; i < sut->getNumberOfMemPools(); ++i)
+        {
+            if (sut->getMemPoolInfo(i).m_chunkSize >= chunkSettings.requiredChunkSize())
+            {
+                expectedChunkSize = sut->getMemPoolInfo(i).m_chunkSize;
+                break;
+            }
+        }
+
+        sut->getChunk(chunkSettings)
+            .and_then([&](auto& chunk) { EXPECT_THAT(chunk.getChunkHeader()->chunkSize(), Eq(expectedChunkSize)); })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+}
+
 TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0eddc5b5-e28f-43df-9da7-2c12014284a5");
@@ -435,6 +521,87 @@ TEST_F(MemoryManager_test, getChunkWithUserPayloadSizeZeroShouldNotFail)
     });
 }
 
+TEST_F(MemoryManager_test, freeChunkWithEmbeddedChunkManagementSingleMemPoolFullToEmptyToFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "675b9b5c-4132-45d7-803a-a9d94fb9bb56");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    mempoolconf.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::EMBEDDED;
+
+    // chunks are freed when they go out of scope
+    {
+        mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+        sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+        auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_128);
+
+        EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, CHUNK_COUNT);
+    }
+
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_128);
+
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, CHUNK_COUNT);
+}
+
+TEST_F(MemoryManager_test, getChunkWithEmbeddedChunkManagementPlacesTheChunkManagementInFrontOfTheChunkHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d98617e8-2277-4dab-8ee2-2c165c196992");
+    mempoolconf.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::EMBEDDED;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 1U});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, 1U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(1U, chunkSettings_128);
+    ASSERT_THAT(chunkStore.size(), Eq(1U));
+    auto* chunkHeader = chunkStore.front().getChunkHeader();
+
+    EXPECT_THAT(chunkHeader->chunkSize(), Eq(sut->getMemPoolInfo(1U).m_chunkSize));
+    EXPECT_THAT(chunkHeader->userPayloadSize(), Eq(CHUNK_SIZE_128));
+    std::memset(chunkHeader->userPayload(), 0xFF, CHUNK_SIZE_128);
+
+    auto* chunkManagement = chunkStore.front().release();
+    EXPECT_TRUE(chunkManagement->isEmbedded());
+    EXPECT_THAT(static_cast<void*>(chunkManagement), Lt(static_cast<void*>(chunkHeader)));
+    EXPECT_THAT(chunkManagement->m_chunkHeader.get(), Eq(chunkHeader));
+    EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(1U));
+
+    iox::mepoo::MemoryManager::freeChunk(*chunkManagement);
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, embeddedChunkManagementReportsTheSameChunkSizeAsTheSeparatePool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "744bdcfa-e1a0-48cc-aad5-f987a69b1028");
+    mempoolconf.addMemPool({CHUNK_SIZE_64, 10U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::MePooConfig embeddedConfig = mempoolconf;
+    embeddedConfig.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::EMBEDDED;
+    iox::mepoo::MemoryManager embeddedSut;
+    embeddedSut.configureMemoryManager(embeddedConfig, *allocator, *allocator);
+
+    EXPECT_THAT(embeddedSut.getMemPoolInfo(0U).m_chunkSize, Eq(sut->getMemPoolInfo(0U).m_chunkSize));
+}
+
+TEST_F(MemoryManager_test, embeddedChunkManagementMovesTheManagementMemoryIntoTheChunkMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cb532227-86b4-4946-a46b-7df43118ea5d");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+
+    iox::mepoo::MePooConfig embeddedConfig = mempoolconf;
+    embeddedConfig.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::EMBEDDED;
+
+    using iox::mepoo::MemoryManager;
+    EXPECT_THAT(MemoryManager::requiredManagementMemorySize(embeddedConfig),
+                Lt(MemoryManager::requiredManagementMemorySize(mempoolconf)));
+    EXPECT_THAT(MemoryManager::requiredChunkMemorySize(embeddedConfig),
+                Ge(MemoryManager::requiredChunkMemorySize(mempoolconf)
+                   + 2U * CHUNK_COUNT * sizeof(iox::mepoo::ChunkManagement)));
+}
+
 TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
 {
     ::testing::Test::RecordProperty("TEST_ID", "be653b65-a2d1-42eb-98b5-d161c6ba7c08");
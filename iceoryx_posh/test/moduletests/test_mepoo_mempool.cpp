@@ -16,6 +16,9 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_platform/mman.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/bump_allocator.hpp"
@@ -25,6 +28,9 @@
 #include "iceoryx_hoofs/testing/fatal_failure.hpp"
 #include "test.hpp"
 
+#include <thread>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -316,4 +322,189 @@ TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsNotPowerOf32)
                              iox::PoshError::MEPOO__MEMPOOL_CHUNKSIZE_MUST_BE_MULTIPLE_OF_CHUNK_MEMORY_ALIGNMENT);
 }
 
+class MemPoolWithThreadCache_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_CHUNKS{100U};
+    static constexpr uint64_t CHUNK_SIZE{64U};
+    static constexpr uint32_t THREAD_CACHE_CAPACITY{8U};
+
+    static constexpr uint64_t MEMORY_SIZE{NUMBER_OF_CHUNKS * CHUNK_SIZE
+                                          + iox::mepoo::MemPool::freeList_t::requiredIndexMemorySize(NUMBER_OF_CHUNKS)
+                                          + 10000U};
+
+    MemPoolWithThreadCache_test()
+        : m_rawMemory(MEMORY_SIZE + MemPool::requiredThreadCacheMemorySize(THREAD_CACHE_CAPACITY))
+        , allocator(m_rawMemory.data(), m_rawMemory.size())
+        , sut(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, THREAD_CACHE_CAPACITY)
+    {
+    }
+
+    uint32_t acquireAllChunks(std::vector<void*>& chunks)
+    {
+        for (auto* chunk = sut.getChunk(); chunk != nullptr; chunk = sut.getChunk())
+        {
+            chunks.push_back(chunk);
+        }
+        return static_cast<uint32_t>(chunks.size());
+    }
+
+    void releaseAllChunks(std::vector<void*>& chunks)
+    {
+        for (auto* chunk : chunks)
+        {
+            sut.freeChunk(chunk);
+        }
+        chunks.clear();
+    }
+
+    std::vector<uint8_t> m_rawMemory;
+    iox::BumpAllocator allocator;
+
+    MemPool sut;
+};
+
+TEST_F(MemPoolWithThreadCache_test, ThreadCacheCapacityIsSetCorrectly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "05d6db81-00e5-4862-9e02-3324b5fde3eb");
+    EXPECT_THAT(sut.getThreadCacheCapacity(), Eq(THREAD_CACHE_CAPACITY));
+}
+
+TEST_F(MemPoolWithThreadCache_test, NoMemoryIsRequiredWhenThreadCacheIsDisabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c60822a1-d652-453a-ae5f-043faedff693");
+    EXPECT_THAT(MemPool::requiredThreadCacheMemorySize(MemPool::NO_THREAD_CACHE), Eq(0U));
+    EXPECT_THAT(MemPool::requiredThreadCacheMemorySize(THREAD_CACHE_CAPACITY), Gt(0U));
+}
+
+TEST_F(MemPoolWithThreadCache_test, AllChunksCanBeAcquiredAndReleasedWithThreadCache)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "870f94db-a0ec-4831-bdc1-00b74fe9bc81");
+    std::vector<void*> chunks;
+
+    for (uint32_t i = 0U; i < 3U; ++i)
+    {
+        EXPECT_THAT(acquireAllChunks(chunks), Eq(NUMBER_OF_CHUNKS));
+        EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+        releaseAllChunks(chunks);
+        EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    }
+}
+
+TEST_F(MemPoolWithThreadCache_test, ChunksCachedByTerminatedThreadAreAvailableForOtherThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7ca3f5c-d660-4f74-a6c4-14074d769cc8");
+
+    std::thread t([&] {
+        auto* chunk = sut.getChunk();
+        ASSERT_THAT(chunk, Ne(nullptr));
+        sut.freeChunk(chunk);
+    });
+    t.join();
+
+    std::vector<void*> chunks;
+    EXPECT_THAT(acquireAllChunks(chunks), Eq(NUMBER_OF_CHUNKS));
+    releaseAllChunks(chunks);
+}
+
+TEST_F(MemPoolWithThreadCache_test, ChunksCachedByCurrentThreadAreAvailableForOtherThreadsAfterRelease)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "61256fd3-e359-474a-b274-19a1d6fa8feb");
+
+    auto* chunk = sut.getChunk();
+    ASSERT_THAT(chunk, Ne(nullptr));
+    sut.freeChunk(chunk);
+
+    uint32_t numberOfChunksWithCachedChunks{0U};
+    std::thread t1([&] {
+        std::vector<void*> chunks;
+        numberOfChunksWithCachedChunks = acquireAllChunks(chunks);
+        releaseAllChunks(chunks);
+    });
+    t1.join();
+
+    EXPECT_THAT(numberOfChunksWithCachedChunks, Lt(NUMBER_OF_CHUNKS));
+
+    MemPool::releaseThreadCachesOfCurrentProcess();
+
+    uint32_t numberOfChunksAfterRelease{0U};
+    std::thread t2([&] {
+        std::vector<void*> chunks;
+        numberOfChunksAfterRelease = acquireAllChunks(chunks);
+        releaseAllChunks(chunks);
+    });
+    t2.join();
+
+    EXPECT_THAT(numberOfChunksAfterRelease, Eq(NUMBER_OF_CHUNKS));
+}
+
+#if !defined(_WIN32)
+TEST_F(MemPoolWithThreadCache_test, ReleasingThreadCachesOfTerminatedProcessReturnsCachedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a36579ba-020b-4367-84e4-075e2d758c43");
+
+    // the mempool and its chunks are shared with a child process which terminates while chunks are in its thread cache
+    const uint64_t memorySize = MEMORY_SIZE + MemPool::requiredThreadCacheMemorySize(THREAD_CACHE_CAPACITY);
+    const uint64_t mappingSize = sizeof(MemPool) + memorySize;
+    auto* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    ASSERT_THAT(mapping, Ne(MAP_FAILED));
+
+    iox::BumpAllocator sharedAllocator(static_cast<uint8_t*>(mapping) + sizeof(MemPool), memorySize);
+    auto* sharedMemPool = new (mapping)
+        MemPool(CHUNK_SIZE, NUMBER_OF_CHUNKS, sharedAllocator, sharedAllocator, THREAD_CACHE_CAPACITY);
+
+    auto childPid = fork();
+    ASSERT_THAT(childPid, Ne(-1));
+    if (childPid == 0)
+    {
+        auto* chunk = sharedMemPool->getChunk();
+        if (chunk != nullptr)
+        {
+            sharedMemPool->freeChunk(chunk);
+        }
+        // terminate without running any cleanup in order to leave the chunk in the thread cache
+        _exit((chunk != nullptr) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    int status{0};
+    ASSERT_THAT(waitpid(childPid, &status, 0), Eq(childPid));
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_THAT(WEXITSTATUS(status), Eq(EXIT_SUCCESS));
+
+    std::vector<void*> chunks;
+    for (auto* chunk = sharedMemPool->getChunk(); chunk != nullptr; chunk = sharedMemPool->getChunk())
+    {
+        chunks.push_back(chunk);
+    }
+    EXPECT_THAT(chunks.size(), Lt(NUMBER_OF_CHUNKS));
+
+    sharedMemPool->releaseThreadCachesOfProcess(static_cast<uint32_t>(childPid));
+
+    for (auto* chunk = sharedMemPool->getChunk(); chunk != nullptr; chunk = sharedMemPool->getChunk())
+    {
+        chunks.push_back(chunk);
+    }
+    EXPECT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS));
+
+    for (auto* chunk : chunks)
+    {
+        sharedMemPool->freeChunk(chunk);
+    }
+    sharedMemPool->~MemPool();
+    EXPECT_THAT(munmap(mapping, mappingSize), Eq(0));
+}
+#endif
+
+TEST_F(MemPoolWithThreadCache_test, DieWhenThreadCacheCapacityExceedsMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4692d4f-bd4b-40e4-92d4-3ebaca00dff3");
+
+    IOX_EXPECT_FATAL_FAILURE(
+        [&] {
+            iox::mepoo::MemPool sut(
+                CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, iox::MAX_MEMPOOL_THREAD_CACHE_CAPACITY + 1U);
+        },
+        iox::er::ENFORCE_VIOLATION);
+}
+
 } // namespace
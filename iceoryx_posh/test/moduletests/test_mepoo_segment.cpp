@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/mepoo_segment.hpp"
 #include "iox/bump_allocator.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/expected.hpp"
 #include "iox/posix_group.hpp"
 #include "iox/posix_shared_memory_object.hpp"
@@ -56,9 +57,17 @@ class MePooSegment_test : public Test
                                 const AccessMode accessMode,
                                 const OpenMode openMode,
                                 const void* baseAddressHint,
-                                const iox::access_rights permissions)
+                                const iox::access_rights permissions,
+                                const bool hugePages,
+                                const bool prefault,
+                                const bool lockMemory,
+                                const iox::NumaPlacement numaPlacement)
             : m_memorySizeInBytes(memorySizeInBytes)
             , m_baseAddressHint(const_cast<void*>(baseAddressHint))
+            , m_hugePages(hugePages)
+            , m_prefault(prefault)
+            , m_lockMemory(lockMemory)
+            , m_numaPlacement(numaPlacement)
         {
             if (createVerificator)
             {
@@ -87,8 +96,18 @@ class MePooSegment_test : public Test
             return &memory[0];
         }
 
+        uint64_t getPageSize() const
+        {
+            return m_hugePages ? HUGE_PAGE_SIZE : iox::detail::pageSize();
+        }
+
+        static constexpr uint64_t HUGE_PAGE_SIZE{2U << 20U};
         uint64_t m_memorySizeInBytes{0};
         void* m_baseAddressHint{nullptr};
+        bool m_hugePages{false};
+        bool m_prefault{false};
+        bool m_lockMemory{false};
+        iox::NumaPlacement m_numaPlacement;
         static constexpr int MEM_SIZE = 100000;
         alignas(8) char memory[MEM_SIZE];
         shm_handle_t filehandle;
@@ -109,6 +128,14 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::access_rights, permissions, iox::perms::none)
 
+        IOX_BUILDER_PARAMETER(bool, hugePages, false)
+
+        IOX_BUILDER_PARAMETER(bool, prefault, false)
+
+        IOX_BUILDER_PARAMETER(bool, lockMemory, false)
+
+        IOX_BUILDER_PARAMETER(iox::NumaPlacement, numaPlacement, iox::NumaPlacement())
+
       public:
         iox::expected<SharedMemoryObject_MOCK, PosixSharedMemoryObjectError> create() noexcept
         {
@@ -117,7 +144,11 @@ class MePooSegment_test : public Test
                                                    m_accessMode,
                                                    m_openMode,
                                                    (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
-                                                   m_permissions));
+                                                   m_permissions,
+                                                   m_hugePages,
+                                                   m_prefault,
+                                                   m_lockMemory,
+                                                   m_numaPlacement));
         }
     };
 
@@ -135,6 +166,14 @@ class MePooSegment_test : public Test
     MePooConfig mepooConfig = setupMepooConfig();
 
     using SUT = MePooSegment<SharedMemoryObject_MOCK, MemoryManager>;
+
+    class SutWithAccessToSharedMemoryObject : public SUT
+    {
+      public:
+        using SUT::SUT;
+        using SUT::m_sharedMemoryObject;
+    };
+
     std::unique_ptr<SUT> createSut()
     {
         return std::make_unique<SUT>(mepooConfig,
@@ -187,6 +226,79 @@ TEST_F(MePooSegment_test, GetSegmentSize)
     EXPECT_THAT(sut->getSegmentSize(), Eq(MemoryManager::requiredChunkMemorySize(mepooConfig)));
 }
 
+TEST_F(MePooSegment_test, GetPageSizeWithoutHugePagesReturnsSystemPageSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0fb616a4-ab94-4d21-9357-026b3d277e24");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    auto sut = createSut();
+    EXPECT_THAT(sut->getPageSize(), Eq(iox::detail::pageSize()));
+}
+
+TEST_F(MePooSegment_test, GetPageSizeWithHugePagesReturnsHugePageSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a67dc805-84df-4c01-b764-4c673c67bafe");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SUT sut{mepooConfig,
+            DEFAULT_DOMAIN_ID,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            iox::mepoo::MemoryInfo(),
+            true};
+    EXPECT_THAT(sut.getPageSize(), Eq(SharedMemoryObject_MOCK::HUGE_PAGE_SIZE));
+}
+
+TEST_F(MePooSegment_test, SegmentIsNotPrefaultedByDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e9a8d84-0c04-4b61-bb8f-b6f7551127dc");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SutWithAccessToSharedMemoryObject sut{mepooConfig,
+                                          DEFAULT_DOMAIN_ID,
+                                          m_managementAllocator,
+                                          PosixGroup{"iox_roudi_test1"},
+                                          PosixGroup{"iox_roudi_test2"}};
+    EXPECT_FALSE(sut.m_sharedMemoryObject.m_prefault);
+    EXPECT_FALSE(sut.m_sharedMemoryObject.m_lockMemory);
+}
+
+TEST_F(MePooSegment_test, SegmentWithPrefaultAndLockResidencyIsPrefaultedAndLocked)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "22b23513-a374-4638-99b5-2d66bb7994c0");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SutWithAccessToSharedMemoryObject sut{mepooConfig,
+                                          DEFAULT_DOMAIN_ID,
+                                          m_managementAllocator,
+                                          PosixGroup{"iox_roudi_test1"},
+                                          PosixGroup{"iox_roudi_test2"},
+                                          iox::mepoo::MemoryInfo(),
+                                          false,
+                                          iox::roudi::MemoryResidency::PREFAULT_AND_LOCK};
+    EXPECT_TRUE(sut.m_sharedMemoryObject.m_prefault);
+    EXPECT_TRUE(sut.m_sharedMemoryObject.m_lockMemory);
+}
+
+TEST_F(MePooSegment_test, SegmentIsCreatedWithTheConfiguredNumaPlacement)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "93719d91-921d-4f63-ab44-480b3a885c19");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    constexpr uint32_t NUMA_NODE{1U};
+    SutWithAccessToSharedMemoryObject sut{mepooConfig,
+                                          DEFAULT_DOMAIN_ID,
+                                          m_managementAllocator,
+                                          PosixGroup{"iox_roudi_test1"},
+                                          PosixGroup{"iox_roudi_test2"},
+                                          iox::mepoo::MemoryInfo(),
+                                          false,
+                                          iox::roudi::MemoryResidency::OFF,
+                                          iox::NumaPlacement::bindToNode(NUMA_NODE)};
+    EXPECT_THAT(sut.m_sharedMemoryObject.m_numaPlacement, Eq(iox::NumaPlacement::bindToNode(NUMA_NODE)));
+}
+
 TEST_F(MePooSegment_test, GetReaderGroup)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ad3fd360-3765-45ae-8285-fe4ae60c91ae");
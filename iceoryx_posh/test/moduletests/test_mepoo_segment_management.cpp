@@ -16,6 +16,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/testing/test_definitions.hpp"
+#include "iceoryx_platform/mman.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
@@ -45,7 +47,10 @@ class MePooSegmentMock
                      iox::BumpAllocator& managementAllocator [[maybe_unused]],
                      const PosixGroup& readerGroup [[maybe_unused]],
                      const PosixGroup& writerGroup [[maybe_unused]],
-                     const MemoryInfo& memoryInfo [[maybe_unused]]) noexcept
+                     const MemoryInfo& memoryInfo [[maybe_unused]],
+                     const bool useHugePages [[maybe_unused]],
+                     const iox::roudi::MemoryResidency memoryResidency [[maybe_unused]],
+                     const iox::NumaPlacement numaPlacement [[maybe_unused]]) noexcept
     {
     }
 };
@@ -130,6 +135,18 @@ TEST_F(SegmentManager_test, getSegmentMappingsForWriteUser)
     EXPECT_THAT(mapping[0].m_isWritable == mapping[1].m_isWritable, Eq(false));
 }
 
+TEST_F(SegmentManager_test, getSegmentMappingsContainsMemoryResidencyOfSegmentManager)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c03ab946-375d-46a1-91ce-6ea22ee0a0c9");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SUT sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator, iox::roudi::MemoryResidency::PREFAULT};
+    auto mapping = sut.getSegmentMappings(PosixUser{"iox_roudi_test2"});
+    ASSERT_THAT(mapping.size(), Eq(2u));
+    EXPECT_THAT(mapping[0].m_memoryResidency, Eq(iox::roudi::MemoryResidency::PREFAULT));
+    EXPECT_THAT(mapping[1].m_memoryResidency, Eq(iox::roudi::MemoryResidency::PREFAULT));
+}
+
 TEST_F(SegmentManager_test, getSegmentMappingsEmptyForNonRegisteredUser)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7cf9a658-bb2d-444f-af67-0355e8f45ea2");
@@ -207,4 +224,34 @@ TEST_F(SegmentManager_test, addingMaximumNumberOfSegmentsWorks)
     SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
 }
 
+TEST_F(SegmentManager_test, chunkOfEmbeddedLayoutCanBeReleasedWithReadOnlyMappedSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "118855d6-ca48-4b5a-a92b-62aacf9f212c");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    mepooConfig.m_chunkManagementLayout = ChunkManagementLayout::EMBEDDED;
+    SegmentConfig segmentConfig;
+    segmentConfig.m_sharedMemorySegments.push_back({"iox_roudi_test1", "iox_roudi_test2", mepooConfig});
+    SUT sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+
+    auto memoryManager = sut.getSegmentInformationWithWriteAccessForUser(PosixUser{"iox_roudi_test2"}).m_memoryManager;
+    ASSERT_TRUE(memoryManager.has_value());
+    auto chunkSettings = ChunkSettings::create(64U, 8U).expect("valid chunk settings");
+    auto chunk = memoryManager.value().get().getChunk(chunkSettings).expect("chunk available");
+
+    // a subscriber of the reader group maps the payload segment read only
+    auto mapping = sut.getSegmentMappings(PosixUser{"iox_roudi_test1"});
+    ASSERT_THAT(mapping.size(), Eq(1U));
+    ASSERT_FALSE(mapping[0].m_isWritable);
+    auto* payloadSegment = UntypedRelativePointer::getBasePtr(segment_id_t{mapping[0].m_segmentId});
+    ASSERT_THAT(mprotect(payloadSegment, mapping[0].m_size, PROT_READ), Eq(0));
+
+    auto* chunkManagement = chunk.release();
+    EXPECT_FALSE(chunkManagement->isEmbedded());
+    MemoryManager::freeChunk(*chunkManagement);
+    EXPECT_THAT(memoryManager.value().get().getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+
+    ASSERT_THAT(mprotect(payloadSegment, mapping[0].m_size, PROT_READ | PROT_WRITE), Eq(0));
+}
+
 } // namespace
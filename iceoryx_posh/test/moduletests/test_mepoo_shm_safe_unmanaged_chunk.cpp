@@ -25,6 +25,8 @@
 
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -301,4 +303,57 @@ TEST_F(ShmSafeUnmanagedChunk_test,
     EXPECT_FALSE(sut.isNotLogicalNullptrAndHasNoOtherOwners());
 }
 
+TEST_F(ShmSafeUnmanagedChunk_test, ConstructedWithReservedReferenceDoesNotChangeOwnershipOfSharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "96c2b343-911d-461b-bc99-e2b88227c733");
+    auto sharedChunk = getChunkFromMemoryManager();
+    sharedChunk.reserveReferences(1U);
+
+    ShmSafeUnmanagedChunk sut(sharedChunk, AdoptReservedReference);
+
+    EXPECT_TRUE(sharedChunk);
+    EXPECT_THAT(sut.getChunkHeader(), Eq(sharedChunk.getChunkHeader()));
+    EXPECT_FALSE(sut.isNotLogicalNullptrAndHasNoOtherOwners());
+
+    sharedChunk = SharedChunk();
+
+    EXPECT_TRUE(sut.isNotLogicalNullptrAndHasNoOtherOwners());
+
+    sut.releaseToSharedChunk();
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, ReleasingAllReservedReferencesReturnsChunkToMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "284d43bd-3962-42d6-ad67-ace0fb40670d");
+    constexpr uint64_t NUMBER_OF_RESERVED_REFERENCES{3U};
+    auto sharedChunk = getChunkFromMemoryManager();
+    sharedChunk.reserveReferences(NUMBER_OF_RESERVED_REFERENCES);
+
+    std::vector<ShmSafeUnmanagedChunk> suts;
+    for (uint64_t i = 0U; i < NUMBER_OF_RESERVED_REFERENCES; ++i)
+    {
+        suts.emplace_back(sharedChunk, AdoptReservedReference);
+    }
+    sharedChunk = SharedChunk();
+
+    for (auto& sut : suts)
+    {
+        EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+        sut.releaseToSharedChunk();
+    }
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, ReservingZeroReferencesDoesNotChangeOwnership)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "de4da77e-53d6-4bf9-92e3-7e6e68a231f0");
+    auto sharedChunk = getChunkFromMemoryManager();
+    sharedChunk.reserveReferences(0U);
+
+    sharedChunk = SharedChunk();
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
 } // namespace
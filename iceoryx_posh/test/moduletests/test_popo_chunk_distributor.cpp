@@ -17,12 +17,15 @@
 
 #include "iceoryx_hoofs/testing/barrier.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_platform/mman.hpp"
+#include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
@@ -34,7 +37,9 @@
 #include "iceoryx_hoofs/testing/fatal_failure.hpp"
 #include "test.hpp"
 
+#include <chrono>
 #include <memory>
+#include <thread>
 
 namespace
 {
@@ -485,6 +490,106 @@ TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesMult
     EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesReleasesAllReferencesWhenConsumed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8010348d-f2e7-4e9d-bbc2-b7c9f3f96ae4");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 10U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(73)), Eq(NUMBER_OF_QUEUES));
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1U));
+
+    sut.clearHistory();
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1U));
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData[i].get()).clear();
+    }
+
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(this->chunkMgmtPool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithOverflowingQueuesReleasesAllReferencesWhenConsumed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a38568bb-a4f9-4b69-a3eb-8131c157b9ce");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    // the FiFo does not support to change the capacity, therefore it is filled up to its full capacity
+    constexpr uint64_t FIFO_CAPACITY = TestFixture::MAX_NUMBER_QUEUES;
+    constexpr uint64_t SOFI_CAPACITY = 2U;
+    constexpr uint64_t NUMBER_OF_CHUNKS = FIFO_CAPACITY + 3U;
+    auto sofiQueueData = this->getChunkQueueData(QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                 VariantQueueTypes::SoFi_SingleProducerSingleConsumer);
+    auto fifoQueueData = this->getChunkQueueData(QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                 VariantQueueTypes::FiFo_SingleProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> sofiQueue(sofiQueueData.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> fifoQueue(fifoQueueData.get());
+    sofiQueue.setCapacity(SOFI_CAPACITY);
+    ASSERT_FALSE(sut.tryAddQueue(sofiQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(fifoQueueData.get()).has_error());
+
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(i)), Eq(2U));
+    }
+    sut.clearHistory();
+
+    // the FiFo holds the oldest and the SoFi the newest chunks
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(FIFO_CAPACITY + SOFI_CAPACITY));
+
+    sofiQueue.clear();
+    fifoQueue.clear();
+
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(this->chunkMgmtPool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWakesUpSharedConditionVariableOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8bcba90-cef0-4e88-bea2-0e06bf1db7e3");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    ConditionVariableData sharedCondVar("Horscht");
+    ConditionVariableData exclusiveCondVar("Schnuppi");
+    ConditionListener sharedCondVarListener{sharedCondVar};
+
+    constexpr uint64_t NUMBER_OF_QUEUES_WITH_SHARED_CONDITION_VARIABLE = 3U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUES_WITH_SHARED_CONDITION_VARIABLE; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.back().get())
+            .setConditionVariable(sharedCondVar, i);
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+    queueData.emplace_back(this->getChunkQueueData());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.back().get())
+        .setConditionVariable(exclusiveCondVar, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    queueData.emplace_back(this->getChunkQueueData());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(42U)), Eq(queueData.size()));
+
+    EXPECT_THAT(sharedCondVar.m_numberOfNotifications.load(), Eq(NUMBER_OF_QUEUES_WITH_SHARED_CONDITION_VARIABLE));
+    EXPECT_THAT(sharedCondVar.m_numberOfWakeUps.load(), Eq(1U));
+    EXPECT_THAT(exclusiveCondVar.m_numberOfNotifications.load(), Eq(1U));
+    EXPECT_THAT(exclusiveCondVar.m_numberOfWakeUps.load(), Eq(1U));
+    EXPECT_THAT(sharedCondVarListener.timedWait(iox::units::Duration::fromMilliseconds(1U)).size(),
+                Eq(NUMBER_OF_QUEUES_WITH_SHARED_CONDITION_VARIABLE));
+}
+
 TYPED_TEST(ChunkDistributor_test, AddToHistoryWithoutQueues)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1ed709b1-9129-454b-8440-50463ba1c02e");
@@ -822,4 +927,241 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, BlockedDeliveryWaitsForFreeSlotAfterSpinPhase)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2bcb3665-86e6-49c2-a4a9-a13286cc8c51");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(42U));
+
+    iox::concurrent::Atomic<bool> wasChunkDelivered{false};
+    std::thread t1([&] {
+        sut.deliverToAllStoredQueues(this->allocateChunk(73U));
+        wasChunkDelivered = true;
+    });
+
+    // after the spin phase the producer sleeps until the consumer frees a slot
+    while (queueData->m_numberOfWaitingProducers.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(42U));
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    EXPECT_THAT(queueData->m_numberOfWaitingProducers.load(), Eq(0U));
+
+    maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(73U));
+}
+
+using ChunkDistributorLockFree_test = ChunkDistributor_test<LockFreePolicy>;
+
+TEST_F(ChunkDistributorLockFree_test, HistoryIsNotSupported)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ad0b7e8-b667-40f2-a20d-73b9a9ed7ef2");
+    auto sutData = getChunkDistributorData();
+    ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    sut.deliverToAllStoredQueues(allocateChunk(42U));
+
+    EXPECT_THAT(sut.getHistoryCapacity(), Eq(0U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
+TEST_F(ChunkDistributorLockFree_test, DeliverToAllStoredQueuesWithMultipleQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "187d7367-7ccb-4d3d-8593-6352a16c3c4e");
+    auto sutData = getChunkDistributorData();
+    ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 10U;
+    std::vector<std::shared_ptr<ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+    EXPECT_TRUE(sut.hasStoredQueues());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(allocateChunk(1337U)), Eq(NUMBER_OF_QUEUES));
+
+    for (auto& data : queueData)
+    {
+        auto maybeSharedChunk = ChunkQueuePopper<ChunkQueueData_t>(data.get()).tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_THAT(getSharedChunkValue(*maybeSharedChunk), Eq(1337U));
+    }
+}
+
+TEST_F(ChunkDistributorLockFree_test, RemovedQueueDoesNotReceiveChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29a12f16-fd76-4623-a0b2-7920a5bd62de");
+    auto sutData = getChunkDistributorData();
+    ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    EXPECT_THAT(sut.tryRemoveQueue(queueData.get()).error(), Eq(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER));
+    EXPECT_FALSE(sut.hasStoredQueues());
+    EXPECT_THAT(sut.deliverToAllStoredQueues(allocateChunk(73U)), Eq(0U));
+    EXPECT_FALSE(ChunkQueuePopper<ChunkQueueData_t>(queueData.get()).tryPop().has_value());
+}
+
+TEST_F(ChunkDistributorLockFree_test, DeliverToQueueWithAddedQueueDeliversChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f128e2ce-636f-4d65-9c8f-1434b01b2d1d");
+    auto sutData = getChunkDistributorData();
+    ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = getChunkQueueData();
+    auto otherQueueData = getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(otherQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    auto queueIndex = sut.getQueueIndex(queueData->m_uniqueId, 0U);
+    ASSERT_TRUE(queueIndex.has_value());
+    EXPECT_THAT(queueIndex.value(), Eq(1U));
+    EXPECT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, queueIndex.value(), allocateChunk(4451U)).has_error());
+
+    auto maybeSharedChunk = ChunkQueuePopper<ChunkQueueData_t>(queueData.get()).tryPop();
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_THAT(getSharedChunkValue(*maybeSharedChunk), Eq(4451U));
+    EXPECT_FALSE(ChunkQueuePopper<ChunkQueueData_t>(otherQueueData.get()).tryPop().has_value());
+}
+
+TEST_F(ChunkDistributorLockFree_test, ModifyingQueuesWhileDeliveringConcurrentlyDoesNotLeakChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "df176810-23f2-4f8f-be21-0f560a72c146");
+    auto sutData = getChunkDistributorData();
+    ChunkDistributor_t sut(sutData.get());
+
+    auto permanentQueueData = getChunkQueueData();
+    auto toggledQueueData = getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(permanentQueueData.get()).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{1000U};
+    Barrier isThreadStarted(1U);
+    std::thread sender([&] {
+        isThreadStarted.notify();
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            EXPECT_THAT(sut.deliverToAllStoredQueues(allocateChunk(i)), Ge(1U));
+        }
+    });
+
+    isThreadStarted.wait();
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS / 10U; ++i)
+    {
+        EXPECT_FALSE(sut.tryAddQueue(toggledQueueData.get()).has_error());
+        EXPECT_FALSE(sut.tryRemoveQueue(toggledQueueData.get()).has_error());
+    }
+    sender.join();
+
+    ChunkQueuePopper<ChunkQueueData_t>(permanentQueueData.get()).clear();
+    ChunkQueuePopper<ChunkQueueData_t>(toggledQueueData.get()).clear();
+
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkDistributorLockFree_test, CleanupReleasesQueueReaderOfTerminatedSender)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b684df8e-4ecd-47fc-8301-c3b3cbfe0ca4");
+    auto sutData = getChunkDistributorData();
+    ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // a sender which is terminated while delivering never leaves the queue set
+    using QueueReader_t = typename ChunkDistributorData_t::QueueReader;
+    alignas(QueueReader_t) uint8_t terminatedSenderMemory[sizeof(QueueReader_t)];
+    new (terminatedSenderMemory) QueueReader_t(*sutData);
+
+    sut.cleanup();
+
+    // the sender is registered with the pid of this process which is alive; without the cleanup the deadlock
+    // watchdog would fire
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+}
+
+TEST_F(ChunkDistributorLockFree_test, ModificationWaitsForStalledSender)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e7188f7-f8e1-4f59-8fa6-5a10172eacb4");
+    auto sutData = getChunkDistributorData();
+    ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    using QueueReader_t = typename ChunkDistributorData_t::QueueReader;
+    auto stalledSender = std::make_unique<QueueReader_t>(*sutData);
+
+    iox::concurrent::Atomic<bool> isQueueRemoved{false};
+    std::thread discovery([&] {
+        EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+        isQueueRemoved = true;
+    });
+
+    // a sender which is alive might still access the removed queue, independent of how long it takes
+    std::this_thread::sleep_for(BLOCKING_DURATION);
+    EXPECT_FALSE(isQueueRemoved.load());
+
+    stalledSender.reset();
+    discovery.join();
+    EXPECT_TRUE(isQueueRemoved.load());
+}
+
+#if !defined(_WIN32)
+TEST_F(ChunkDistributorLockFree_test, ModificationReleasesQueueSetOfTerminatedSender)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "40e30f43-d822-4af4-be35-c119ed6bb481");
+    auto* sharedMemory =
+        mmap(nullptr, sizeof(ChunkDistributorData_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    ASSERT_THAT(sharedMemory, Ne(MAP_FAILED));
+    auto* sutData = new (sharedMemory) ChunkDistributorData_t(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA);
+    ChunkDistributor_t sut(sutData);
+
+    auto queueData = getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // the child process is terminated while it is registered as reader of the active queue set
+    auto childPid = fork();
+    ASSERT_THAT(childPid, Ne(-1));
+    if (childPid == 0)
+    {
+        using QueueReader_t = typename ChunkDistributorData_t::QueueReader;
+        alignas(QueueReader_t) uint8_t terminatedSenderMemory[sizeof(QueueReader_t)];
+        new (terminatedSenderMemory) QueueReader_t(*sutData);
+        _exit(EXIT_SUCCESS);
+    }
+    int status{0};
+    ASSERT_THAT(waitpid(childPid, &status, 0), Eq(childPid));
+
+    // without the cleanup of the terminated sender; the deadlock watchdog fires if the modification waits for it
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_FALSE(sut.hasStoredQueues());
+
+    sutData->~ChunkDistributorData_t();
+    EXPECT_THAT(munmap(sharedMemory, sizeof(ChunkDistributorData_t)), Eq(0));
+}
+#endif
+
 } // namespace
@@ -30,6 +30,9 @@
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
 #include "test.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -259,6 +262,63 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, PushWithDeferredWakeUpSetsNotificationActiveWithoutWakeUp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "459cecd8-6e74-4cd5-8aa6-c12462bb38b3");
+    ConditionVariableData condVar("Horscht");
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    ConditionVariableData* attachedConditionVariable{nullptr};
+    EXPECT_TRUE(this->m_pusher.pushWithDeferredWakeUp(ShmSafeUnmanagedChunk(this->allocateChunk()),
+                                                      attachedConditionVariable));
+
+    EXPECT_THAT(attachedConditionVariable, Eq(&condVar));
+    EXPECT_TRUE(condVar.isNotificationActive(0U));
+    EXPECT_THAT(condVar.m_numberOfNotifications.load(), Eq(1U));
+    EXPECT_THAT(condVar.m_numberOfWakeUps.load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkQueue_test, PushWithDeferredWakeUpWithoutConditionVariableProvidesNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b74f7f01-026f-45ec-a40f-7cf6004ab562");
+    ConditionVariableData condVar("Horscht");
+    ConditionVariableData* attachedConditionVariable{&condVar};
+    EXPECT_TRUE(this->m_pusher.pushWithDeferredWakeUp(ShmSafeUnmanagedChunk(this->allocateChunk()),
+                                                      attachedConditionVariable));
+
+    EXPECT_THAT(attachedConditionVariable, Eq(nullptr));
+    EXPECT_FALSE(this->m_pusher.wakeUpIfAttachedTo(attachedConditionVariable));
+}
+
+TYPED_TEST(ChunkQueue_test, WakeUpIfAttachedToWakesUpAttachedConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5fbdd016-7c86-40a2-9fd9-bb115c2e29d6");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    ConditionVariableData* attachedConditionVariable{nullptr};
+    this->m_pusher.pushWithDeferredWakeUp(ShmSafeUnmanagedChunk(this->allocateChunk()), attachedConditionVariable);
+
+    EXPECT_TRUE(this->m_pusher.wakeUpIfAttachedTo(attachedConditionVariable));
+    EXPECT_THAT(condVar.m_numberOfWakeUps.load(), Eq(1U));
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+}
+
+TYPED_TEST(ChunkQueue_test, WakeUpIfAttachedToDoesNotWakeUpDetachedConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6fd2fc6e-db24-473e-97b9-2f7ac5909bf7");
+    ConditionVariableData condVar("Horscht");
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    ConditionVariableData* attachedConditionVariable{nullptr};
+    this->m_pusher.pushWithDeferredWakeUp(ShmSafeUnmanagedChunk(this->allocateChunk()), attachedConditionVariable);
+    this->m_popper.unsetConditionVariable();
+
+    EXPECT_FALSE(this->m_pusher.wakeUpIfAttachedTo(attachedConditionVariable));
+    EXPECT_THAT(condVar.m_numberOfWakeUps.load(), Eq(0U));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
 using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -323,6 +383,84 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+TYPED_TEST(ChunkQueueFiFo_test, PushOrWaitForSpaceDoesNotWaitWhenQueueHasNoBlockingPolicy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36887a7f-e48d-4fd7-ad93-dd80adab7f5f");
+    constexpr auto TIMEOUT = 10_s;
+    EXPECT_FALSE(this->m_chunkData.m_spaceAvailableSemaphore.has_value());
+
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(this->m_pusher.pushOrWaitForSpace(this->allocateChunk(), TIMEOUT));
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Lt(std::chrono::nanoseconds(TIMEOUT.toNanoseconds())));
+
+    this->m_popper.clear();
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, PushOrWaitForSpaceFailsAfterTimeoutWhenQueueStaysFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4251ec39-6ab5-4e70-b31e-e93a04e054db");
+    constexpr auto TIMEOUT = 10_ms;
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    ChunkQueueData_t chunkData{QueueFullPolicy::BLOCK_PRODUCER,
+                               iox::popo::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkQueuePusher<ChunkQueueData_t> pusher{&chunkData};
+    ChunkQueuePopper<ChunkQueueData_t> popper{&chunkData};
+    EXPECT_TRUE(chunkData.m_spaceAvailableSemaphore.has_value());
+
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(pusher.push(this->allocateChunk()));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(pusher.pushOrWaitForSpace(this->allocateChunk(), TIMEOUT));
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Ge(std::chrono::nanoseconds(TIMEOUT.toNanoseconds())));
+    EXPECT_THAT(chunkData.m_numberOfWaitingProducers.load(), Eq(0U));
+
+    popper.clear();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, PushOrWaitForSpaceIsWokenUpWhenConsumerPopsAChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a65ae5c0-0baa-4555-96b8-e3ec5adbac41");
+    constexpr auto TIMEOUT = 10_s;
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    ChunkQueueData_t chunkData{QueueFullPolicy::BLOCK_PRODUCER,
+                               iox::popo::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkQueuePusher<ChunkQueueData_t> pusher{&chunkData};
+    ChunkQueuePopper<ChunkQueueData_t> popper{&chunkData};
+
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(pusher.push(this->allocateChunk()));
+    }
+
+    auto chunk = this->allocateChunk();
+    auto start = std::chrono::steady_clock::now();
+    bool wasPushed{false};
+    std::thread producer([&] { wasPushed = pusher.pushOrWaitForSpace(chunk, TIMEOUT); });
+
+    while (chunkData.m_numberOfWaitingProducers.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(popper.tryPop().has_value());
+
+    producer.join();
+    EXPECT_TRUE(wasPushed);
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Lt(std::chrono::nanoseconds(TIMEOUT.toNanoseconds())));
+    EXPECT_THAT(popper.size(), Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+
+    popper.clear();
+}
+
+
 /// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
 using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
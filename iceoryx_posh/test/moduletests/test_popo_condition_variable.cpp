@@ -25,9 +25,15 @@
 #include "iox/atomic.hpp"
 #include "test.hpp"
 
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <type_traits>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <poll.h>
+#endif
 
 namespace
 {
@@ -137,7 +143,7 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
     ConditionVariableData sut;
     for (auto& notification : sut.m_activeNotifications)
     {
-        EXPECT_THAT(notification.load(), Eq(false));
+        EXPECT_THAT(notification.load(), Eq(0U));
     }
 }
 
@@ -152,7 +158,7 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRunt
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
     for (auto& notification : m_condVarData.m_activeNotifications)
     {
-        EXPECT_THAT(notification.load(), Eq(false));
+        EXPECT_THAT(notification.load(), Eq(0U));
     }
 }
 
@@ -166,11 +172,11 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i].load(), Eq(true));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i].load(), Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     }
 }
@@ -422,7 +428,7 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
         for (const auto& notification : m_condVarData.m_activeNotifications)
         {
-            EXPECT_THAT(notification.load(), Eq(false));
+            EXPECT_THAT(notification.load(), Eq(0U));
         }
     });
 
@@ -494,4 +500,291 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInReverseO
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+TEST_F(ConditionVariable_test, NotifyCountsNotificationAndWakeUp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d553d5f-7800-486a-9ad5-693837c88e96");
+    m_signaler.notify();
+
+    EXPECT_THAT(m_condVarData.m_numberOfNotifications.load(), Eq(1U));
+    EXPECT_THAT(m_condVarData.m_numberOfWakeUps.load(), Eq(1U));
+}
+
+TEST_F(ConditionVariable_test, WaitReturnsSortedNotificationsOfAllWordsAndResetsThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2652795b-0416-47eb-9fec-509b233194f8");
+    constexpr uint64_t LAST_INDEX = iox::MAX_NUMBER_OF_NOTIFIERS - 1U;
+    const std::vector<uint64_t> expectedIndices{
+        0U, 1U, ConditionVariableData::NOTIFICATIONS_PER_WORD - 1U, ConditionVariableData::NOTIFICATIONS_PER_WORD,
+        LAST_INDEX};
+
+    // notify in descending order and twice to verify sorting and that each index is returned only once
+    for (auto i = expectedIndices.size(); i > 0U; --i)
+    {
+        m_notifiers[expectedIndices[i - 1U]].notify();
+        m_notifiers[expectedIndices[i - 1U]].notify();
+    }
+
+    auto activeNotifications = m_waiter.wait();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(expectedIndices.size()));
+    for (uint64_t i = 0U; i < expectedIndices.size(); ++i)
+    {
+        EXPECT_THAT(activeNotifications[i], Eq(expectedIndices[i]));
+    }
+    for (const auto& notification : m_condVarData.m_activeNotifications)
+    {
+        EXPECT_THAT(notification.load(), Eq(0U));
+    }
+    EXPECT_FALSE(m_waiter.wasNotified());
+}
+
+TEST_F(ConditionVariable_test, SetNotificationActiveDoesNotWakeUp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2ccaa85-c5f0-46d4-9788-9a2576761d38");
+    m_notifiers[3U].setNotificationActive();
+
+    EXPECT_TRUE(m_waiter.wasNotified());
+    EXPECT_TRUE(m_condVarData.isNotificationActive(3U));
+    EXPECT_THAT(m_condVarData.m_numberOfNotifications.load(), Eq(1U));
+    EXPECT_THAT(m_condVarData.m_numberOfWakeUps.load(), Eq(0U));
+    EXPECT_FALSE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, SingleWakeUpAfterMultipleActiveNotificationsReturnsAllNotifications)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f05afee-3121-42e3-bccc-0de0bfce3059");
+    m_notifiers[0U].setNotificationActive();
+    m_notifiers[1U].setNotificationActive();
+    m_notifiers[2U].setNotificationActive();
+    m_notifiers[2U].wakeUp();
+
+    auto notifications = m_waiter.wait();
+
+    ASSERT_THAT(notifications.size(), Eq(3U));
+    EXPECT_THAT(notifications[0U], Eq(0U));
+    EXPECT_THAT(notifications[1U], Eq(1U));
+    EXPECT_THAT(notifications[2U], Eq(2U));
+    EXPECT_THAT(m_condVarData.m_numberOfNotifications.load(), Eq(3U));
+    EXPECT_THAT(m_condVarData.m_numberOfWakeUps.load(), Eq(1U));
+}
+
+TEST_F(ConditionVariable_test, BusyPollingIsDisabledByDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39002e28-1a31-46f8-ba05-798435e3972a");
+    EXPECT_THAT(m_waiter.getBusyPollDuration(), Eq(iox::units::Duration::zero()));
+
+    m_waiter.setBusyPollDuration(42_us);
+    EXPECT_THAT(m_waiter.getBusyPollDuration(), Eq(42_us));
+}
+
+TEST_F(ConditionVariable_test, BusyPollingWaitIsServedWithoutSemaphorePost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "561bf552-e5c4-41ea-9eb2-f0a8db5b9d2f");
+    ConditionListener sut{m_condVarData};
+    sut.setBusyPollDuration(m_timeToWait);
+
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] { activeNotifications = sut.wait(); });
+
+    while (m_condVarData.m_listenerState.load() != ConditionVariableData::ListenerState::SPINNING)
+    {
+        std::this_thread::yield();
+    }
+    m_notifiers[7U].notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0U], Eq(7U));
+    EXPECT_THAT(m_condVarData.m_numberOfNotifications.load(), Eq(1U));
+    EXPECT_THAT(m_condVarData.m_numberOfWakeUps.load(), Eq(0U));
+    EXPECT_THAT(m_condVarData.m_listenerState.load(), Eq(ConditionVariableData::ListenerState::IDLE));
+
+    auto statistics = sut.getStatistics();
+    EXPECT_THAT(statistics.spinHits, Eq(1U));
+    EXPECT_THAT(statistics.blockingWaits, Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, BusyPollingTimedWaitBlocksAfterPollDurationAndKeepsTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ccf5acb5-f3e6-443d-a2a5-d8ea5042c71c");
+    constexpr auto TIMEOUT = 20_ms;
+    ConditionListener sut{m_condVarData};
+    sut.setBusyPollDuration(5_ms);
+
+    auto start = std::chrono::steady_clock::now();
+    auto activeNotifications = sut.timedWait(TIMEOUT);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(activeNotifications.empty());
+    EXPECT_THAT(elapsed, Ge(std::chrono::nanoseconds(TIMEOUT.toNanoseconds())));
+    EXPECT_THAT(elapsed, Lt(std::chrono::nanoseconds(m_timeToWait.toNanoseconds())));
+
+    auto statistics = sut.getStatistics();
+    EXPECT_THAT(statistics.spinHits, Eq(0U));
+    EXPECT_THAT(statistics.blockingWaits, Eq(1U));
+}
+
+TEST_F(ConditionVariable_test, BlockingWaitIsCountedAndWakeUpLatencyIsMeasured)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "588e49d3-d4d1-4164-940d-296eaf392ec2");
+    constexpr auto MINIMAL_LATENCY = 10_ms;
+    ConditionListener sut{m_condVarData};
+
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] { activeNotifications = sut.wait(); });
+
+    while (m_condVarData.m_listenerState.load() != ConditionVariableData::ListenerState::BLOCKING)
+    {
+        std::this_thread::yield();
+    }
+    // the latency is measured from the first wake-up, a second one must not restart the measurement
+    m_notifiers[3U].wakeUp();
+    std::this_thread::sleep_for(std::chrono::nanoseconds(MINIMAL_LATENCY.toNanoseconds()));
+    m_notifiers[3U].notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0U], Eq(3U));
+
+    auto statistics = sut.getStatistics();
+    EXPECT_THAT(statistics.spinHits, Eq(0U));
+    EXPECT_THAT(statistics.blockingWaits, Ge(1U));
+    EXPECT_THAT(statistics.averageWakeUpLatency, Ge(MINIMAL_LATENCY));
+}
+
+TEST_F(ConditionVariable_test, WaitWithoutWaitingDoesNotContributeToStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f72b251-32ee-42fc-835d-14564d32e95a");
+    ConditionListener sut{m_condVarData};
+    sut.setBusyPollDuration(m_timeToWait);
+
+    m_notifiers[1U].notify();
+    auto activeNotifications = sut.wait();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    auto statistics = sut.getStatistics();
+    EXPECT_THAT(statistics.spinHits, Eq(0U));
+    EXPECT_THAT(statistics.blockingWaits, Eq(0U));
+    EXPECT_THAT(statistics.averageWakeUpLatency, Eq(iox::units::Duration::zero()));
+}
+
+TEST_F(ConditionVariable_test, TryWaitReturnsActiveNotificationsWithoutBlocking)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "09f8f8d2-774c-4e05-9ac7-42b3d5ebba80");
+    EXPECT_TRUE(m_waiter.tryWait().empty());
+
+    m_notifiers[5U].notify();
+    m_notifiers[2U].notify();
+    auto activeNotifications = m_waiter.tryWait();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(2U));
+    EXPECT_THAT(activeNotifications[0U], Eq(2U));
+    EXPECT_THAT(activeNotifications[1U], Eq(5U));
+    EXPECT_TRUE(m_waiter.tryWait().empty());
+}
+
+TEST_F(ConditionVariable_test, TryWaitReturnsNothingAfterDestroy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f8b3b095-ce00-4caf-a73c-0a53c1bddc8f");
+    m_notifiers[1U].notify();
+    m_waiter.destroy();
+
+    EXPECT_TRUE(m_waiter.tryWait().empty());
+}
+
+#if !defined(_WIN32)
+bool isReadable(const int32_t fileDescriptor)
+{
+    pollfd pollFileDescriptor{fileDescriptor, POLLIN, 0};
+    return poll(&pollFileDescriptor, 1U, 0) == 1 && (pollFileDescriptor.revents & POLLIN) != 0;
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorBecomesReadableOnNotifyAndIsDrainedByTryWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a651094-0d00-4ad7-9b77-bc56a87261a4");
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+    EXPECT_FALSE(isReadable(fileDescriptor.value()));
+
+    m_notifiers[7U].notify();
+    m_notifiers[3U].notify();
+    m_notifiers[4U].notify();
+
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+    // the notifications are coalesced into a single datagram and the semaphore is not posted
+    EXPECT_THAT(m_condVarData.m_numberOfWakeUps.load(), Eq(1U));
+    EXPECT_FALSE(m_condVarData.m_semaphore->tryWait().value());
+
+    auto activeNotifications = m_waiter.tryWait();
+    ASSERT_THAT(activeNotifications.size(), Eq(3U));
+    EXPECT_THAT(activeNotifications[0U], Eq(3U));
+    EXPECT_THAT(activeNotifications[1U], Eq(4U));
+    EXPECT_THAT(activeNotifications[2U], Eq(7U));
+    EXPECT_FALSE(isReadable(fileDescriptor.value()));
+
+    m_notifiers[1U].notify();
+    EXPECT_TRUE(isReadable(fileDescriptor.value()));
+    EXPECT_THAT(m_condVarData.m_numberOfWakeUps.load(), Eq(2U));
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorIsCreatedOnceAndRemovedWithTheListener)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e77f2e59-dc38-4328-a832-c43b02554e23");
+    {
+        ConditionListener sut{m_condVarData};
+        auto fileDescriptor = sut.getFileDescriptor();
+        ASSERT_FALSE(fileDescriptor.has_error());
+        auto sameFileDescriptor = sut.getFileDescriptor();
+        ASSERT_FALSE(sameFileDescriptor.has_error());
+        EXPECT_THAT(sameFileDescriptor.value(), Eq(fileDescriptor.value()));
+        EXPECT_TRUE(m_condVarData.m_hasNotificationSocket.load());
+    }
+
+    EXPECT_FALSE(m_condVarData.m_hasNotificationSocket.load());
+    m_notifiers[0U].notify();
+    EXPECT_TRUE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, SignalingFullNotificationSocketDoesNotBlock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "59dadad8-ea9e-470a-973d-662f3b2a638e");
+    auto socket = NotificationSocket::create();
+    ASSERT_FALSE(socket.has_error());
+
+    // exceeds the datagram queue of the socket by far; the notifiers signal while holding the lock of a chunk queue
+    // and must therefore never wait for the listener to drain its socket
+    constexpr uint64_t NUMBER_OF_SIGNALS{10000U};
+    for (uint64_t i = 0U; i < NUMBER_OF_SIGNALS; ++i)
+    {
+        NotificationSocket::signal(socket->getName());
+    }
+
+    EXPECT_TRUE(isReadable(socket->getFileDescriptor()));
+    socket->drain();
+    EXPECT_FALSE(isReadable(socket->getFileDescriptor()));
+}
+
+TEST_F(ConditionVariable_test, WaitOfPollableListenerIsWokenUpBySemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cdd806e7-ae3e-4518-975a-25dcedf60a7c");
+    auto fileDescriptor = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    Barrier isThreadStarted(1U);
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] {
+        isThreadStarted.notify();
+        activeNotifications = m_waiter.wait();
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    m_notifiers[6U].notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0U], Eq(6U));
+}
+#endif
+
 } // namespace
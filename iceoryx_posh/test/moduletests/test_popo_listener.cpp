@@ -32,6 +32,10 @@
 #include <memory>
 #include <thread>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 namespace
 {
 using namespace ::testing;
@@ -137,6 +141,11 @@ class TestListener : public Listener
         : Listener(data)
     {
     }
+
+    TestListener(ConditionVariableData& data, const ListenerOptions& options) noexcept
+        : Listener(data, options)
+    {
+    }
 };
 
 struct EventAndSutPair_t
@@ -156,6 +165,7 @@ iox::concurrent::smart_lock<std::vector<EventAndSutPair_t>> g_toBeDetached;
 std::array<TriggerSourceAndCount, iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER> g_triggerCallbackArg;
 uint64_t g_triggerCallbackRuntimeInMs = 0U;
 iox::optional<iox::UnnamedSemaphore> g_callbackBlocker;
+iox::concurrent::smart_lock<std::vector<SimpleEventClass*>> g_executionOrder;
 
 class Listener_test : public Test
 {
@@ -179,6 +189,11 @@ class Listener_test : public Test
         ++(*userType);
     }
 
+    static void recordExecutionOrderCallback(SimpleEventClass* const event) noexcept
+    {
+        g_executionOrder->push_back(event);
+    }
+
     static void attachCallback(SimpleEventClass* const) noexcept
     {
         for (auto& e : g_toBeAttached.get_copy())
@@ -222,6 +237,7 @@ class Listener_test : public Test
         g_triggerCallbackRuntimeInMs = 0U;
         g_toBeAttached->clear();
         g_toBeDetached->clear();
+        g_executionOrder->clear();
     };
 
     void activateTriggerCallbackBlocker() noexcept
@@ -668,6 +684,28 @@ TIMING_TEST_F(Listener_test, CallbackIsCalledAfterNotify, Repeat(5), [&] {
     TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 1U);
 })
 
+TIMING_TEST_F(Listener_test, CallbackIsCalledAfterNotifyInBusyPollMode, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "59bbebe6-e8f7-405d-b107-7c63bfcab432");
+    m_sut.emplace(m_condVarData);
+    m_sut->setBusyPollDuration(m_fatalTimeout);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    // the first wait of the background thread might have started before the busy poll mode was enabled
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source.load() == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 2U);
+    TIMING_TEST_EXPECT_TRUE(m_sut->getStatistics().spinHits >= 1U);
+})
+
 TIMING_TEST_F(Listener_test, CallbackWithEventAndUserTypeIsCalledAfterNotify, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "6df97139-8c2e-42b1-bd9a-8770c295bf2e");
     m_sut.emplace(m_condVarData);
@@ -1237,4 +1275,208 @@ TIMING_TEST_F(Listener_test, AttachingInCallbackWorks, Repeat(5), [&] {
 // END
 //////////////////////////////////
 
+//////////////////////////////////
+// BEGIN priorities and worker threads
+//////////////////////////////////
+TIMING_TEST_F(Listener_test, HighPriorityEventIsExecutedBeforeLowPriorityEvent, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "37d10d91-b780-487c-9570-d47278b11a43");
+    m_sut.emplace(m_condVarData);
+    SimpleEventClass blocker;
+    SimpleEventClass low;
+    SimpleEventClass high;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(blocker,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(low,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::recordExecutionOrderCallback),
+                                   ListenerEventPriority::LOW)
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(high,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::recordExecutionOrderCallback),
+                                   ListenerEventPriority::HIGH)
+                     .has_error());
+
+    activateTriggerCallbackBlocker();
+    blocker.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    low.triggerStoepsel();
+    high.triggerStoepsel();
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(1U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    const auto executionOrder = g_executionOrder.get_copy();
+    TIMING_TEST_ASSERT_TRUE(executionOrder.size() == 2U);
+    TIMING_TEST_EXPECT_TRUE(executionOrder[0U] == &high);
+    TIMING_TEST_EXPECT_TRUE(executionOrder[1U] == &low);
+})
+
+TIMING_TEST_F(Listener_test, HighPriorityEventIsExecutedBeforeLowPriorityEventByWorkerThread, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "f71277ce-2788-414c-afdb-b93ba24b24f4");
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 1U;
+    m_sut.emplace(m_condVarData, options);
+    SimpleEventClass blocker;
+    SimpleEventClass low;
+    SimpleEventClass high;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(blocker,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(low,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::recordExecutionOrderCallback),
+                                   ListenerEventPriority::LOW)
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(high,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::recordExecutionOrderCallback),
+                                   ListenerEventPriority::HIGH)
+                     .has_error());
+
+    activateTriggerCallbackBlocker();
+    blocker.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    // both events are queued while the only worker is busy
+    low.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    high.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(1U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    const auto executionOrder = g_executionOrder.get_copy();
+    TIMING_TEST_ASSERT_TRUE(executionOrder.size() == 2U);
+    TIMING_TEST_EXPECT_TRUE(executionOrder[0U] == &high);
+    TIMING_TEST_EXPECT_TRUE(executionOrder[1U] == &low);
+})
+
+TIMING_TEST_F(Listener_test, BlockingCallbackDoesNotDelayOtherEventsWithWorkerThreads, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "32638e34-a3b7-4e81-8e27-8e30a6823823");
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 2U;
+    m_sut.emplace(m_condVarData, options);
+    SimpleEventClass fuu;
+    SimpleEventClass bar;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(bar,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<1U>))
+                     .has_error());
+
+    activateTriggerCallbackBlocker();
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    bar.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    // both callbacks are running and blocked at the same time
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 1U);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[1U].m_source.load() == &bar);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[1U].m_count.load() == 1U);
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(2U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+})
+
+TIMING_TEST_F(Listener_test, EventIsNotExecutedConcurrentlyByWorkerThreads, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "287a0e57-41bf-425b-9b63-7d0434c7590b");
+    constexpr uint64_t NUMBER_OF_RETRIGGERS = 5U;
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 4U;
+    m_sut.emplace(m_condVarData, options);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    activateTriggerCallbackBlocker();
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_RETRIGGERS; ++i)
+    {
+        fuu.triggerStoepsel();
+        std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS / NUMBER_OF_RETRIGGERS));
+    }
+
+    // the idle workers must not pick up the event while its callback is still running
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 1U);
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(NUMBER_OF_RETRIGGERS + 1U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    // all notifications during the callback run are covered by exactly one additional run
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source.load() == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 2U);
+})
+#if defined(__linux__)
+cpu_set_t g_cpusOfCallbackThread;
+
+void recordCpusOfCallbackThread(SimpleEventClass* const) noexcept
+{
+    EXPECT_THAT(sched_getaffinity(0, sizeof(g_cpusOfCallbackThread), &g_cpusOfCallbackThread), Eq(0));
+}
+
+TEST_F(Listener_test, CallbacksAreExecutedWithTheThreadSchedulingOptions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a62dec18-d3e1-4c1e-9d21-7e087744364f");
+    constexpr uint64_t NUMBER_OF_ADDRESSABLE_CPUS{64U};
+    cpu_set_t allowedCpus;
+    CPU_ZERO(&allowedCpus);
+    ASSERT_THAT(sched_getaffinity(0, sizeof(allowedCpus), &allowedCpus), Eq(0));
+    uint64_t cpu = 0U;
+    while (cpu < NUMBER_OF_ADDRESSABLE_CPUS && !CPU_ISSET(cpu, &allowedCpus))
+    {
+        ++cpu;
+    }
+    ASSERT_THAT(cpu, Lt(NUMBER_OF_ADDRESSABLE_CPUS));
+
+    for (const uint32_t numberOfWorkerThreads : {0U, 2U})
+    {
+        CPU_ZERO(&g_cpusOfCallbackThread);
+        ListenerOptions options;
+        options.numberOfWorkerThreads = numberOfWorkerThreads;
+        options.threadSchedulingOptions.cpuAffinityMask = uint64_t{1U} << cpu;
+        m_sut.emplace(m_condVarData, options);
+        SimpleEventClass fuu;
+        ASSERT_FALSE(m_sut
+                         ->attachEvent(fuu,
+                                       SimpleEvent::StoepselBachelorParty,
+                                       createNotificationCallback(recordCpusOfCallbackThread))
+                         .has_error());
+
+        fuu.triggerStoepsel();
+        std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+        EXPECT_THAT(CPU_COUNT(&g_cpusOfCallbackThread), Eq(1));
+        EXPECT_TRUE(CPU_ISSET(cpu, &g_cpusOfCallbackThread));
+    }
+}
+#endif
+//////////////////////////////////
+// END
+//////////////////////////////////
+
 } // namespace
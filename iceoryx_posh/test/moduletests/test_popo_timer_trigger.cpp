@@ -0,0 +1,286 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/timer_trigger.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iox/atomic.hpp"
+#include "iox/duration.hpp"
+
+#include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
+#include "test.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class WaitSetTest : public iox::popo::WaitSet<>
+{
+  public:
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : WaitSet(condVarData)
+    {
+    }
+};
+
+class ListenerTest : public iox::popo::Listener
+{
+  public:
+    ListenerTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : Listener(condVarData)
+    {
+    }
+};
+
+class TimerTrigger_test : public Test
+{
+  public:
+    TimerTrigger m_sut;
+    ConditionVariableData m_condVar{"Horscht"};
+    WaitSetTest m_waitSet{m_condVar};
+
+    static constexpr units::Duration INTERVAL{20_ms};
+
+    static iox::concurrent::Atomic<uint64_t> m_numberOfCallbacks;
+    static void callback(TimerTrigger*)
+    {
+        m_numberOfCallbacks.fetch_add(1U);
+    }
+
+    void SetUp() override
+    {
+        m_numberOfCallbacks.store(0U);
+    }
+};
+
+constexpr units::Duration TimerTrigger_test::INTERVAL;
+iox::concurrent::Atomic<uint64_t> TimerTrigger_test::m_numberOfCallbacks{0U};
+
+TEST_F(TimerTrigger_test, IsNotRunningAndNotTriggeredWhenCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da7676ef-f60a-44e6-895b-e769d083f151");
+    EXPECT_FALSE(m_sut.isRunning());
+    EXPECT_FALSE(m_sut.hasTriggered());
+}
+
+TEST_F(TimerTrigger_test, StartWithZeroIntervalFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f1485e64-c9d3-4cf9-bd5b-322beb08e24f");
+    auto result = m_sut.start(units::Duration::zero(), TimerTriggerMode::PERIODIC);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(TimerTriggerError::INVALID_INTERVAL));
+    EXPECT_FALSE(m_sut.isRunning());
+}
+
+TEST_F(TimerTrigger_test, IsRunningAfterStartAndNotAfterStop)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66ea2794-13b7-47db-8471-8663255a3790");
+    ASSERT_FALSE(m_sut.start(INTERVAL, TimerTriggerMode::PERIODIC).has_error());
+    EXPECT_TRUE(m_sut.isRunning());
+
+    m_sut.stop();
+    EXPECT_FALSE(m_sut.isRunning());
+}
+
+TEST_F(TimerTrigger_test, OneShotTimerTriggersWaitSetOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "938465cf-4657-4445-8164-ea4e269aeb2b");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut, 73U).has_error());
+    ASSERT_FALSE(m_sut.start(INTERVAL, TimerTriggerMode::ONE_SHOT).has_error());
+
+    const auto start = std::chrono::steady_clock::now();
+    auto result = m_waitSet.wait();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_THAT(result.size(), Eq(1U));
+    EXPECT_THAT(result[0U]->getNotificationId(), Eq(73U));
+    EXPECT_TRUE(result[0U]->doesOriginateFrom(&m_sut));
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(),
+                Ge(INTERVAL.toMilliseconds() - 1U));
+    EXPECT_FALSE(m_sut.isRunning());
+
+    EXPECT_TRUE(m_waitSet.timedWait(3 * INTERVAL).empty());
+}
+
+TEST_F(TimerTrigger_test, PeriodicTimerTriggersWaitSetRepeatedly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c516730-8211-4820-9231-d12c9e0302cb");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    ASSERT_FALSE(m_sut.start(INTERVAL, TimerTriggerMode::PERIODIC).has_error());
+
+    constexpr uint64_t NUMBER_OF_PERIODS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_PERIODS; ++i)
+    {
+        auto result = m_waitSet.timedWait(10 * INTERVAL);
+        ASSERT_THAT(result.size(), Eq(1U));
+        EXPECT_TRUE(result[0U]->doesOriginateFrom(&m_sut));
+    }
+    EXPECT_TRUE(m_sut.isRunning());
+}
+
+TEST_F(TimerTrigger_test, StoppedTimerDoesNotTriggerWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a842973e-3f87-4ab0-a044-69e0d357f19a");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    ASSERT_FALSE(m_sut.start(INTERVAL, TimerTriggerMode::PERIODIC).has_error());
+    m_sut.stop();
+
+    EXPECT_TRUE(m_waitSet.timedWait(3 * INTERVAL).empty());
+}
+
+TEST_F(TimerTrigger_test, TimedWaitReturnsAtTimerDeadlineBeforeTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5de12ed6-e5cd-4bab-b834-8c58873fff11");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    ASSERT_FALSE(m_sut.start(INTERVAL, TimerTriggerMode::ONE_SHOT).has_error());
+
+    const auto start = std::chrono::steady_clock::now();
+    auto result = m_waitSet.timedWait(100 * INTERVAL);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_THAT(result.size(), Eq(1U));
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(),
+                Lt((50 * INTERVAL).toMilliseconds()));
+}
+
+TEST_F(TimerTrigger_test, TimedWaitTimesOutBeforeTimerDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13303d07-b177-417e-b35c-1ca64a6fd3e3");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    ASSERT_FALSE(m_sut.start(100 * INTERVAL, TimerTriggerMode::ONE_SHOT).has_error());
+
+    EXPECT_TRUE(m_waitSet.timedWait(INTERVAL).empty());
+    EXPECT_TRUE(m_sut.isRunning());
+}
+
+TEST_F(TimerTrigger_test, BusyPollingWaitSetReturnsAtTimerDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dfd77e89-d761-4228-b3c6-b9a3a8c131dc");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_waitSet.setBusyPollDuration(100 * INTERVAL);
+    ASSERT_FALSE(m_sut.start(INTERVAL, TimerTriggerMode::ONE_SHOT).has_error());
+
+    const auto start = std::chrono::steady_clock::now();
+    auto result = m_waitSet.wait();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_THAT(result.size(), Eq(1U));
+    EXPECT_TRUE(result[0U]->doesOriginateFrom(&m_sut));
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(),
+                Lt((50 * INTERVAL).toMilliseconds()));
+}
+
+TEST_F(TimerTrigger_test, TimerStartedWhileWaitSetIsBlockedTriggersIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "83cfa1f0-afe3-484d-87f5-e58c2b02277c");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+
+    std::thread starter([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(INTERVAL.toMilliseconds()));
+        ASSERT_FALSE(m_sut.start(INTERVAL, TimerTriggerMode::ONE_SHOT).has_error());
+    });
+
+    auto result = m_waitSet.wait();
+    starter.join();
+
+    ASSERT_THAT(result.size(), Eq(1U));
+    EXPECT_TRUE(result[0U]->doesOriginateFrom(&m_sut));
+}
+
+TEST_F(TimerTrigger_test, TryWaitExpiresDueTimer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5abfd065-7672-4d0d-bc8a-c500b5a2d234");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    ASSERT_FALSE(m_sut.start(INTERVAL, TimerTriggerMode::ONE_SHOT).has_error());
+
+    EXPECT_TRUE(m_waitSet.tryWait().empty());
+    std::this_thread::sleep_for(std::chrono::milliseconds(2 * INTERVAL.toMilliseconds()));
+
+    EXPECT_THAT(m_waitSet.tryWait().size(), Eq(1U));
+}
+
+TEST_F(TimerTrigger_test, TimerTriggerGoesOutOfScopeCleansUpAtWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "072c61d7-68ee-4490-8eda-5466f6eb0909");
+    {
+        TimerTrigger sut;
+        ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+        ASSERT_FALSE(sut.start(INTERVAL, TimerTriggerMode::ONE_SHOT).has_error());
+    }
+
+    EXPECT_EQ(m_waitSet.size(), 0U);
+    EXPECT_TRUE(m_waitSet.timedWait(3 * INTERVAL).empty());
+}
+
+TEST_F(TimerTrigger_test, DetachedTimersCanBeAttachedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "44959d49-917e-4686-8f0b-151f8b5f7612");
+    for (uint64_t i = 0U; i < 2U * MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE; ++i)
+    {
+        TimerTrigger sut;
+        ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+        ASSERT_FALSE(sut.start(1_ms, TimerTriggerMode::ONE_SHOT).has_error());
+        ASSERT_THAT(m_waitSet.timedWait(100 * INTERVAL).size(), Eq(1U));
+        m_waitSet.detachEvent(sut);
+    }
+
+    IOX_TESTING_EXPECT_OK();
+}
+
+TEST_F(TimerTrigger_test, AttachingMoreThanTheMaximumNumberOfTimersReportsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "10aa4854-85b3-4339-9f88-e911cfb15130");
+    TimerTrigger timers[MAX_NUMBER_OF_TIMERS_PER_CONDITION_VARIABLE];
+    for (auto& timer : timers)
+    {
+        ASSERT_FALSE(m_waitSet.attachEvent(timer).has_error());
+    }
+    IOX_TESTING_EXPECT_OK();
+
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__TIMER_TRIGGER_NO_FREE_TIMER);
+}
+
+TEST_F(TimerTrigger_test, PeriodicTimerCallsListenerCallbackRepeatedly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf1b02fa-da1c-4445-a58b-ff45390fe289");
+    ConditionVariableData condVar{"Schnuppi"};
+    ListenerTest listener{condVar};
+    ASSERT_FALSE(listener.attachEvent(m_sut, createNotificationCallback(TimerTrigger_test::callback)).has_error());
+    ASSERT_FALSE(m_sut.start(INTERVAL, TimerTriggerMode::PERIODIC).has_error());
+
+    constexpr uint64_t NUMBER_OF_PERIODS{3U};
+    const auto giveUp = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (m_numberOfCallbacks.load() < NUMBER_OF_PERIODS && std::chrono::steady_clock::now() < giveUp)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(INTERVAL.toMilliseconds()));
+    }
+
+    EXPECT_THAT(m_numberOfCallbacks.load(), Ge(NUMBER_OF_PERIODS));
+    listener.detachEvent(m_sut);
+}
+
+} // namespace
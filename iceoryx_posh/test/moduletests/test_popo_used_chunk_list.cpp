@@ -121,6 +121,28 @@ TEST_F(UsedChunkList_test, AddChunksUntilOverflowIsHandledGracefully)
     EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
 }
 
+TEST_F(UsedChunkList_test, InitiallyEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ca7f400-0057-41ee-8780-49e4a16eab5f");
+    EXPECT_TRUE(sut.isEmpty());
+}
+
+TEST_F(UsedChunkList_test, EmptyAgainWhenAllChunksAreRemoved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "347b4091-49f2-4d17-9145-6949322564b4");
+    auto chunk1 = getChunkFromMemoryManager();
+    auto chunk2 = getChunkFromMemoryManager();
+    sut.insert(chunk1);
+    sut.insert(chunk2);
+    EXPECT_FALSE(sut.isEmpty());
+
+    SharedChunk removedChunk;
+    EXPECT_TRUE(sut.remove(chunk1.getChunkHeader(), removedChunk));
+    EXPECT_FALSE(sut.isEmpty());
+    EXPECT_TRUE(sut.remove(chunk2.getChunkHeader(), removedChunk));
+    EXPECT_TRUE(sut.isEmpty());
+}
+
 TEST_F(UsedChunkList_test, OneChunkCanBeRemoved)
 {
     ::testing::Test::RecordProperty("TEST_ID", "50ffb5df-59ef-4dd4-a2a6-c7ad342c24ae");
@@ -30,6 +30,10 @@
 #include <memory>
 #include <thread>
 
+#if !defined(_WIN32)
+#include <poll.h>
+#endif
+
 namespace
 {
 using namespace ::testing;
@@ -1174,6 +1178,23 @@ TEST_F(WaitSet_test, TimedWaitReturnsNothingWhenNothingTriggered)
     ASSERT_THAT(triggerVector.size(), Eq(0U));
 }
 
+TEST_F(WaitSet_test, TimedWaitInBusyPollModeBlocksAfterPollingAndIsCountedInStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3e80fc9-eb6b-4280-92e5-c94212dc7599");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 5U).has_error());
+    m_sut->setBusyPollDuration(1_ms);
+
+    auto triggerVector = m_sut->timedWait(10_ms);
+    EXPECT_THAT(triggerVector.size(), Eq(0U));
+    EXPECT_THAT(m_sut->getStatistics().spinHits, Eq(0U));
+    EXPECT_THAT(m_sut->getStatistics().blockingWaits, Eq(1U));
+
+    m_simpleEvents[0U].trigger();
+    triggerVector = m_sut->timedWait(10_ms);
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(5U));
+}
+
 void WaitReturnsTheOneTriggeredCondition(WaitSet_test* test,
                                          const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
 {
@@ -1203,6 +1224,35 @@ TEST_F(WaitSet_test, TimedWaitReturnsTheOneTriggeredCondition)
     WaitReturnsTheOneTriggeredCondition(this, [&] { return m_sut->timedWait(10_ms); });
 }
 
+TEST_F(WaitSet_test, TryWaitReturnsTheOneTriggeredCondition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2d62812-b0fc-430c-9839-d1f1b7973e68");
+    WaitReturnsTheOneTriggeredCondition(this, [&] { return m_sut->tryWait(); });
+}
+
+#if !defined(_WIN32)
+TEST_F(WaitSet_test, FileDescriptorBecomesReadableWhenAttachedEventIsTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2412a21e-0f78-4db5-8ee5-da0e7b6cfd70");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 5U).has_error());
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[1U], 6U).has_error());
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    pollfd pollFileDescriptor{fileDescriptor.value(), POLLIN, 0};
+    EXPECT_THAT(poll(&pollFileDescriptor, 1U, 0), Eq(0));
+
+    m_simpleEvents[1U].trigger();
+    EXPECT_THAT(poll(&pollFileDescriptor, 1U, 0), Eq(1));
+
+    auto triggerVector = m_sut->tryWait();
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(6U));
+    EXPECT_THAT(poll(&pollFileDescriptor, 1U, 0), Eq(0));
+    EXPECT_THAT(m_sut->tryWait().size(), Eq(0U));
+}
+#endif
+
 void WaitReturnsAllTriggeredConditionWhenMultipleAreTriggered(
     WaitSet_test* test, const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
 {
@@ -1022,6 +1022,113 @@ TEST_F(PoshRuntime_test, ShutdownUnblocksBlockingServer)
     EXPECT_THAT(wasResponseSent.load(), Eq(true));
 }
 
+TEST_F(PoshRuntime_test, GetMiddlewarePortsCreatesPortsOfAllKinds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "27850cc3-bb36-4e83-abe2-be4b68c55148");
+    const iox::capro::ServiceDescription topic{"shine", "on", "you"};
+    const iox::capro::ServiceDescription method{"crazy", "dia", "mond"};
+
+    PortBatch sut;
+    const auto publisherIndex = sut.addPublisher(topic);
+    const auto subscriberIndex = sut.addSubscriber(topic);
+    const auto clientIndex = sut.addClient(method);
+    const auto serverIndex = sut.addServer(method);
+    ASSERT_TRUE(publisherIndex.has_value() && subscriberIndex.has_value());
+    ASSERT_TRUE(clientIndex.has_value() && serverIndex.has_value());
+
+    EXPECT_TRUE(m_runtime->getMiddlewarePorts(sut));
+
+    for (uint64_t i = 0U; i < sut.size(); ++i)
+    {
+        EXPECT_THAT(sut.getError(i), Eq(IpcMessageErrorType::NOTYPE));
+    }
+    EXPECT_THAT(sut.takeSubscriber(publisherIndex.value()), Eq(nullptr));
+
+    const auto* publisherPort = sut.takePublisher(publisherIndex.value());
+    ASSERT_THAT(publisherPort, Ne(nullptr));
+    EXPECT_THAT(publisherPort->m_serviceDescription, Eq(topic));
+    EXPECT_THAT(publisherPort->m_runtimeName, Eq(m_runtimeName));
+
+    const auto* subscriberPort = sut.takeSubscriber(subscriberIndex.value());
+    ASSERT_THAT(subscriberPort, Ne(nullptr));
+    EXPECT_THAT(subscriberPort->m_serviceDescription, Eq(topic));
+    EXPECT_THAT(subscriberPort->m_runtimeName, Eq(m_runtimeName));
+
+    checkClientInitialization(sut.takeClient(clientIndex.value()), method, ClientOptions(), iox::mepoo::MemoryInfo());
+    checkServerInitialization(sut.takeServer(serverIndex.value()), method, ServerOptions(), iox::mepoo::MemoryInfo());
+
+    EXPECT_THAT(sut.takePublisher(publisherIndex.value()), Eq(nullptr));
+    IOX_TESTING_EXPECT_OK();
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePortsCreatesMorePortsThanFitIntoOneRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "75ef2628-252c-42c2-bcf1-c49d3d8c0eb7");
+    constexpr uint64_t NUMBER_OF_PORTS{PortBatch::MAX_PORTS_PER_REQUEST + 4U};
+
+    PortBatch sut;
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        ASSERT_TRUE(sut.addPublisher({"echoes", "of", into<lossy<IdString_t>>(convert::toString(i))}).has_value());
+    }
+
+    EXPECT_TRUE(m_runtime->getMiddlewarePorts(sut));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        const auto* publisherPort = sut.takePublisher(i);
+        ASSERT_THAT(publisherPort, Ne(nullptr));
+        EXPECT_THAT(publisherPort->m_serviceDescription, Eq(sut[i].service));
+    }
+    IOX_TESTING_EXPECT_OK();
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePortsWithInvalidNodeNameCreatesTheRemainingPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b520f80b-701d-4f16-849e-f4aa41d76377");
+    const iox::capro::ServiceDescription topic{"wish", "you", "were"};
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.nodeName = m_invalidNodeName;
+
+    PortBatch sut;
+    const auto publisherIndex = sut.addPublisher(topic);
+    const auto subscriberIndex = sut.addSubscriber(topic, subscriberOptions);
+    const auto serverIndex = sut.addServer(topic);
+    ASSERT_TRUE(publisherIndex.has_value() && subscriberIndex.has_value() && serverIndex.has_value());
+
+    EXPECT_FALSE(m_runtime->getMiddlewarePorts(sut));
+
+    EXPECT_THAT(sut.getError(subscriberIndex.value()),
+                Eq(IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE));
+    EXPECT_THAT(sut.takeSubscriber(subscriberIndex.value()), Eq(nullptr));
+    EXPECT_THAT(sut.takePublisher(publisherIndex.value()), Ne(nullptr));
+    EXPECT_THAT(sut.takeServer(serverIndex.value()), Ne(nullptr));
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE);
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePortsReportsTheErrorsOfRouDiPerPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "70cd9599-f54c-46c2-8521-f458edd50ce7");
+    const iox::capro::ServiceDescription method{"time", "breathe", "reprise"};
+
+    ASSERT_THAT(m_runtime->getMiddlewareServer(method), Ne(nullptr));
+
+    PortBatch sut;
+    const auto serverIndex = sut.addServer(method);
+    const auto clientIndex = sut.addClient(method);
+    ASSERT_TRUE(serverIndex.has_value() && clientIndex.has_value());
+
+    EXPECT_FALSE(m_runtime->getMiddlewarePorts(sut));
+
+    EXPECT_THAT(sut.getError(serverIndex.value()), Ne(IpcMessageErrorType::NOTYPE));
+    EXPECT_THAT(sut.takeServer(serverIndex.value()), Eq(nullptr));
+    EXPECT_THAT(sut.getError(clientIndex.value()), Eq(IpcMessageErrorType::NOTYPE));
+    EXPECT_THAT(sut.takeClient(clientIndex.value()), Ne(nullptr));
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE);
+}
+
 TEST(PoshRuntimeFactory_test, SetValidRuntimeFactorySucceeds)
 {
     ::testing::Test::RecordProperty("TEST_ID", "59c4e1e6-36f6-4f6d-b4c2-e84fa891f014");
@@ -35,6 +35,7 @@ namespace config
 bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
 {
     return (lhs.roudiConfig.monitoringMode == rhs.roudiConfig.monitoringMode)
+           && (lhs.roudiConfig.memoryResidency == rhs.roudiConfig.memoryResidency)
            && (lhs.roudiConfig.logLevel == rhs.roudiConfig.logLevel)
            && (lhs.roudiConfig.compatibilityCheckLevel == rhs.roudiConfig.compatibilityCheckLevel)
            && (lhs.roudiConfig.processTerminationDelay == rhs.roudiConfig.processTerminationDelay)
@@ -84,6 +85,19 @@ class CmdLineParser_test : public Test
         optind = 0;
     }
 
+    void testMemoryResidency(uint8_t numberOfArgs, char* args[], MemoryResidency residency)
+    {
+        CmdLineParser sut;
+        auto result = sut.parse(numberOfArgs, args);
+
+        ASSERT_FALSE(result.has_error());
+        EXPECT_EQ(result.value().roudiConfig.memoryResidency, residency);
+        EXPECT_TRUE(result.value().run);
+
+        // Reset optind to be able to parse again
+        optind = 0;
+    }
+
     void testCompatibilityLevel(uint8_t numberOfArgs, char* args[], CompatibilityCheckLevel level)
     {
         CmdLineParser sut;
@@ -223,6 +237,50 @@ TEST_F(CmdLineParser_test, MonitoringModeOptionsLeadToCorrectMode)
     }
 }
 
+TEST_F(CmdLineParser_test, MemoryResidencyOptionsLeadToCorrectResidency)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "15dbad36-2333-4f43-b0b6-471eccd54ba7");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    MemoryResidency residencyArray[] = {
+        MemoryResidency::OFF, MemoryResidency::PREFAULT, MemoryResidency::PREFAULT_AND_LOCK};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char optionArray[][20] = {"-r", "--memory-residency"};
+    char valueArray[][10] = {"off", "prefault", "lock"};
+    args[0] = &appName[0];
+
+    for (auto optionValue : optionArray)
+    {
+        args[1] = optionValue;
+        uint8_t i{0U};
+        for (auto expectedValue : residencyArray)
+        {
+            args[2] = valueArray[i];
+            testMemoryResidency(NUMBER_OF_ARGS, args, expectedValue);
+            i++;
+        }
+    }
+}
+
+TEST_F(CmdLineParser_test, WrongMemoryResidencyOptionLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e52ec17a-2e19-45c8-b459-4a10d18b29fa");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--memory-residency";
+    char wrongValue[] = "always";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &wrongValue[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.error(), CmdLineParserResult::INVALID_PARAMETER);
+}
+
 TEST_F(CmdLineParser_test, WrongMonitoringModeOptionLeadsToError)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2c2b81f2-1ba6-486f-8ec3-4cafbd0cdb3c");
@@ -409,6 +467,74 @@ TEST_F(CmdLineParser_test, TerminationDelayOptionOutOfBoundsLeadsToError)
     EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
 }
 
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersLongOptionLeadsToCorrectWorkerCount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "34ef0d9f-17ac-4fac-8d26-6bfdb8091c76");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-workers";
+    char value[] = "4";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().roudiConfig.runtimeMessageWorkerCount, 4U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersShortOptionLeadsToCorrectWorkerCount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9df58a6d-2be6-4326-af81-e828d12152d7");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-w";
+    char value[] = "16";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().roudiConfig.runtimeMessageWorkerCount, 16U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersOptionOutOfBoundsLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9478bf04-d58b-4637-bdaf-72d852d34356");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-workers";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+
+    char tooFewWorkers[] = "0";
+    args[2] = &tooFewWorkers[0];
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
+
+    optind = 0;
+    char tooManyWorkers[] = "17"; // MAX_RUNTIME_MESSAGE_WORKERS + 1
+    args[2] = &tooManyWorkers[0];
+    CmdLineParser sut2;
+    result = sut2.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
+}
+
 TEST_F(CmdLineParser_test, CompatibilityLevelOptionsLeadToCorrectCompatibilityLevel)
 {
     ::testing::Test::RecordProperty("TEST_ID", "62b7d5c9-0638-4314-b4f7-c622ef101045");
@@ -181,6 +181,116 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+const std::string CONFIG_MEMPOOL_THREAD_CACHE_CAPACITY_EXCEEDED = [] {
+    std::string config = R"(
+        [general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 10000
+    )";
+    config.append("thread-cache = " + std::to_string(iox::MAX_MEMPOOL_THREAD_CACHE_CAPACITY + 1) + "\n");
+
+    return config;
+}();
+
+constexpr const char* CONFIG_INVALID_NUMA_NODE = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    numa-node = -1
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_INVALID_MEMPOOL_NUMA_NODE = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+    numa-node = "everywhere"
+)";
+
+constexpr const char* CONFIG_INVALID_THREAD_CPU = R"(
+    [general]
+    version = 1
+
+    [threads]
+    cpu-affinity = [1, 64]
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_EMPTY_THREAD_CPU_AFFINITY = R"(
+    [general]
+    version = 1
+
+    [threads]
+    cpu-affinity = []
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_INVALID_THREAD_FIFO_PRIORITY = R"(
+    [general]
+    version = 1
+
+    [threads]
+    fifo-priority = 0
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_PORT_POOL_CAPACITY_EXCEEDED = R"(
+    [general]
+    version = 1
+
+    [port-pool]
+    subscribers = 100000000
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_TOO_FEW_PUBLISHERS_FOR_ROUDI = R"(
+    [general]
+    version = 1
+
+    [port-pool]
+    publishers = 0
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -200,9 +310,294 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_THREAD_CACHE_CAPACITY_EXCEEDED,
+                                 CONFIG_MEMPOOL_THREAD_CACHE_CAPACITY_EXCEEDED},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODE, CONFIG_INVALID_NUMA_NODE},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODE,
+                                 CONFIG_INVALID_MEMPOOL_NUMA_NODE},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_CPU_AFFINITY,
+                                 CONFIG_INVALID_THREAD_CPU},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_CPU_AFFINITY,
+                                 CONFIG_EMPTY_THREAD_CPU_AFFINITY},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_THREAD_FIFO_PRIORITY,
+                                 CONFIG_INVALID_THREAD_FIFO_PRIORITY},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_PORT_POOL_CAPACITY,
+                                 CONFIG_PORT_POOL_CAPACITY_EXCEEDED},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_PORT_POOL_CAPACITY,
+                                 CONFIG_TOO_FEW_PUBLISHERS_FOR_ROUDI},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingMempoolThreadCacheIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c8f6a1e-4d0b-4f8e-9d35-6f1b2f7e4a52");
+    constexpr uint32_t THREAD_CACHE_CAPACITY{32U};
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+        thread-cache = 32
+
+        [[segment.mempool]]
+        size = 1024
+        count = 100
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& mempools = result.value().m_sharedMemorySegments.front().m_mempoolConfig.m_mempoolConfig;
+    ASSERT_THAT(mempools.size(), Eq(2U));
+    EXPECT_THAT(mempools[0].m_threadCacheCapacity, Eq(THREAD_CACHE_CAPACITY));
+    EXPECT_THAT(mempools[1].m_threadCacheCapacity, Eq(0U));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingSegmentFallbackToLargerMempoolIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "35736568-4d86-4080-af6a-da34cf358198");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+        fallback-to-larger-mempool = true
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+    EXPECT_THAT(segments[0].m_mempoolConfig.m_fallbackPolicy,
+                Eq(iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_fallbackPolicy, Eq(iox::mepoo::MemPoolFallbackPolicy::NONE));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingSegmentWithHugePagesIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "84ebabcb-aa6e-43a0-94d6-61dc3d834269");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+        huge-pages = true
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+    EXPECT_TRUE(segments[0].m_useHugePages);
+    EXPECT_FALSE(segments[1].m_useHugePages);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingSegmentWithEmbeddedChunkManagementIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e62a45e-c78f-452d-a3d4-80b46c37b2c5");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+        embedded-chunk-management = true
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+    EXPECT_THAT(segments[0].m_mempoolConfig.m_chunkManagementLayout,
+                Eq(iox::mepoo::ChunkManagementLayout::EMBEDDED));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_chunkManagementLayout,
+                Eq(iox::mepoo::ChunkManagementLayout::SEPARATE_POOL));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingNumaPlacementIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dfba2b43-a959-4441-a730-2ce7fc9aed5c");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+        numa-node = 1
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+        numa-node = "interleave"
+
+        [[segment.mempool]]
+        size = 1024
+        count = 100
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+        numa-node = 0
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+    EXPECT_THAT(segments[0].m_numaPlacement, Eq(iox::NumaPlacement::bindToNode(1U)));
+    EXPECT_THAT(segments[1].m_numaPlacement, Eq(iox::NumaPlacement()));
+
+    const auto& mempools = segments[0].m_mempoolConfig.m_mempoolConfig;
+    ASSERT_THAT(mempools.size(), Eq(2U));
+    EXPECT_THAT(mempools[0].m_numaPlacement, Eq(iox::NumaPlacement::interleave()));
+    EXPECT_THAT(mempools[1].m_numaPlacement, Eq(iox::NumaPlacement()));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_mempoolConfig[0].m_numaPlacement,
+                Eq(iox::NumaPlacement::bindToNode(0U)));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingThreadSchedulingOptionsIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eda755b4-9c9b-4c47-acb0-eaefdec6c519");
+    constexpr uint64_t CPU_AFFINITY_MASK{0b1010U};
+    constexpr int32_t FIFO_PRIORITY{20};
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [threads]
+        cpu-affinity = [1, 3]
+        fifo-priority = 20
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value().threadSchedulingOptions.cpuAffinityMask, Eq(CPU_AFFINITY_MASK));
+    EXPECT_THAT(result.value().threadSchedulingOptions.fifoPriority, Eq(FIFO_PRIORITY));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, MissingThreadsSectionKeepsInheritedThreadSettings)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f80f2ee-c9f9-40bf-99bc-d5ce00b11f7c");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value().threadSchedulingOptions.cpuAffinityMask, Eq(0U));
+    EXPECT_THAT(result.value().threadSchedulingOptions.fifoPriority, Eq(0));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingPortPoolCapacityIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "245b56f8-04f4-4829-9062-dd6e43c16f72");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [port-pool]
+        publishers = 32
+        subscribers = 64
+        servers = 0
+        condition-variables = 8
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& capacity = result.value().portPoolCapacity;
+    EXPECT_THAT(capacity.publishers, Eq(32U));
+    EXPECT_THAT(capacity.subscribers, Eq(64U));
+    EXPECT_THAT(capacity.servers, Eq(0U));
+    EXPECT_THAT(capacity.clients, Eq(iox::MAX_CLIENTS));
+    EXPECT_THAT(capacity.interfaces, Eq(iox::MAX_INTERFACE_NUMBER));
+    EXPECT_THAT(capacity.conditionVariables, Eq(8U));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, MissingPortPoolSectionKeepsCompileTimeMaxima)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0457796-9d33-49e4-976b-5c14a7ba3566");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1000
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& capacity = result.value().portPoolCapacity;
+    EXPECT_THAT(capacity.publishers, Eq(iox::MAX_PUBLISHERS));
+    EXPECT_THAT(capacity.subscribers, Eq(iox::MAX_SUBSCRIBERS));
+    EXPECT_THAT(capacity.servers, Eq(iox::MAX_SERVERS));
+    EXPECT_THAT(capacity.clients, Eq(iox::MAX_CLIENTS));
+    EXPECT_THAT(capacity.interfaces, Eq(iox::MAX_INTERFACE_NUMBER));
+    EXPECT_THAT(capacity.conditionVariables, Eq(iox::MAX_NUMBER_OF_CONDITION_VARIABLES));
+}
 
 TEST_P(RoudiConfigTomlFileProvider_test, ParseMalformedInputFileCausesError)
 {
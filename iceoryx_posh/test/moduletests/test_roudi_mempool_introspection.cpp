@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/vector.hpp"
 #include "mocks/mepoo_memory_manager_mock.hpp"
 #include "mocks/publisher_mock.hpp"
@@ -72,6 +73,16 @@ class SegmentMock
         return iox::PosixGroup::getGroupOfCurrentProcess();
     }
 
+    uint64_t getPageSize() const
+    {
+        return iox::detail::pageSize();
+    }
+
+    int32_t getNumaNode() const
+    {
+        return iox::roudi::MemPoolIntrospectionInfo::UNKNOWN_NUMA_NODE;
+    }
+
   private:
     MePooMemoryManager_MOCK memoryManager;
 };
@@ -0,0 +1,247 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/port_data_container.hpp"
+
+#include "iceoryx_hoofs/testing/fatal_failure.hpp"
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using namespace iox::testing;
+
+struct PortDataMock
+{
+    explicit PortDataMock(const uint64_t value, uint64_t& destructorCounter)
+        : m_value(value)
+        , m_destructorCounter(&destructorCounter)
+    {
+    }
+
+    PortDataMock(const PortDataMock&) = delete;
+    PortDataMock(PortDataMock&&) = delete;
+    PortDataMock& operator=(const PortDataMock&) = delete;
+    PortDataMock& operator=(PortDataMock&&) = delete;
+
+    ~PortDataMock()
+    {
+        ++(*m_destructorCounter);
+    }
+
+    alignas(32) uint64_t m_value{0U};
+    uint64_t* m_destructorCounter{nullptr};
+};
+
+class PortDataContainer_test : public Test
+{
+  public:
+    using Sut = PortDataContainer<PortDataMock>;
+
+    static constexpr Sut::IndexType CAPACITY{5U};
+
+    std::vector<uint64_t> values()
+    {
+        std::vector<uint64_t> values;
+        for (const auto& element : static_cast<const Sut&>(*m_sut))
+        {
+            values.push_back(element.m_value);
+        }
+        return values;
+    }
+
+    PortDataMock* emplace(const uint64_t value)
+    {
+        auto it = m_sut->emplace(value, m_destructorCounter);
+        return (it == m_sut->end()) ? nullptr : it.to_ptr();
+    }
+
+    uint64_t m_destructorCounter{0U};
+    // an offset of one byte enforces the padding for the alignment
+    std::vector<uint8_t> m_storage = std::vector<uint8_t>(Sut::requiredMemorySize(CAPACITY) + 1U);
+    iox::BumpAllocator m_allocator{m_storage.data() + 1U, m_storage.size() - 1U};
+    iox::optional<Sut> m_sut{iox::in_place, CAPACITY, m_allocator};
+};
+
+constexpr PortDataContainer_test::Sut::IndexType PortDataContainer_test::CAPACITY;
+
+TEST_F(PortDataContainer_test, NewContainerIsEmptyAndHasTheConfiguredCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a9a3e2a-b395-43d5-96af-25c9436164e2");
+    EXPECT_TRUE(m_sut->empty());
+    EXPECT_FALSE(m_sut->full());
+    EXPECT_THAT(m_sut->size(), Eq(0U));
+    EXPECT_THAT(m_sut->capacity(), Eq(CAPACITY));
+    EXPECT_TRUE(m_sut->begin() == m_sut->end());
+}
+
+TEST_F(PortDataContainer_test, ElementsAreStoredAlignedInTheProvidedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0bdf64f3-7a97-4c42-b35a-6c71ac015608");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        auto* element = emplace(i);
+        ASSERT_THAT(element, Ne(nullptr));
+        const auto address = reinterpret_cast<uintptr_t>(element);
+        EXPECT_THAT(address % alignof(PortDataMock), Eq(0U));
+        EXPECT_THAT(address, Ge(reinterpret_cast<uintptr_t>(m_storage.data())));
+        const auto endOfStorage = reinterpret_cast<uintptr_t>(m_storage.data() + m_storage.size());
+        EXPECT_THAT(address + sizeof(PortDataMock), Le(endOfStorage));
+    }
+}
+
+TEST_F(PortDataContainer_test, EmplaceUntilCapacityMakesContainerFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "32fa04e9-8198-4107-b61b-37262f4a0473");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_THAT(emplace(i), Ne(nullptr));
+    }
+
+    EXPECT_TRUE(m_sut->full());
+    EXPECT_THAT(m_sut->size(), Eq(CAPACITY));
+    EXPECT_THAT(emplace(CAPACITY), Eq(nullptr));
+    EXPECT_THAT(values(), ElementsAre(0U, 1U, 2U, 3U, 4U));
+}
+
+TEST_F(PortDataContainer_test, ErasedElementIsDestroyedAndNotIteratedAnymore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0c95d02-2c49-42e7-8d0d-f6f780c6e0af");
+    emplace(0U);
+    auto* element = emplace(1U);
+    emplace(2U);
+
+    auto it = m_sut->erase(element);
+
+    EXPECT_THAT(m_destructorCounter, Eq(1U));
+    EXPECT_THAT(m_sut->size(), Eq(2U));
+    EXPECT_THAT(it->m_value, Eq(2U));
+    EXPECT_THAT(values(), ElementsAre(0U, 2U));
+}
+
+TEST_F(PortDataContainer_test, EraseWhileIteratingVisitsAllRemainingElements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fc6079c0-471f-476c-883e-c81ef3777059");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        emplace(i);
+    }
+
+    std::vector<uint64_t> visited;
+    auto it = m_sut->begin();
+    while (it != m_sut->end())
+    {
+        auto current = it++;
+        visited.push_back(current->m_value);
+        if (current->m_value % 2U == 0U)
+        {
+            m_sut->erase(current.to_ptr());
+        }
+    }
+
+    EXPECT_THAT(visited, ElementsAre(0U, 1U, 2U, 3U, 4U));
+    EXPECT_THAT(values(), ElementsAre(1U, 3U));
+}
+
+TEST_F(PortDataContainer_test, EmplaceReusesTheFirstFreeSlotAndKeepsTheIterationOrderByPosition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1dc1895a-1862-4428-bf50-1cb6adfa8dbb");
+    std::vector<PortDataMock*> elements;
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        elements.push_back(emplace(i));
+    }
+    m_sut->erase(elements[3]);
+    m_sut->erase(elements[1]);
+
+    EXPECT_THAT(emplace(10U), Eq(elements[1]));
+    EXPECT_THAT(emplace(30U), Eq(elements[3]));
+    EXPECT_THAT(values(), ElementsAre(0U, 10U, 2U, 30U, 4U));
+}
+
+TEST_F(PortDataContainer_test, ErasingAllElementsMakesContainerEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "deadd29e-d454-44ec-af2d-e3b413de1c71");
+    std::vector<PortDataMock*> elements;
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        elements.push_back(emplace(i));
+    }
+
+    for (auto* element : {elements[2], elements[0], elements[4], elements[1], elements[3]})
+    {
+        m_sut->erase(element);
+    }
+
+    EXPECT_TRUE(m_sut->empty());
+    EXPECT_TRUE(m_sut->begin() == m_sut->end());
+    EXPECT_THAT(m_destructorCounter, Eq(CAPACITY));
+}
+
+TEST_F(PortDataContainer_test, DestructorDestroysTheRemainingElements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d662ff7-498e-4efe-9f0f-a2b7c453af0b");
+    emplace(0U);
+    emplace(1U);
+    m_sut->erase(emplace(2U));
+
+    m_sut.reset();
+
+    EXPECT_THAT(m_destructorCounter, Eq(3U));
+}
+
+TEST_F(PortDataContainer_test, ContainerWithZeroCapacityRequiresNoMemoryAndIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53ef1b3d-a0e2-48c4-a587-1eb6895decf1");
+    EXPECT_THAT(Sut::requiredMemorySize(0U), Eq(0U));
+
+    iox::BumpAllocator allocator{nullptr, 0U};
+    Sut sut{0U, allocator};
+
+    EXPECT_TRUE(sut.empty());
+    EXPECT_TRUE(sut.full());
+    EXPECT_TRUE(sut.emplace(0U, m_destructorCounter) == sut.end());
+}
+
+TEST_F(PortDataContainer_test, ErasingAnElementOfAnotherContainerLeadsToTermination)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "89a731e1-a88f-45c3-a3de-e5bbeb7976b5");
+    PortDataMock element{0U, m_destructorCounter};
+
+    IOX_EXPECT_FATAL_FAILURE([&] { m_sut->erase(&element); }, iox::er::ENFORCE_VIOLATION);
+}
+
+TEST_F(PortDataContainer_test, ErasingAFreeSlotLeadsToTermination)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fbd55b74-e506-4b92-9ba8-bbf78d4f735b");
+    m_sut->erase(emplace(0U));
+
+    IOX_EXPECT_FATAL_FAILURE([&] { m_sut->erase(Sut::IndexType{0U}); }, iox::er::ENFORCE_VIOLATION);
+}
+
+TEST_F(PortDataContainer_test, AllocatorWithoutEnoughMemoryLeadsToTermination)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "34106424-45d0-4510-94f5-c367b85cbe51");
+    std::vector<uint8_t> storage(sizeof(PortDataMock));
+    iox::BumpAllocator allocator{storage.data(), storage.size()};
+
+    IOX_EXPECT_FATAL_FAILURE([&] { Sut sut(CAPACITY, allocator); }, iox::er::ENFORCE_VIOLATION);
+}
+} // namespace
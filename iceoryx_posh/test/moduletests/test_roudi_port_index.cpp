@@ -0,0 +1,148 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iceoryx_posh/internal/roudi/port_index.hpp"
+
+#include "iceoryx_hoofs/testing/fatal_failure.hpp"
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using namespace iox::testing;
+using iox::capro::ServiceDescription;
+
+struct PortDataMock
+{
+    explicit PortDataMock(const ServiceDescription& serviceDescription)
+        : m_serviceDescription(serviceDescription)
+    {
+    }
+
+    ServiceDescription m_serviceDescription;
+};
+
+class PortIndex_test : public Test
+{
+  public:
+    static constexpr uint32_t CAPACITY{4U};
+
+    std::vector<PortDataMock*> visit(const ServiceDescription& serviceDescription)
+    {
+        std::vector<PortDataMock*> visitedPorts;
+        m_sut.forEachPortWith(serviceDescription, [&](auto& port) { visitedPorts.push_back(&port); });
+        return visitedPorts;
+    }
+
+    PortDataMock m_fuu{{"Fuu", "Bar", "Baz"}};
+    PortDataMock m_anotherFuu{{"Fuu", "Bar", "Baz"}};
+    PortDataMock m_yetAnotherFuu{{"Fuu", "Bar", "Baz"}};
+    PortDataMock m_bla{{"Bla", "Bar", "Baz"}};
+    PortDataMock m_blubb{{"Blubb", "Bar", "Baz"}};
+
+    PortIndex<PortDataMock, CAPACITY> m_sut;
+};
+
+constexpr uint32_t PortIndex_test::CAPACITY;
+
+TEST_F(PortIndex_test, EmptyIndexVisitsNoPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eaf661c5-579c-4a54-8a33-7d3e82cabc1b");
+    EXPECT_THAT(visit(m_fuu.m_serviceDescription), IsEmpty());
+}
+
+TEST_F(PortIndex_test, OnlyPortsWithTheServiceDescriptionAreVisited)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "775ad613-4fc8-4e85-87b6-08b9fef5c9fb");
+    m_sut.add(&m_fuu);
+    m_sut.add(&m_bla);
+    m_sut.add(&m_anotherFuu);
+
+    EXPECT_THAT(visit(m_fuu.m_serviceDescription), ElementsAre(&m_fuu, &m_anotherFuu));
+    EXPECT_THAT(visit(m_bla.m_serviceDescription), ElementsAre(&m_bla));
+    EXPECT_THAT(visit(m_blubb.m_serviceDescription), IsEmpty());
+}
+
+TEST_F(PortIndex_test, PortsAreVisitedInTheOrderTheyWereAdded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "64d98db1-cd45-4a82-bc18-64179c66c370");
+    m_sut.add(&m_yetAnotherFuu);
+    m_sut.add(&m_fuu);
+    m_sut.add(&m_anotherFuu);
+
+    EXPECT_THAT(visit(m_fuu.m_serviceDescription), ElementsAre(&m_yetAnotherFuu, &m_fuu, &m_anotherFuu));
+}
+
+TEST_F(PortIndex_test, RemovedPortIsNoLongerVisited)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "89dfe2d2-fe2a-46ba-9cc4-5b2afe94dcea");
+    m_sut.add(&m_fuu);
+    m_sut.add(&m_anotherFuu);
+    m_sut.add(&m_yetAnotherFuu);
+
+    m_sut.remove(&m_anotherFuu);
+    EXPECT_THAT(visit(m_fuu.m_serviceDescription), ElementsAre(&m_fuu, &m_yetAnotherFuu));
+
+    m_sut.remove(&m_yetAnotherFuu);
+    m_sut.add(&m_anotherFuu);
+    EXPECT_THAT(visit(m_fuu.m_serviceDescription), ElementsAre(&m_fuu, &m_anotherFuu));
+}
+
+TEST_F(PortIndex_test, RemovingPortWhichIsNotInTheIndexHasNoEffect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "04ebc652-4dd9-43b8-80ba-e4229cc2208f");
+    m_sut.add(&m_fuu);
+
+    m_sut.remove(&m_anotherFuu);
+    m_sut.remove(nullptr);
+
+    EXPECT_THAT(visit(m_fuu.m_serviceDescription), ElementsAre(&m_fuu));
+}
+
+TEST_F(PortIndex_test, CallableCanRemoveTheVisitedPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3cf54d77-450c-4cca-b404-af6c740b8ab8");
+    m_sut.add(&m_fuu);
+    m_sut.add(&m_anotherFuu);
+    m_sut.add(&m_yetAnotherFuu);
+
+    std::vector<PortDataMock*> visitedPorts;
+    m_sut.forEachPortWith(m_fuu.m_serviceDescription, [&](auto& port) {
+        visitedPorts.push_back(&port);
+        m_sut.remove(&port);
+    });
+
+    EXPECT_THAT(visitedPorts, ElementsAre(&m_fuu, &m_anotherFuu, &m_yetAnotherFuu));
+    EXPECT_THAT(visit(m_fuu.m_serviceDescription), IsEmpty());
+}
+
+TEST_F(PortIndex_test, AddingMoreThanCapacityPortsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0218fa8-cfce-4bc9-93f8-1bff9b674cc8");
+    m_sut.add(&m_fuu);
+    m_sut.add(&m_anotherFuu);
+    m_sut.add(&m_yetAnotherFuu);
+    m_sut.add(&m_bla);
+
+    IOX_EXPECT_FATAL_FAILURE([&] { m_sut.add(&m_blubb); }, iox::er::ENFORCE_VIOLATION);
+}
+
+} // namespace
@@ -26,6 +26,8 @@
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -85,7 +87,10 @@ class PortPool_test : public Test
     }
 
   public:
-    roudi::PortPoolData m_portPoolData{roudi::DEFAULT_UNIQUE_ROUDI_ID};
+    config::PortPoolCapacity m_capacity;
+    std::vector<uint8_t> m_storage = std::vector<uint8_t>(roudi::PortPoolData::requiredStorageSize(m_capacity));
+    BumpAllocator m_allocator{m_storage.data(), m_storage.size()};
+    roudi::PortPoolData m_portPoolData{roudi::DEFAULT_UNIQUE_ROUDI_ID, m_capacity, m_allocator};
     roudi::PortPool sut{m_portPoolData};
 
     ServiceDescription m_serviceDescription{"service1", "instance1", "event1"};
@@ -668,4 +673,56 @@ TEST_F(PortPool_test, RemoveConditionVariableDataIsSuccessful)
 
 // END ConditionVariable tests
 
+TEST_F(PortPool_test, PortPoolWithConfiguredCapacityProvidesOnlyTheConfiguredNumberOfPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e37ef918-023a-4b99-8216-c4d931dc64d9");
+    config::PortPoolCapacity capacity;
+    capacity.publishers = 2U;
+    capacity.subscribers = 1U;
+    capacity.servers = 0U;
+    capacity.clients = 0U;
+    capacity.interfaces = 0U;
+    capacity.conditionVariables = 1U;
+
+    std::vector<uint8_t> storage(roudi::PortPoolData::requiredStorageSize(capacity));
+    EXPECT_THAT(storage.size(), Lt(m_storage.size()));
+    BumpAllocator allocator{storage.data(), storage.size()};
+    roudi::PortPoolData portPoolData{roudi::DEFAULT_UNIQUE_ROUDI_ID, capacity, allocator};
+    roudi::PortPool portPool{portPoolData};
+
+    auto addPublisherPort = [&] {
+        return portPool
+            .addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions)
+            .has_error();
+    };
+    auto addSubscriberPort = [&] {
+        return portPool.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions).has_error();
+    };
+
+    for (uint32_t i = 0U; i < capacity.publishers; ++i)
+    {
+        EXPECT_FALSE(addPublisherPort());
+    }
+    EXPECT_FALSE(addSubscriberPort());
+    EXPECT_FALSE(portPool.addConditionVariableData(m_applicationName).has_error());
+
+    IOX_TESTING_EXPECT_OK();
+
+    EXPECT_TRUE(addPublisherPort());
+    EXPECT_TRUE(addSubscriberPort());
+    EXPECT_TRUE(portPool.addServerPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_serverOptions)
+                    .has_error());
+    EXPECT_TRUE(portPool.addClientPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_clientOptions)
+                    .has_error());
+    EXPECT_TRUE(portPool.addInterfacePort(m_applicationName, capro::Interfaces::INTERNAL).has_error());
+    EXPECT_TRUE(portPool.addConditionVariableData(m_applicationName).has_error());
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__PUBLISHERLIST_OVERFLOW);
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__SUBSCRIBERLIST_OVERFLOW);
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__SERVERLIST_OVERFLOW);
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__CLIENTLIST_OVERFLOW);
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__INTERFACELIST_OVERFLOW);
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW);
+}
+
 } // namespace
@@ -82,7 +82,8 @@ TEST_F(ProcessManager_test, RegisteredProcessCountIsInitiallyZero)
 TEST_F(ProcessManager_test, RegisterProcessWithMonitorningWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "57311fb6-f993-4011-bbe9-e42df5e54d5e");
-    auto result = m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+    auto result =
+        m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo).has_value();
 
     EXPECT_TRUE(result);
     EXPECT_THAT(m_sut->registeredProcessCount(), Eq(1));
@@ -92,7 +93,8 @@ TEST_F(ProcessManager_test, RegisterProcessWithoutMonitoringWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ce0fcf0e-564c-4330-86c8-13b33c2a64c8");
     constexpr bool isNotMonitored{false};
-    auto result = m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo);
+    auto result =
+        m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo).has_value();
 
     EXPECT_TRUE(result);
 }
@@ -100,8 +102,10 @@ TEST_F(ProcessManager_test, RegisterProcessWithoutMonitoringWorks)
 TEST_F(ProcessManager_test, RegisterSameProcessTwiceWithMonitoringWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "d449513c-2f8f-4b77-b419-8d1b5743f02d");
-    auto result1 = m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
-    auto result2 = m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+    auto result1 =
+        m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo).has_value();
+    auto result2 =
+        m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo).has_value();
 
     EXPECT_TRUE(result1);
     EXPECT_TRUE(result2);
@@ -112,8 +116,10 @@ TEST_F(ProcessManager_test, RegisterSameProcessTwiceWithoutMonitoringWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "08d16887-72e5-4934-8447-a3b4760444e1");
     constexpr bool isNotMonitored{false};
-    auto result1 = m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo);
-    auto result2 = m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo);
+    auto result1 =
+        m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo).has_value();
+    auto result2 =
+        m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo).has_value();
 
     EXPECT_TRUE(result1);
     EXPECT_TRUE(result2);
@@ -171,4 +177,29 @@ TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
     ASSERT_FALSE(publisher.isOffered());
 }
 
+TEST_F(ProcessManager_test, ReplyIsSentAfterTheProcessManagerWasUnlocked)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a71983d-94c6-4a40-86fc-605de35c2f80");
+    Watchdog watchdog(iox::units::Duration::fromSeconds(5U));
+    watchdog.watchAndActOnFailure([] { std::terminate(); });
+
+    auto isRegistered =
+        m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo).has_value();
+    ASSERT_TRUE(isRegistered);
+    auto reply = m_sut->addConditionVariableForProcess(m_processname);
+
+    // the pending reply must neither block the requests of other processes nor the discovery
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(1U));
+    m_sut->discoveryUpdate();
+
+    reply.send();
+
+    IpcMessage message;
+    ASSERT_TRUE(m_processIpcInterface.timedReceive(iox::units::Duration::fromSeconds(1U), message));
+    EXPECT_THAT(message.getElementAtIndex(0), Eq(IpcMessageTypeToString(IpcMessageType::REG_ACK)));
+    ASSERT_TRUE(m_processIpcInterface.timedReceive(iox::units::Duration::fromSeconds(1U), message));
+    EXPECT_THAT(message.getElementAtIndex(0),
+                Eq(IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE_ACK)));
+}
+
 } // namespace
@@ -210,6 +210,35 @@ TYPED_TEST(ServiceRegistry_test, AddMoreThanMaximumNumberOfServiceDescriptionsFa
     EXPECT_THAT(result.error(), Eq(ServiceRegistry::Error::SERVICE_REGISTRY_FULL));
 }
 
+TYPED_TEST(ServiceRegistry_test, ServiceDescriptionsAddedIntoFreedSlotsOfFullRegistryAreFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "94cbd4ec-f17a-445c-8e22-ce4b50503fba");
+    for (uint64_t i = 0U; i < CAPACITY; i++)
+    {
+        ASSERT_FALSE(this->sut
+                         .add(iox::capro::ServiceDescription(
+                             "Foo", "Bar", iox::into<iox::lossy<iox::capro::IdString_t>>(iox::convert::toString(i))))
+                         .has_error());
+    }
+
+    this->sut.remove(iox::capro::ServiceDescription("Foo", "Bar", "0"));
+    this->sut.remove(iox::capro::ServiceDescription("Foo", "Bar", "1"));
+
+    ASSERT_FALSE(this->sut.add(iox::capro::ServiceDescription("Foo", "Baz", "0")).has_error());
+    ASSERT_FALSE(this->sut.add(iox::capro::ServiceDescription("Foo", "Bar", "1")).has_error());
+
+    this->find(IdString_t("Foo"), IdString_t("Bar"), iox::capro::Wildcard);
+    EXPECT_THAT(this->searchResult.size(), Eq(CAPACITY - 1U));
+
+    this->find(IdString_t("Foo"), IdString_t("Baz"), IdString_t("0"));
+    ASSERT_THAT(this->searchResult.size(), Eq(1U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(ServiceDescription("Foo", "Baz", "0")));
+
+    this->find(iox::capro::Wildcard, iox::capro::Wildcard, IdString_t("0"));
+    ASSERT_THAT(this->searchResult.size(), Eq(1U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(ServiceDescription("Foo", "Baz", "0")));
+}
+
 TYPED_TEST(ServiceRegistry_test, AddServiceDescriptionsWhichWasAlreadyAddedAndReturnsOneResult)
 {
     ::testing::Test::RecordProperty("TEST_ID", "79234425-98ce-49eb-bf04-82883ee22a92");
@@ -0,0 +1,320 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_frame.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+
+constexpr char RUNTIME_NAME[] = "ipc_frame_test";
+
+class IpcFrame_test : public Test
+{
+  public:
+    /// @brief writes a binary header with an arbitrary version
+    static IpcFrame createFrameWithVersion(const uint8_t version, const IpcMessageType type)
+    {
+        IpcFrame frame;
+        frame << IpcFrame::BINARY_MARKER << version << static_cast<std::underlying_type_t<IpcMessageType>>(type)
+              << RuntimeName_t(RUNTIME_NAME);
+        return frame;
+    }
+
+    const capro::ServiceDescription service{
+        "Radar", "FrontLeft", "Objects", {1U, 2U, 3U, 4U}, capro::Interfaces::SOMEIP};
+};
+
+TEST_F(IpcFrame_test, DefaultConstructedFrameIsAnEmptyTextFrame)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "098823ab-e9b3-4094-be21-8218cededd9e");
+    IpcFrame sut;
+
+    EXPECT_TRUE(sut.isValid());
+    EXPECT_FALSE(sut.isBinary());
+    EXPECT_THAT(sut.getVersion(), Eq(0U));
+    EXPECT_THAT(sut.getMessageType(), Eq(IpcMessageType::NOTYPE));
+    EXPECT_TRUE(sut.getRuntimeName().empty());
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(IpcFrame_test, BinaryFrameContainsHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c335b2ee-b1ff-42c5-a985-c28054d94650");
+    IpcFrame sut(IpcMessageType::CREATE_SUBSCRIBER, RUNTIME_NAME);
+
+    EXPECT_TRUE(sut.isValid());
+    EXPECT_TRUE(sut.isBinary());
+    EXPECT_THAT(sut.getVersion(), Eq(IpcFrame::BINARY_VERSION));
+    EXPECT_THAT(sut.getMessageType(), Eq(IpcMessageType::CREATE_SUBSCRIBER));
+    EXPECT_THAT(sut.getRuntimeName(), Eq(RuntimeName_t(RUNTIME_NAME)));
+
+    IpcFrameReader reader(sut);
+    EXPECT_TRUE(reader.isValid());
+    EXPECT_TRUE(reader.isAtEnd());
+}
+
+TEST_F(IpcFrame_test, ServiceDescriptionAndPortConfigInfoCanBeReadBack)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "de7839a7-70f2-401e-a18a-06f3b4e016cd");
+    auto localService = service;
+    localService.setLocal();
+    const PortConfigInfo portConfigInfo{11U, 22U, 33U};
+
+    IpcFrame sut(IpcMessageType::CREATE_PUBLISHER, RUNTIME_NAME);
+    sut << localService << portConfigInfo;
+    ASSERT_TRUE(sut.isValid());
+
+    capro::ServiceDescription readService;
+    PortConfigInfo readPortConfigInfo;
+    IpcFrameReader reader(sut);
+    reader >> readService >> readPortConfigInfo;
+
+    ASSERT_TRUE(reader.isValid());
+    EXPECT_TRUE(reader.isAtEnd());
+    EXPECT_THAT(readService, Eq(localService));
+    EXPECT_THAT(readService.getClassHash(), Eq(localService.getClassHash()));
+    EXPECT_THAT(readService.getScope(), Eq(capro::Scope::LOCAL));
+    EXPECT_THAT(readService.getSourceInterface(), Eq(capro::Interfaces::SOMEIP));
+    EXPECT_THAT(readPortConfigInfo, Eq(portConfigInfo));
+}
+
+TEST_F(IpcFrame_test, PublisherAndSubscriberOptionsCanBeReadBack)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e62212b1-6e0b-4590-9545-7e4bc004f9e4");
+    popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 7U;
+    publisherOptions.nodeName = "PublisherNode";
+    publisherOptions.offerOnCreate = false;
+    publisherOptions.subscriberTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+    popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 13U;
+    subscriberOptions.historyRequest = 5U;
+    subscriberOptions.nodeName = "SubscriberNode";
+    subscriberOptions.subscribeOnCreate = false;
+    subscriberOptions.queueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    subscriberOptions.requiresPublisherHistorySupport = true;
+
+    IpcFrame sut(IpcMessageType::CREATE_PUBLISHER, RUNTIME_NAME);
+    sut << publisherOptions << subscriberOptions;
+    ASSERT_TRUE(sut.isValid());
+
+    popo::PublisherOptions readPublisherOptions;
+    popo::SubscriberOptions readSubscriberOptions;
+    IpcFrameReader reader(sut);
+    reader >> readPublisherOptions >> readSubscriberOptions;
+
+    ASSERT_TRUE(reader.isValid());
+    EXPECT_TRUE(reader.isAtEnd());
+    EXPECT_THAT(readPublisherOptions.historyCapacity, Eq(publisherOptions.historyCapacity));
+    EXPECT_THAT(readPublisherOptions.nodeName, Eq(publisherOptions.nodeName));
+    EXPECT_THAT(readPublisherOptions.offerOnCreate, Eq(publisherOptions.offerOnCreate));
+    EXPECT_THAT(readPublisherOptions.subscriberTooSlowPolicy, Eq(publisherOptions.subscriberTooSlowPolicy));
+    EXPECT_THAT(readSubscriberOptions.queueCapacity, Eq(subscriberOptions.queueCapacity));
+    EXPECT_THAT(readSubscriberOptions.historyRequest, Eq(subscriberOptions.historyRequest));
+    EXPECT_THAT(readSubscriberOptions.nodeName, Eq(subscriberOptions.nodeName));
+    EXPECT_THAT(readSubscriberOptions.subscribeOnCreate, Eq(subscriberOptions.subscribeOnCreate));
+    EXPECT_THAT(readSubscriberOptions.queueFullPolicy, Eq(subscriberOptions.queueFullPolicy));
+    EXPECT_THAT(readSubscriberOptions.requiresPublisherHistorySupport,
+                Eq(subscriberOptions.requiresPublisherHistorySupport));
+}
+
+TEST_F(IpcFrame_test, ClientAndServerOptionsCanBeReadBack)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d230e1ff-0b60-4fe3-8afd-8d1d899c1747");
+    popo::ClientOptions clientOptions;
+    clientOptions.responseQueueCapacity = 3U;
+    clientOptions.nodeName = "ClientNode";
+    clientOptions.connectOnCreate = false;
+    clientOptions.responseQueueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    clientOptions.serverTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+    popo::ServerOptions serverOptions;
+    serverOptions.requestQueueCapacity = 9U;
+    serverOptions.nodeName = "ServerNode";
+    serverOptions.offerOnCreate = false;
+    serverOptions.requestQueueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    serverOptions.clientTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+    IpcFrame sut(IpcMessageType::CREATE_CLIENT, RUNTIME_NAME);
+    sut << clientOptions << serverOptions;
+    ASSERT_TRUE(sut.isValid());
+
+    popo::ClientOptions readClientOptions;
+    popo::ServerOptions readServerOptions;
+    IpcFrameReader reader(sut);
+    reader >> readClientOptions >> readServerOptions;
+
+    ASSERT_TRUE(reader.isValid());
+    EXPECT_TRUE(reader.isAtEnd());
+    EXPECT_THAT(readClientOptions, Eq(clientOptions));
+    EXPECT_THAT(readServerOptions, Eq(serverOptions));
+}
+
+TEST_F(IpcFrame_test, FrameBecomesInvalidWhenFieldsExceedCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3da6f9a3-9aba-4aa3-a2d9-5a3eef93b6fa");
+    IpcFrame sut(IpcMessageType::CREATE_PUBLISHER, RUNTIME_NAME);
+    for (uint64_t i = 0U; i < IpcFrame::CAPACITY / sizeof(uint64_t); ++i)
+    {
+        sut << i;
+    }
+
+    EXPECT_FALSE(sut.isValid());
+    EXPECT_THAT(sut.size(), Le(IpcFrame::CAPACITY));
+}
+
+TEST_F(IpcFrame_test, FrameBecomesInvalidWhenNodeNameContainsSeparator)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ef416c5b-0be9-4cf5-9e33-b8a41ee66e2c");
+    popo::ServerOptions serverOptions;
+    serverOptions.nodeName = "invalid,node";
+
+    IpcFrame sut(IpcMessageType::CREATE_SERVER, RUNTIME_NAME);
+    sut << serverOptions;
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcFrame_test, ReaderIsInvalidWhenReadingBeyondTheEnd)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "92a54f4f-91f2-4615-b3d7-3430cf3713ee");
+    IpcFrame sut(IpcMessageType::CREATE_PUBLISHER, RUNTIME_NAME);
+    sut << service;
+
+    capro::ServiceDescription readService;
+    popo::PublisherOptions readOptions;
+    IpcFrameReader reader(sut);
+    reader >> readService;
+    EXPECT_TRUE(reader.isValid());
+
+    reader >> readOptions;
+    EXPECT_FALSE(reader.isValid());
+}
+
+TEST_F(IpcFrame_test, ReaderIsInvalidForEnumValueOutOfRange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a393f7ea-bee5-42e8-b3a2-26cf50deb1ed");
+    constexpr uint8_t INVALID_POLICY{42U};
+    IpcFrame sut(IpcMessageType::CREATE_PUBLISHER, RUNTIME_NAME);
+    sut << uint64_t{1U} << NodeName_t("node") << true << INVALID_POLICY;
+
+    popo::PublisherOptions readOptions;
+    IpcFrameReader reader(sut);
+    reader >> readOptions;
+
+    EXPECT_FALSE(reader.isValid());
+}
+
+TEST_F(IpcFrame_test, ReaderIsInvalidForStringLongerThanCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b9ba53e-5f07-4e89-b2d2-888d797120fb");
+    IpcFrame sut(IpcMessageType::CREATE_PUBLISHER, RUNTIME_NAME);
+    sut << string<8>("too long");
+
+    string<4> readValue;
+    IpcFrameReader reader(sut);
+    reader >> readValue;
+
+    EXPECT_FALSE(reader.isValid());
+}
+
+TEST_F(IpcFrame_test, ReaderIsInvalidForUnsupportedVersion)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "40365e1a-9920-4852-a67d-51dffc9e6748");
+    constexpr uint8_t FUTURE_VERSION{IpcFrame::BINARY_VERSION + 1U};
+    auto sut = createFrameWithVersion(FUTURE_VERSION, IpcMessageType::CREATE_SERVER);
+
+    EXPECT_TRUE(sut.isBinary());
+    EXPECT_THAT(sut.getVersion(), Eq(FUTURE_VERSION));
+    EXPECT_THAT(sut.getMessageType(), Eq(IpcMessageType::CREATE_SERVER));
+    EXPECT_THAT(sut.getRuntimeName(), Eq(RuntimeName_t(RUNTIME_NAME)));
+
+    IpcFrameReader reader(sut);
+    EXPECT_FALSE(reader.isValid());
+}
+
+TEST_F(IpcFrame_test, UnknownMessageTypeIsReportedAsNoType)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c7c8f56e-a308-47ad-9a9e-293019ebb36d");
+    auto sut = createFrameWithVersion(IpcFrame::BINARY_VERSION, IpcMessageType::END);
+
+    EXPECT_THAT(sut.getMessageType(), Eq(IpcMessageType::NOTYPE));
+}
+
+TEST_F(IpcFrame_test, PortBatchEntriesOfAllKindsCanBeReadBack)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5ef72ce-0ee9-48ce-8ed1-bb2169a0da1c");
+    popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 13U;
+    popo::ServerOptions serverOptions;
+    serverOptions.requestQueueCapacity = 9U;
+
+    PortBatch ports;
+    ASSERT_TRUE(ports.addPublisher(service, {}, {11U, 22U, 33U}).has_value());
+    ASSERT_TRUE(ports.addSubscriber(service, subscriberOptions).has_value());
+    ASSERT_TRUE(ports.addClient(service).has_value());
+    ASSERT_TRUE(ports.addServer(service, serverOptions).has_value());
+
+    IpcFrame sut(IpcMessageType::CREATE_PORTS, RUNTIME_NAME);
+    for (uint64_t i = 0U; i < ports.size(); ++i)
+    {
+        sut << ports[i];
+    }
+    ASSERT_TRUE(sut.isValid());
+
+    PortBatch readPorts;
+    IpcFrameReader reader(sut);
+    while (reader.isValid() && !reader.isAtEnd())
+    {
+        PortBatch::Entry entry;
+        reader >> entry;
+        ASSERT_TRUE(readPorts.add(entry).has_value());
+    }
+
+    ASSERT_TRUE(reader.isValid());
+    ASSERT_THAT(readPorts.size(), Eq(ports.size()));
+    for (uint64_t i = 0U; i < ports.size(); ++i)
+    {
+        EXPECT_THAT(readPorts[i].kind(), Eq(ports[i].kind()));
+        EXPECT_THAT(readPorts[i].service, Eq(ports[i].service));
+        EXPECT_THAT(readPorts[i].portConfigInfo, Eq(ports[i].portConfigInfo));
+    }
+    EXPECT_THAT(readPorts[1U].options.get<popo::SubscriberOptions>()->queueCapacity,
+                Eq(subscriberOptions.queueCapacity));
+    EXPECT_THAT(*readPorts[3U].options.get<popo::ServerOptions>(), Eq(serverOptions));
+}
+
+TEST_F(IpcFrame_test, ReaderIsInvalidForPortBatchEntryWithUnknownKind)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b4cba883-e7f1-4d2f-a67b-5222ba8dd9c6");
+    constexpr uint8_t UNKNOWN_PORT_KIND{static_cast<uint8_t>(PortKind::SERVER) + 1U};
+    IpcFrame sut(IpcMessageType::CREATE_PORTS, RUNTIME_NAME);
+    sut << UNKNOWN_PORT_KIND << service << popo::ServerOptions() << PortConfigInfo();
+    ASSERT_TRUE(sut.isValid());
+
+    PortBatch::Entry entry;
+    IpcFrameReader reader(sut);
+    reader >> entry;
+
+    EXPECT_FALSE(reader.isValid());
+}
+} // namespace
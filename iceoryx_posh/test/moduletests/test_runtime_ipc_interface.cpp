@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_frame.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
 #include "iox/message_queue.hpp"
 #include "iox/named_pipe.hpp"
@@ -336,4 +337,45 @@ TYPED_TEST(IpcInterface_test, TimedReceiveWorks)
     auto timeDiff = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
     EXPECT_GE(into<units::Duration>(timeDiff), timeout);
 }
+
+TYPED_TEST(IpcInterface_test, TimedReceiveOfFrameWorksWithBinaryEncoding)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "95bef87c-4085-4f12-8e94-46ba09db7747");
+    const capro::ServiceDescription service{"Some", "Binary", "Service"};
+    runtime::IpcFrame frame(runtime::IpcMessageType::CREATE_PUBLISHER, anotherGoodName);
+    frame << service;
+
+    ASSERT_TRUE(this->client->send(frame));
+
+    runtime::IpcFrame receivedFrame;
+    ASSERT_TRUE(this->server->timedReceive(100_ms, receivedFrame));
+
+    EXPECT_TRUE(receivedFrame.isBinary());
+    EXPECT_THAT(receivedFrame.getMessageType(), Eq(runtime::IpcMessageType::CREATE_PUBLISHER));
+    EXPECT_THAT(receivedFrame.getRuntimeName(), Eq(RuntimeName_t(anotherGoodName)));
+
+    capro::ServiceDescription receivedService;
+    runtime::IpcFrameReader reader(receivedFrame);
+    reader >> receivedService;
+    ASSERT_TRUE(reader.isValid());
+    EXPECT_TRUE(reader.isAtEnd());
+    EXPECT_THAT(receivedService, Eq(service));
+}
+
+TYPED_TEST(IpcInterface_test, TimedReceiveOfFrameWorksWithTextEncoding)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4fe619ae-f2e8-4bc7-b23c-49a4e2c828f9");
+    runtime::IpcMessage msg;
+    msg << runtime::IpcMessageTypeToString(runtime::IpcMessageType::TERMINATION) << anotherGoodName;
+
+    ASSERT_TRUE(this->client->send(msg));
+
+    runtime::IpcFrame receivedFrame;
+    ASSERT_TRUE(this->server->timedReceive(100_ms, receivedFrame));
+
+    EXPECT_FALSE(receivedFrame.isBinary());
+    EXPECT_THAT(receivedFrame.getMessageType(), Eq(runtime::IpcMessageType::TERMINATION));
+    EXPECT_THAT(receivedFrame.getRuntimeName(), Eq(RuntimeName_t(anotherGoodName)));
+    EXPECT_EQ(receivedFrame.toTextMessage(), msg);
+}
 } // namespace
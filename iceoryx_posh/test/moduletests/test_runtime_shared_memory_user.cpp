@@ -0,0 +1,154 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
+#include "iceoryx_posh/roudi/memory/iceoryx_roudi_memory_manager.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iox/posix_user.hpp"
+
+#include "test.hpp"
+
+#include <memory>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+
+constexpr uint64_t MARKER{0xC0FFEEU};
+
+/// @brief RouDi creates the shared memory in this process; afterwards the registration of the relative pointers is
+/// cleared, which leaves the segments as they are seen by a separate process
+class SharedMemoryUser_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_roudiMemoryManager = std::make_unique<roudi::IceOryxRouDiMemoryManager>(
+            roudi_env::MinimalIceoryxConfigBuilder().create());
+        ASSERT_FALSE(m_roudiMemoryManager->createAndAnnounceMemory().has_error());
+
+        const auto* mgmtMemoryProvider = m_roudiMemoryManager->mgmtMemoryProvider();
+        m_managementSegmentId = mgmtMemoryProvider->segmentId().value();
+        m_managementSize = mgmtMemoryProvider->size();
+        auto* segmentManager = m_roudiMemoryManager->segmentManager().value();
+        m_segmentManagerOffset = UntypedRelativePointer::getOffset(segment_id_t{m_managementSegmentId}, segmentManager);
+
+        m_payloadSegmentId =
+            segmentManager->getSegmentInformationWithWriteAccessForUser(PosixUser::getUserOfCurrentProcess())
+                .m_segmentID;
+        *static_cast<uint64_t*>(UntypedRelativePointer::getBasePtr(segment_id_t{m_payloadSegmentId})) = MARKER;
+
+        UntypedRelativePointer::unregisterAll();
+    }
+
+    void TearDown() override
+    {
+        UntypedRelativePointer::unregisterAll();
+    }
+
+    SharedMemoryUser createSut(const PayloadSegmentMapping payloadSegmentMapping)
+    {
+        return SharedMemoryUser::create(DEFAULT_DOMAIN_ID,
+                                        m_managementSegmentId,
+                                        m_managementSize,
+                                        m_segmentManagerOffset,
+                                        roudi::MemoryResidency::OFF,
+                                        payloadSegmentMapping)
+            .expect("Creating the SharedMemoryUser");
+    }
+
+    uint64_t readMarker() const
+    {
+        RelativePointer<uint64_t> marker(RelativePointer<uint64_t>::offset_t{0U}, segment_id_t{m_payloadSegmentId});
+        return *marker;
+    }
+
+    std::unique_ptr<roudi::IceOryxRouDiMemoryManager> m_roudiMemoryManager;
+    uint64_t m_managementSegmentId{0U};
+    uint64_t m_managementSize{0U};
+    UntypedRelativePointer::offset_t m_segmentManagerOffset{0U};
+    uint64_t m_payloadSegmentId{0U};
+};
+
+TEST_F(SharedMemoryUser_test, PayloadSegmentsAreMappedOnRegistration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2ed2fb7e-87e8-4ebb-b209-6e896f820dc3");
+    auto sut = createSut(PayloadSegmentMapping::ON_REGISTRATION);
+
+    EXPECT_THAT(readMarker(), Eq(MARKER));
+    EXPECT_THAT(sut.unmapPayloadSegments(), Eq(0U));
+    EXPECT_THAT(readMarker(), Eq(MARKER));
+}
+
+TEST_F(SharedMemoryUser_test, ResolvingRelativePointerMapsPayloadSegmentOnDemand)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e576bc66-c5b5-4d9d-9247-59d06290a423");
+    auto sut = createSut(PayloadSegmentMapping::ON_DEMAND);
+
+    EXPECT_THAT(sut.unmapPayloadSegments(), Eq(0U));
+    EXPECT_THAT(readMarker(), Eq(MARKER));
+    EXPECT_THAT(sut.unmapPayloadSegments(), Eq(1U));
+}
+
+TEST_F(SharedMemoryUser_test, MapWritablePayloadSegmentsMapsSegmentWithWriteAccess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8bf1733e-8ae4-4db8-bbab-19a63a8254fc");
+    auto sut = createSut(PayloadSegmentMapping::ON_DEMAND);
+
+    sut.mapWritablePayloadSegments();
+
+    EXPECT_THAT(sut.unmapPayloadSegments(), Eq(1U));
+}
+
+TEST_F(SharedMemoryUser_test, UnmappedPayloadSegmentIsMappedAgainOnNextAccess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1974176c-fdd8-464c-a7a5-33072b79a40c");
+    auto sut = createSut(PayloadSegmentMapping::ON_DEMAND);
+    EXPECT_THAT(readMarker(), Eq(MARKER));
+    ASSERT_THAT(sut.unmapPayloadSegments(), Eq(1U));
+
+    EXPECT_THAT(readMarker(), Eq(MARKER));
+    EXPECT_THAT(sut.unmapPayloadSegments(), Eq(1U));
+}
+
+TEST_F(SharedMemoryUser_test, DestroyingSharedMemoryUserStopsMappingOnDemand)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d6bdb5a-60d7-45c3-a4ce-7df3ac426897");
+    {
+        auto sut = createSut(PayloadSegmentMapping::ON_DEMAND);
+        EXPECT_THAT(readMarker(), Eq(MARKER));
+    }
+
+    EXPECT_THAT(UntypedRelativePointer::getBasePtr(segment_id_t{m_payloadSegmentId}), Eq(nullptr));
+    EXPECT_THAT(UntypedRelativePointer::getBasePtr(segment_id_t{m_managementSegmentId}), Eq(nullptr));
+}
+
+TEST_F(SharedMemoryUser_test, MovedSharedMemoryUserKeepsMappingOnDemand)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd02a6ef-a3d7-4d90-8cdd-6e2c48932fb7");
+    optional<SharedMemoryUser> sut;
+    {
+        auto movedFrom = createSut(PayloadSegmentMapping::ON_DEMAND);
+        sut.emplace(std::move(movedFrom));
+    }
+
+    EXPECT_THAT(readMarker(), Eq(MARKER));
+    EXPECT_THAT(sut->unmapPayloadSegments(), Eq(1U));
+}
+} // namespace
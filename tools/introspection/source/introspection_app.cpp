@@ -306,7 +306,20 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
 
     wprintw(pad, "Shared memory segment reader group: ");
     prettyPrint(iox::into<std::string>(introspectionInfo.m_readerGroupName), PrettyOptions::bold);
-    wprintw(pad, "\n\n");
+    wprintw(pad, "\n");
+
+    wprintw(pad,
+            "Shared memory segment page size: %llu\n",
+            static_cast<unsigned long long>(introspectionInfo.m_pageSize));
+
+    if (introspectionInfo.m_numaNode == MemPoolIntrospectionInfo::UNKNOWN_NUMA_NODE)
+    {
+        wprintw(pad, "Shared memory segment NUMA node: unknown\n\n");
+    }
+    else
+    {
+        wprintw(pad, "Shared memory segment NUMA node: %d\n\n", introspectionInfo.m_numaNode);
+    }
 
     constexpr int32_t memPoolWidth{8};
     constexpr int32_t usedchunksWidth{14};